@@ -94,7 +94,283 @@ enum class structure_tag_type : uint8_t
     byte_string_tag = 0x07,
     array_tag = 0x08,
     empty_object_tag = 0x09,
-    object_tag = 0x0a
+    object_tag = 0x0a,
+    typed_array_tag = 0x0b
+};
+
+// json_typed_array
+
+// Holds an array whose elements are all int64_t, all uint64_t or all double values without
+// semantic tags, contiguously, for bulk reads of the numbers. The elements are also held as a
+// json_array, built with the numbers, so that element references stay valid under const access.
+
+template <class Json>
+class json_typed_array : public container_base<typename Json::allocator_type>
+{
+public:
+    typedef typename Json::allocator_type allocator_type;
+    typedef json_array<Json> array;
+private:
+    typedef typename std::allocator_traits<allocator_type>:: template rebind_alloc<int64_t> int64_allocator_type;
+    typedef typename std::allocator_traits<allocator_type>:: template rebind_alloc<uint64_t> uint64_allocator_type;
+    typedef typename std::allocator_traits<allocator_type>:: template rebind_alloc<double> double_allocator_type;
+
+    structure_tag_type element_tag_;
+    std::vector<int64_t,int64_allocator_type> int64_values_;
+    std::vector<uint64_t,uint64_allocator_type> uint64_values_;
+    std::vector<double,double_allocator_type> double_values_;
+    array elements_;
+public:
+    using container_base<allocator_type>::get_allocator;
+
+    // An empty array that takes its element type from the first value pushed
+    explicit json_typed_array(const allocator_type& allocator = allocator_type())
+        : container_base<allocator_type>(allocator),
+          element_tag_(structure_tag_type::null_tag),
+          int64_values_(int64_allocator_type(allocator)),
+          uint64_values_(uint64_allocator_type(allocator)),
+          double_values_(double_allocator_type(allocator)),
+          elements_(allocator)
+    {
+    }
+
+    json_typed_array(const int64_t* data, size_t size, const allocator_type& allocator = allocator_type())
+        : container_base<allocator_type>(allocator),
+          element_tag_(structure_tag_type::int64_tag),
+          int64_values_(data, data+size, int64_allocator_type(allocator)),
+          uint64_values_(uint64_allocator_type(allocator)),
+          double_values_(double_allocator_type(allocator)),
+          elements_(allocator)
+    {
+        build_elements(data, size);
+    }
+
+    json_typed_array(const uint64_t* data, size_t size, const allocator_type& allocator = allocator_type())
+        : container_base<allocator_type>(allocator),
+          element_tag_(structure_tag_type::uint64_tag),
+          int64_values_(int64_allocator_type(allocator)),
+          uint64_values_(data, data+size, uint64_allocator_type(allocator)),
+          double_values_(double_allocator_type(allocator)),
+          elements_(allocator)
+    {
+        build_elements(data, size);
+    }
+
+    json_typed_array(const double* data, size_t size, const allocator_type& allocator = allocator_type())
+        : container_base<allocator_type>(allocator),
+          element_tag_(structure_tag_type::double_tag),
+          int64_values_(int64_allocator_type(allocator)),
+          uint64_values_(uint64_allocator_type(allocator)),
+          double_values_(data, data+size, double_allocator_type(allocator)),
+          elements_(allocator)
+    {
+        build_elements(data, size);
+    }
+
+    json_typed_array(const json_typed_array& val)
+        : container_base<allocator_type>(val.get_allocator()),
+          element_tag_(val.element_tag_),
+          int64_values_(val.int64_values_),
+          uint64_values_(val.uint64_values_),
+          double_values_(val.double_values_),
+          elements_(val.elements_)
+    {
+    }
+
+    json_typed_array(const json_typed_array& val, const allocator_type& allocator)
+        : container_base<allocator_type>(allocator),
+          element_tag_(val.element_tag_),
+          int64_values_(val.int64_values_, int64_allocator_type(allocator)),
+          uint64_values_(val.uint64_values_, uint64_allocator_type(allocator)),
+          double_values_(val.double_values_, double_allocator_type(allocator)),
+          elements_(val.elements_, allocator)
+    {
+    }
+
+    json_typed_array(json_typed_array&& val) noexcept
+        : container_base<allocator_type>(val.get_allocator()),
+          element_tag_(val.element_tag_),
+          int64_values_(std::move(val.int64_values_)),
+          uint64_values_(std::move(val.uint64_values_)),
+          double_values_(std::move(val.double_values_)),
+          elements_(std::move(val.elements_))
+    {
+    }
+
+    json_typed_array& operator=(const json_typed_array&) = delete;
+
+    // int64_tag, uint64_tag or double_tag, or null_tag for an empty array with no element type yet
+    structure_tag_type element_tag() const
+    {
+        return element_tag_;
+    }
+
+    size_t size() const
+    {
+        switch (element_tag_)
+        {
+            case structure_tag_type::int64_tag:
+                return int64_values_.size();
+            case structure_tag_type::uint64_tag:
+                return uint64_values_.size();
+            case structure_tag_type::double_tag:
+                return double_values_.size();
+            default:
+                return 0;
+        }
+    }
+
+    bool empty() const
+    {
+        return size() == 0;
+    }
+
+    size_t capacity() const
+    {
+        switch (element_tag_)
+        {
+            case structure_tag_type::int64_tag:
+                return int64_values_.capacity();
+            case structure_tag_type::uint64_tag:
+                return uint64_values_.capacity();
+            case structure_tag_type::double_tag:
+                return double_values_.capacity();
+            default:
+                return 0;
+        }
+    }
+
+    // The contiguous values, or nullptr if the elements are of another type
+
+    const int64_t* int64_data() const
+    {
+        return element_tag_ == structure_tag_type::int64_tag ? int64_values_.data() : nullptr;
+    }
+
+    const uint64_t* uint64_data() const
+    {
+        return element_tag_ == structure_tag_type::uint64_tag ? uint64_values_.data() : nullptr;
+    }
+
+    const double* double_data() const
+    {
+        return element_tag_ == structure_tag_type::double_tag ? double_values_.data() : nullptr;
+    }
+
+    // The elements as basic_json values
+    const array& elements() const
+    {
+        return elements_;
+    }
+
+    // Moves the elements out as a json_array, after which the typed array is discarded
+    array release_elements()
+    {
+        return std::move(elements_);
+    }
+
+    // Appends val if it is a number of the element type without a semantic tag,
+    // otherwise returns false
+    bool try_push_back(const Json& val)
+    {
+        if (val.semantic_tag() != semantic_tag_type::none)
+        {
+            return false;
+        }
+        structure_tag_type tag = val.structure_tag();
+        if (element_tag_ == structure_tag_type::null_tag)
+        {
+            switch (tag)
+            {
+                case structure_tag_type::int64_tag:
+                case structure_tag_type::uint64_tag:
+                case structure_tag_type::double_tag:
+                    element_tag_ = tag;
+                    break;
+                default:
+                    return false;
+            }
+        }
+        else if (tag != element_tag_)
+        {
+            return false;
+        }
+        switch (tag)
+        {
+            case structure_tag_type::int64_tag:
+                int64_values_.push_back(val.template as_integer<int64_t>());
+                break;
+            case structure_tag_type::uint64_tag:
+                uint64_values_.push_back(val.template as_integer<uint64_t>());
+                break;
+            default:
+                double_values_.push_back(val.as_double());
+                break;
+        }
+        elements_.push_back(val);
+        return true;
+    }
+
+    void reserve(size_t n)
+    {
+        switch (element_tag_)
+        {
+            case structure_tag_type::int64_tag:
+                int64_values_.reserve(n);
+                break;
+            case structure_tag_type::uint64_tag:
+                uint64_values_.reserve(n);
+                break;
+            case structure_tag_type::double_tag:
+                double_values_.reserve(n);
+                break;
+            default:
+                break;
+        }
+        elements_.reserve(n);
+    }
+
+    void clear()
+    {
+        int64_values_.clear();
+        uint64_values_.clear();
+        double_values_.clear();
+        elements_.clear();
+    }
+
+    void shrink_to_fit()
+    {
+        int64_values_.shrink_to_fit();
+        uint64_values_.shrink_to_fit();
+        double_values_.shrink_to_fit();
+        elements_.shrink_to_fit();
+    }
+
+    friend bool operator==(const json_typed_array& lhs, const json_typed_array& rhs)
+    {
+        if (lhs.element_tag_ == rhs.element_tag_)
+        {
+            return lhs.int64_values_ == rhs.int64_values_ &&
+                   lhs.uint64_values_ == rhs.uint64_values_ &&
+                   lhs.double_values_ == rhs.double_values_;
+        }
+        return lhs.elements_ == rhs.elements_;
+    }
+
+    friend bool operator==(const json_typed_array& lhs, const array& rhs)
+    {
+        return lhs.elements_ == rhs;
+    }
+private:
+    template <class T>
+    void build_elements(const T* data, size_t size)
+    {
+        elements_.reserve(size);
+        for (size_t i = 0; i < size; ++i)
+        {
+            elements_.push_back(Json(data[i], semantic_tag_type::none));
+        }
+    }
 };
 
 template <class CharT, class ImplementationPolicy, class Allocator>
@@ -142,8 +418,11 @@ public:
 
     typedef json_object<string_type,basic_json> object;
 
+    typedef json_typed_array<basic_json> typed_array;
+
     typedef typename std::allocator_traits<Allocator>:: template rebind_alloc<array> array_allocator;
     typedef typename std::allocator_traits<Allocator>:: template rebind_alloc<object> object_allocator;
+    typedef typename std::allocator_traits<Allocator>:: template rebind_alloc<typed_array> typed_array_allocator;
 
     typedef typename object::iterator object_iterator;
     typedef typename object::const_iterator const_object_iterator;
@@ -509,6 +788,12 @@ public:
                 create(val.get_allocator(), val);
             }
 
+            array_data(array&& val, semantic_tag_type tag)
+                : data_base(structure_tag_type::array_tag, tag)
+            {
+                create(val.get_allocator(), std::move(val));
+            }
+
             array_data(const array& val, semantic_tag_type tag, const Allocator& a)
                 : data_base(structure_tag_type::array_tag, tag)
             {
@@ -646,9 +931,91 @@ public:
             }
         };
 
+        // typed_array_data
+        class typed_array_data final : public data_base
+        {
+            typedef typename std::allocator_traits<typed_array_allocator>::pointer pointer;
+            pointer ptr_;
+
+            template <typename... Args>
+            void create(typed_array_allocator allocator, Args&& ... args)
+            {
+                typename std::allocator_traits<Allocator>:: template rebind_alloc<typed_array> alloc(allocator);
+                ptr_ = alloc.allocate(1);
+                try
+                {
+                    std::allocator_traits<typed_array_allocator>:: template rebind_traits<typed_array>::construct(alloc, jsoncons::detail::to_plain_pointer(ptr_), std::forward<Args>(args)...);
+                }
+                catch (...)
+                {
+                    alloc.deallocate(ptr_,1);
+                    throw;
+                }
+            }
+        public:
+            typed_array_data(const typed_array& val, semantic_tag_type tag)
+                : data_base(structure_tag_type::typed_array_tag, tag)
+            {
+                create(val.get_allocator(), val);
+            }
+
+            typed_array_data(typed_array&& val, semantic_tag_type tag)
+                : data_base(structure_tag_type::typed_array_tag, tag)
+            {
+                create(val.get_allocator(), std::move(val));
+            }
+
+            typed_array_data(const typed_array_data& val)
+                : data_base(val.type())
+            {
+                create(val.ptr_->get_allocator(), *(val.ptr_));
+            }
+
+            typed_array_data(typed_array_data&& val)
+                : data_base(val.type()), ptr_(nullptr)
+            {
+                std::swap(val.ptr_, ptr_);
+            }
+
+            typed_array_data(const typed_array_data& val, const Allocator& a)
+                : data_base(val.type())
+            {
+                create(typed_array_allocator(a), *(val.ptr_), a);
+            }
+            ~typed_array_data()
+            {
+                if (ptr_ != nullptr)
+                {
+                    typename std::allocator_traits<typed_array_allocator>:: template rebind_alloc<typed_array> alloc(ptr_->get_allocator());
+                    std::allocator_traits<typed_array_allocator>:: template rebind_traits<typed_array>::destroy(alloc, jsoncons::detail::to_plain_pointer(ptr_));
+                    alloc.deallocate(ptr_,1);
+                }
+            }
+
+            allocator_type get_allocator() const
+            {
+                return ptr_->get_allocator();
+            }
+
+            void swap(typed_array_data& val)
+            {
+                std::swap(val.ptr_,ptr_);
+            }
+
+            typed_array& value()
+            {
+                return *ptr_;
+            }
+
+            const typed_array& value() const
+            {
+                return *ptr_;
+            }
+        };
+
     private:
-        static const size_t data_size = static_max<sizeof(uint64_data),sizeof(double_data),sizeof(short_string_data), sizeof(long_string_data), sizeof(array_data), sizeof(object_data)>::value;
-        static const size_t data_align = static_max<alignof(uint64_data),alignof(double_data),alignof(short_string_data),alignof(long_string_data),alignof(array_data),alignof(object_data)>::value;
+        static const size_t data_size = static_max<sizeof(uint64_data),sizeof(double_data),sizeof(short_string_data), sizeof(long_string_data), sizeof(array_data), sizeof(object_data), sizeof(typed_array_data)>::value;
+        static const size_t data_align = static_max<alignof(uint64_data),alignof(double_data),alignof(short_string_data),alignof(long_string_data),alignof(array_data),alignof(object_data),alignof(typed_array_data)>::value;
 
         typedef typename std::aligned_storage<data_size,data_align>::type data_t;
 
@@ -757,10 +1124,22 @@ public:
         {
             new(reinterpret_cast<void*>(&data_))array_data(val, tag);
         }
+        variant(array&& val, semantic_tag_type tag)
+        {
+            new(reinterpret_cast<void*>(&data_))array_data(std::move(val), tag);
+        }
         variant(const array& val, semantic_tag_type tag, const Allocator& alloc)
         {
             new(reinterpret_cast<void*>(&data_))array_data(val, tag, alloc);
         }
+        variant(const typed_array& val, semantic_tag_type tag)
+        {
+            new(reinterpret_cast<void*>(&data_))typed_array_data(val, tag);
+        }
+        variant(typed_array&& val, semantic_tag_type tag)
+        {
+            new(reinterpret_cast<void*>(&data_))typed_array_data(std::move(val), tag);
+        }
 
         variant(const variant& val)
         {
@@ -804,6 +1183,9 @@ public:
                 case structure_tag_type::object_tag:
                     reinterpret_cast<object_data*>(&data_)->~object_data();
                     break;
+                case structure_tag_type::typed_array_tag:
+                    reinterpret_cast<typed_array_data*>(&data_)->~typed_array_data();
+                    break;
                 default:
                     break;
             }
@@ -849,6 +1231,9 @@ public:
                 case structure_tag_type::object_tag:
                     new(reinterpret_cast<void*>(&data_))object_data(*(val.object_data_cast()));
                     break;
+                case structure_tag_type::typed_array_tag:
+                    new(reinterpret_cast<void*>(&data_))typed_array_data(*(val.typed_array_data_cast()));
+                    break;
                 default:
                     JSONCONS_UNREACHABLE();
                     break;
@@ -951,6 +1336,16 @@ public:
             return reinterpret_cast<const array_data*>(&data_);
         }
 
+        typed_array_data* typed_array_data_cast()
+        {
+            return reinterpret_cast<typed_array_data*>(&data_);
+        }
+
+        const typed_array_data* typed_array_data_cast() const
+        {
+            return reinterpret_cast<const typed_array_data*>(&data_);
+        }
+
         size_t size() const
         {
             switch (structure_tag())
@@ -959,6 +1354,8 @@ public:
                 return array_data_cast()->value().size();
             case structure_tag_type::object_tag:
                 return object_data_cast()->value().size();
+            case structure_tag_type::typed_array_tag:
+                return typed_array_data_cast()->value().size();
             default:
                 return 0;
             }
@@ -1139,6 +1536,19 @@ public:
                 {
                 case structure_tag_type::array_tag:
                     return array_data_cast()->value() == rhs.array_data_cast()->value();
+                case structure_tag_type::typed_array_tag:
+                    return rhs.typed_array_data_cast()->value() == array_data_cast()->value();
+                default:
+                    return false;
+                }
+                break;
+            case structure_tag_type::typed_array_tag:
+                switch (rhs.structure_tag())
+                {
+                case structure_tag_type::array_tag:
+                    return typed_array_data_cast()->value() == rhs.array_data_cast()->value();
+                case structure_tag_type::typed_array_tag:
+                    return typed_array_data_cast()->value() == rhs.typed_array_data_cast()->value();
                 default:
                     return false;
                 }
@@ -1222,6 +1632,9 @@ public:
             case structure_tag_type::object_tag:
                 new(reinterpret_cast<void*>(&(other.data_)))object_data(std::move(*object_data_cast()));
                 break;
+            case structure_tag_type::typed_array_tag:
+                new(reinterpret_cast<void*>(&(other.data_)))typed_array_data(std::move(*typed_array_data_cast()));
+                break;
             default:
                 JSONCONS_UNREACHABLE();
                 break;
@@ -1240,6 +1653,9 @@ public:
             case structure_tag_type::object_tag:
                 new(reinterpret_cast<void*>(&(data_)))object_data(std::move(*temp.object_data_cast()));
                 break;
+            case structure_tag_type::typed_array_tag:
+                new(reinterpret_cast<void*>(&(data_)))typed_array_data(std::move(*temp.typed_array_data_cast()));
+                break;
             default:
                 std::swap(data_,temp.data_);
                 break;
@@ -1284,6 +1700,9 @@ public:
             case structure_tag_type::array_tag:
                 new(reinterpret_cast<void*>(&data_))array_data(*(val.array_data_cast()));
                 break;
+            case structure_tag_type::typed_array_tag:
+                new(reinterpret_cast<void*>(&data_))typed_array_data(*(val.typed_array_data_cast()));
+                break;
             default:
                 break;
             }
@@ -1314,6 +1733,9 @@ public:
             case structure_tag_type::object_tag:
                 new(reinterpret_cast<void*>(&data_))object_data(*(val.object_data_cast()),a);
                 break;
+            case structure_tag_type::typed_array_tag:
+                new(reinterpret_cast<void*>(&data_))typed_array_data(*(val.typed_array_data_cast()),a);
+                break;
             default:
                 break;
             }
@@ -1356,6 +1778,12 @@ public:
                     new(reinterpret_cast<void*>(&val.data_))null_data();
                 }
                 break;
+            case structure_tag_type::typed_array_tag:
+                {
+                    new(reinterpret_cast<void*>(&data_))typed_array_data(std::move(*val.typed_array_data_cast()));
+                    new(reinterpret_cast<void*>(&val.data_))null_data();
+                }
+                break;
             default:
                 JSONCONS_UNREACHABLE();
                 break;
@@ -1428,6 +1856,18 @@ public:
                     }
                 }
                 break;
+            case structure_tag_type::typed_array_tag:
+                {
+                    if (a == val.typed_array_data_cast()->get_allocator())
+                    {
+                        Init_rv_(std::forward<variant>(val), a, std::true_type());
+                    }
+                    else
+                    {
+                        Init_(val,a);
+                    }
+                }
+                break;
             default:
                 break;
             }
@@ -1622,6 +2062,16 @@ public:
             return evaluate().is_array();
         }
 
+        bool is_typed_array() const noexcept
+        {
+            return evaluate().is_typed_array();
+        }
+
+        const typed_array& typed_array_value() const
+        {
+            return evaluate().typed_array_value();
+        }
+
         bool is_int64() const noexcept
         {
             return evaluate().is_int64();
@@ -2358,7 +2808,7 @@ public:
 
     static basic_json parse(std::basic_istream<char_type>& is, const basic_json_options<CharT>& options, parse_error_handler& err_handler)
     {
-        json_decoder<basic_json<CharT,ImplementationPolicy,Allocator>> handler;
+        json_decoder<basic_json<CharT,ImplementationPolicy,Allocator>> handler(options);
         basic_json_reader<char_type,text_stream_source<char_type>> reader(is, handler, options, err_handler);
         reader.read_next();
         reader.check_done();
@@ -2377,7 +2827,7 @@ public:
 
     static basic_json parse(const string_view_type& s, const basic_json_options<CharT>& options, parse_error_handler& err_handler)
     {
-        json_decoder<basic_json> decoder;
+        json_decoder<basic_json> decoder(options);
         basic_json_parser<char_type> parser(options,err_handler);
 
         auto result = unicons::skip_bom(s.begin(), s.end());
@@ -2512,6 +2962,16 @@ public:
     {
     }
 
+    basic_json(const typed_array& val, semantic_tag_type tag = semantic_tag_type::none)
+        : var_(val, tag)
+    {
+    }
+
+    basic_json(typed_array&& other, semantic_tag_type tag = semantic_tag_type::none)
+        : var_(std::move(other), tag)
+    {
+    }
+
     basic_json(const object& other, semantic_tag_type tag = semantic_tag_type::none)
         : var_(other, tag)
     {
@@ -2730,6 +3190,8 @@ public:
             return object_value().size();
         case structure_tag_type::array_tag:
             return array_value().size();
+        case structure_tag_type::typed_array_tag:
+            return var_.typed_array_data_cast()->value().size();
         default:
             return 0;
         }
@@ -3061,7 +3523,12 @@ public:
 
     bool is_array() const noexcept
     {
-        return var_.structure_tag() == structure_tag_type::array_tag;
+        return var_.structure_tag() == structure_tag_type::array_tag || var_.structure_tag() == structure_tag_type::typed_array_tag;
+    }
+
+    bool is_typed_array() const noexcept
+    {
+        return var_.structure_tag() == structure_tag_type::typed_array_tag;
     }
 
     bool is_int64() const noexcept
@@ -3094,6 +3561,8 @@ public:
             return var_.string_data_cast()->length() == 0;
         case structure_tag_type::array_tag:
             return array_value().size() == 0;
+        case structure_tag_type::typed_array_tag:
+            return var_.typed_array_data_cast()->value().empty();
         case structure_tag_type::empty_object_tag:
             return true;
         case structure_tag_type::object_tag:
@@ -3109,6 +3578,8 @@ public:
         {
         case structure_tag_type::array_tag:
             return array_value().capacity();
+        case structure_tag_type::typed_array_tag:
+            return var_.typed_array_data_cast()->value().capacity();
         case structure_tag_type::object_tag:
             return object_value().capacity();
         default:
@@ -3130,6 +3601,9 @@ public:
         case structure_tag_type::array_tag:
             array_value().reserve(n);
             break;
+        case structure_tag_type::typed_array_tag:
+            var_.typed_array_data_cast()->value().reserve(n);
+            break;
         case structure_tag_type::empty_object_tag:
         {
             create_object_implicitly();
@@ -3151,6 +3625,7 @@ public:
         switch (var_.structure_tag())
         {
         case structure_tag_type::array_tag:
+        case structure_tag_type::typed_array_tag:
             array_value().resize(n);
             break;
         default:
@@ -3164,6 +3639,7 @@ public:
         switch (var_.structure_tag())
         {
         case structure_tag_type::array_tag:
+        case structure_tag_type::typed_array_tag:
             array_value().resize(n, val);
             break;
         default:
@@ -3518,6 +3994,7 @@ public:
         switch (var_.structure_tag())
         {
         case structure_tag_type::array_tag:
+        case structure_tag_type::typed_array_tag:
             if (i >= array_value().size())
             {
                 JSONCONS_THROW(json_exception_impl<std::out_of_range>("Invalid array subscript"));
@@ -3535,6 +4012,7 @@ public:
         switch (var_.structure_tag())
         {
         case structure_tag_type::array_tag:
+        case structure_tag_type::typed_array_tag:
             if (i >= array_value().size())
             {
                 JSONCONS_THROW(json_exception_impl<std::out_of_range>("Invalid array subscript"));
@@ -3642,6 +4120,9 @@ public:
         case structure_tag_type::array_tag:
             array_value().shrink_to_fit();
             break;
+        case structure_tag_type::typed_array_tag:
+            var_.typed_array_data_cast()->value().shrink_to_fit();
+            break;
         case structure_tag_type::object_tag:
             object_value().shrink_to_fit();
             break;
@@ -3657,6 +4138,9 @@ public:
         case structure_tag_type::array_tag:
             array_value().clear();
             break;
+        case structure_tag_type::typed_array_tag:
+            var_.typed_array_data_cast()->value().clear();
+            break;
         case structure_tag_type::object_tag:
             object_value().clear();
             break;
@@ -3702,6 +4186,13 @@ public:
         case structure_tag_type::array_tag:
             array_value().erase(pos);
             break;
+        case structure_tag_type::typed_array_tag:
+            {
+                size_t index = typed_array_index(pos);
+                array& a = array_value();
+                a.erase(a.begin() + index);
+            }
+            break;
         default:
             JSONCONS_THROW(json_exception_impl<std::runtime_error>("Not an array"));
             break;
@@ -3715,6 +4206,14 @@ public:
         case structure_tag_type::array_tag:
             array_value().erase(first, last);
             break;
+        case structure_tag_type::typed_array_tag:
+            {
+                size_t first_index = typed_array_index(first);
+                size_t last_index = typed_array_index(last);
+                array& a = array_value();
+                a.erase(a.begin() + first_index, a.begin() + last_index);
+            }
+            break;
         default:
             JSONCONS_THROW(json_exception_impl<std::runtime_error>("Not an array"));
             break;
@@ -3946,6 +4445,13 @@ public:
         case structure_tag_type::array_tag:
             return array_value().insert(pos, std::forward<T>(val));
             break;
+        case structure_tag_type::typed_array_tag:
+            {
+                size_t index = typed_array_index(pos);
+                array& a = array_value();
+                return a.insert(a.begin() + index, std::forward<T>(val));
+            }
+            break;
         default:
             {
                 JSONCONS_THROW(json_exception_impl<std::runtime_error>("Attempting to insert into a value that is not an array"));
@@ -3961,6 +4467,13 @@ public:
         case structure_tag_type::array_tag:
             return array_value().insert(pos, first, last);
             break;
+        case structure_tag_type::typed_array_tag:
+            {
+                size_t index = typed_array_index(pos);
+                array& a = array_value();
+                return a.insert(a.begin() + index, first, last);
+            }
+            break;
         default:
             {
                 JSONCONS_THROW(json_exception_impl<std::runtime_error>("Attempting to insert into a value that is not an array"));
@@ -4008,6 +4521,13 @@ public:
         case structure_tag_type::array_tag:
             return array_value().emplace(pos, std::forward<Args>(args)...);
             break;
+        case structure_tag_type::typed_array_tag:
+            {
+                size_t index = typed_array_index(pos);
+                array& a = array_value();
+                return a.emplace(a.begin() + index, std::forward<Args>(args)...);
+            }
+            break;
         default:
             {
                 JSONCONS_THROW(json_exception_impl<std::runtime_error>("Attempting to insert into a value that is not an array"));
@@ -4021,6 +4541,7 @@ public:
         switch (var_.structure_tag())
         {
         case structure_tag_type::array_tag:
+        case structure_tag_type::typed_array_tag:
             return array_value().emplace_back(std::forward<Args>(args)...);
         default:
             {
@@ -4057,6 +4578,15 @@ public:
         case structure_tag_type::array_tag:
             array_value().push_back(std::forward<T>(val));
             break;
+        case structure_tag_type::typed_array_tag:
+            {
+                basic_json j(std::forward<T>(val));
+                if (!var_.typed_array_data_cast()->value().try_push_back(j))
+                {
+                    array_value().push_back(std::move(j));
+                }
+            }
+            break;
         default:
             {
                 JSONCONS_THROW(json_exception_impl<std::runtime_error>("Attempting to insert into a value that is not an array"));
@@ -4331,6 +4861,7 @@ public:
         switch (var_.structure_tag())
         {
         case structure_tag_type::array_tag:
+        case structure_tag_type::typed_array_tag:
             array_value().remove_range(from_index, to_index);
             break;
         default:
@@ -4447,6 +4978,7 @@ public:
         switch (var_.structure_tag())
         {
         case structure_tag_type::array_tag:
+        case structure_tag_type::typed_array_tag:
             return range<array_iterator>(array_value().begin(),array_value().end());
         default:
             JSONCONS_THROW(json_exception_impl<std::runtime_error>("Not an array"));
@@ -4458,16 +4990,25 @@ public:
         switch (var_.structure_tag())
         {
         case structure_tag_type::array_tag:
+        case structure_tag_type::typed_array_tag:
             return range<const_array_iterator>(array_value().begin(),array_value().end());
         default:
             JSONCONS_THROW(json_exception_impl<std::runtime_error>("Not an array"));
         }
     }
 
+    // A typed array is converted to a json_array first, since its elements may be modified
     array& array_value() 
     {
         switch (var_.structure_tag())
         {
+        case structure_tag_type::typed_array_tag:
+            {
+                semantic_tag_type tag = var_.semantic_tag();
+                array a = var_.typed_array_data_cast()->value().release_elements();
+                var_ = variant(std::move(a), tag);
+            }
+            JSONCONS_FALLTHROUGH;
         case structure_tag_type::array_tag:
             return var_.array_data_cast()->value();
         default:
@@ -4482,12 +5023,26 @@ public:
         {
         case structure_tag_type::array_tag:
             return var_.array_data_cast()->value();
+        case structure_tag_type::typed_array_tag:
+            return var_.typed_array_data_cast()->value().elements();
         default:
             JSONCONS_THROW(json_exception_impl<std::runtime_error>("Bad array cast"));
             break;
         }
     }
 
+    const typed_array& typed_array_value() const
+    {
+        switch (var_.structure_tag())
+        {
+        case structure_tag_type::typed_array_tag:
+            return var_.typed_array_data_cast()->value();
+        default:
+            JSONCONS_THROW(json_exception_impl<std::runtime_error>("Bad typed array cast"));
+            break;
+        }
+    }
+
     object& object_value()
     {
         switch (var_.structure_tag())
@@ -4520,6 +5075,13 @@ public:
 
 private:
 
+    // The index of pos in the elements of a typed array, taken before converting it 
+    // to a json_array for an insert or erase
+    size_t typed_array_index(const_array_iterator pos) const
+    {
+        return static_cast<size_t>(pos - var_.typed_array_data_cast()->value().elements().begin());
+    }
+
     void dump_noflush(basic_json_content_handler<char_type>& handler) const
     {
         switch (var_.structure_tag())
@@ -4575,6 +5137,27 @@ private:
                     handler.end_array();
                 }
                 break;
+            case structure_tag_type::typed_array_tag:
+                {
+                    const typed_array& values = var_.typed_array_data_cast()->value();
+                    switch (values.element_tag())
+                    {
+                        case structure_tag_type::int64_tag:
+                            handler.typed_array(values.int64_data(), values.size(), var_.semantic_tag());
+                            break;
+                        case structure_tag_type::uint64_tag:
+                            handler.typed_array(values.uint64_data(), values.size(), var_.semantic_tag());
+                            break;
+                        case structure_tag_type::double_tag:
+                            handler.typed_array(values.double_data(), values.size(), var_.semantic_tag());
+                            break;
+                        default:
+                            handler.begin_array(0, var_.semantic_tag());
+                            handler.end_array();
+                            break;
+                    }
+                }
+                break;
             default:
                 break;
         }
@@ -4624,6 +5207,18 @@ std::basic_istream<typename Json::char_type>& operator>>(std::basic_istream<type
     return is;
 }
 
+namespace detail {
+
+template <class T>
+struct is_basic_json_class : std::false_type
+{};
+
+template <class CharT, class ImplementationPolicy, class Allocator>
+struct is_basic_json_class<basic_json<CharT,ImplementationPolicy,Allocator>> : std::true_type
+{};
+
+}
+
 typedef basic_json<char,sorted_policy,std::allocator<char>> json;
 typedef basic_json<wchar_t,sorted_policy,std::allocator<wchar_t>> wjson;
 typedef basic_json<char, preserve_order_policy, std::allocator<char>> ojson;
@@ -0,0 +1,161 @@
+// Copyright 2018 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_BINARY_PULL_READER_HPP
+#define JSONCONS_BINARY_PULL_READER_HPP
+
+#include <system_error>
+#include <utility> // std::move
+#include <jsoncons/json_exception.hpp>
+#include <jsoncons/staj_reader.hpp>
+#include <jsoncons/json_pull_reader.hpp>
+
+namespace jsoncons {
+
+// Pull reader over a binary format parser, such as basic_cbor_parser<Source>. The parser
+// is restarted for each event, and reports it to a basic_staj_event_handler.
+
+template <class Parser>
+class basic_binary_pull_reader : public basic_staj_reader<char>
+{
+public:
+    typedef typename Parser::source_type source_type;
+private:
+    Parser parser_;
+    basic_staj_event_handler<char> event_handler_;
+    default_basic_staj_filter<char> default_filter_;
+    basic_staj_filter<char>& filter_;
+
+    // Noncopyable and nonmoveable
+    basic_binary_pull_reader(const basic_binary_pull_reader&) = delete;
+    basic_binary_pull_reader& operator=(const basic_binary_pull_reader&) = delete;
+public:
+    basic_binary_pull_reader(source_type source)
+        : basic_binary_pull_reader(std::move(source), default_filter_)
+    {
+    }
+
+    basic_binary_pull_reader(source_type source,
+                             basic_staj_filter<char>& filter)
+       : parser_(std::move(source)),
+         filter_(filter)
+    {
+        if (!done())
+        {
+            next();
+        }
+    }
+
+    basic_binary_pull_reader(source_type source,
+                             std::error_code& ec)
+        : basic_binary_pull_reader(std::move(source), default_filter_, ec)
+    {
+    }
+
+    basic_binary_pull_reader(source_type source,
+                             basic_staj_filter<char>& filter,
+                             std::error_code& ec)
+       : parser_(std::move(source)),
+         filter_(filter)
+    {
+        if (!done())
+        {
+            next(ec);
+        }
+    }
+
+    bool done() const override
+    {
+        return parser_.done();
+    }
+
+    const staj_event& current() const override
+    {
+        return event_handler_.event();
+    }
+
+    void accept(json_content_handler& handler) override
+    {
+        std::error_code ec;
+        accept(handler, ec);
+        if (ec)
+        {
+            throw serialization_error(ec,parser_.line_number(),parser_.column_number());
+        }
+    }
+
+    void accept(json_content_handler& handler,
+                std::error_code& ec) override
+    {
+        size_t depth = 0;
+        for (;;)
+        {
+            switch (event_handler_.event().event_type())
+            {
+                case staj_event_type::begin_array:
+                case staj_event_type::begin_object:
+                    ++depth;
+                    break;
+                case staj_event_type::end_array:
+                case staj_event_type::end_object:
+                    --depth;
+                    break;
+                default:
+                    break;
+            }
+            jsoncons::detail::send_event(event_handler_.event(), handler, parser_);
+            if (depth == 0 || done())
+            {
+                return;
+            }
+            read_next(ec);
+            if (ec)
+            {
+                return;
+            }
+        }
+    }
+
+    void next() override
+    {
+        std::error_code ec;
+        next(ec);
+        if (ec)
+        {
+            throw serialization_error(ec,parser_.line_number(),parser_.column_number());
+        }
+    }
+
+    void next(std::error_code& ec) override
+    {
+        do
+        {
+            read_next(ec);
+        }
+        while (!ec && !done() && !filter_.accept(event_handler_.event(), parser_));
+    }
+
+    const serializing_context& context() const override
+    {
+        return parser_;
+    }
+private:
+    void read_next(std::error_code& ec)
+    {
+        if (event_handler_.in_typed_array())
+        {
+            event_handler_.advance_typed_array();
+            return;
+        }
+        parser_.restart();
+        parser_.parse(event_handler_, ec);
+    }
+};
+
+}
+
+#endif
+
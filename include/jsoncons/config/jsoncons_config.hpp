@@ -70,8 +70,28 @@
 #  endif // defined(_MSC_VER)
 #endif // !defined(JSONCONS_HAS_STRING_VIEW)
 
+#if !defined(JSONCONS_HAS_OPTIONAL)
+#  if (__cplusplus >= 201703) || (defined(_MSVC_LANG) && _MSVC_LANG >= 201703)
+#   if defined(__has_include)
+#    if __has_include(<optional>)
+#     define JSONCONS_HAS_OPTIONAL 1
+#    endif // __has_include(<optional>)
+#   endif // defined(__has_include)
+#  endif // (__cplusplus >= 201703)
+#endif // !defined(JSONCONS_HAS_OPTIONAL)
+
 #define JSONCONS_NO_TO_CHARS
 
+// Define JSONCONS_NO_SIMD to disable the vectorized scanning paths
+#if !defined(JSONCONS_NO_SIMD)
+#  if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#    define JSONCONS_HAS_SSE2 1
+#  endif
+#  if defined(__AVX2__)
+#    define JSONCONS_HAS_AVX2 1
+#  endif
+#endif // !defined(JSONCONS_NO_SIMD)
+
 #if defined(ANDROID) || defined(__ANDROID__)
 #define JSONCONS_HAS_STRTOLD_L
 #if __ANDROID_API__ >= 21
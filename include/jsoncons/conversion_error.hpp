@@ -0,0 +1,63 @@
+// Copyright 2013 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_CONVERSION_ERROR_HPP
+#define JSONCONS_CONVERSION_ERROR_HPP
+
+#include <system_error>
+#include <jsoncons/config/jsoncons_config.hpp>
+
+namespace jsoncons {
+
+    enum class conversion_errc
+    {
+        ok = 0,
+        expected_object = 1
+    };
+
+class conversion_error_category_impl
+   : public std::error_category
+{
+public:
+    const char* name() const noexcept override
+    {
+        return "jsoncons/conversion";
+    }
+    std::string message(int ev) const override
+    {
+        switch (static_cast<conversion_errc>(ev))
+        {
+        case conversion_errc::expected_object:
+            return "Expected a JSON object";
+       default:
+            return "Unknown conversion error";
+        }
+    }
+};
+
+inline
+const std::error_category& conversion_error_category()
+{
+  static conversion_error_category_impl instance;
+  return instance;
+}
+
+inline 
+std::error_code make_error_code(conversion_errc result)
+{
+    return std::error_code(static_cast<int>(result),conversion_error_category());
+}
+
+}
+
+namespace std {
+    template<>
+    struct is_error_code_enum<jsoncons::conversion_errc> : public true_type
+    {
+    };
+}
+
+#endif
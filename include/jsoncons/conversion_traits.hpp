@@ -11,6 +11,7 @@
 #include <tuple>
 #include <array>
 #include <memory>
+#include <vector>
 #include <type_traits> // std::enable_if
 #include <jsoncons/json_content_handler.hpp>
 #include <jsoncons/json_decoder.hpp>
@@ -20,6 +21,10 @@
 #include <jsoncons/jsoncons_utilities.hpp>
 #include <jsoncons/json_type_traits.hpp>
 #include <jsoncons/staj_reader.hpp>
+#include <jsoncons/conversion_error.hpp>
+#if defined(JSONCONS_HAS_OPTIONAL)
+#include <optional>
+#endif
 
 namespace jsoncons {
 
@@ -66,8 +71,140 @@ struct conversion_traits
     }
 };
 
+namespace detail {
+
+// Writes a contiguous sequence of numbers with one typed_array call
+
+template <class CharT>
+void encode_typed_array(const int64_t* data, size_t size, basic_json_content_handler<CharT>& writer)
+{
+    writer.typed_array(data, size);
+}
+
+template <class CharT>
+void encode_typed_array(const uint64_t* data, size_t size, basic_json_content_handler<CharT>& writer)
+{
+    writer.typed_array(data, size);
+}
+
+template <class CharT>
+void encode_typed_array(const double* data, size_t size, basic_json_content_handler<CharT>& writer)
+{
+    writer.typed_array(data, size);
+}
+
+template <class T, class CharT>
+typename std::enable_if<!std::is_same<T,int64_t>::value && !std::is_same<T,uint64_t>::value && !std::is_same<T,double>::value>::type
+encode_typed_array(const T* data, size_t size, basic_json_content_handler<CharT>& writer)
+{
+    typedef typename std::conditional<is_integer_like<T>::value,int64_t,
+        typename std::conditional<is_uinteger_like<T>::value,uint64_t,double>::type>::type value_type;
+    std::vector<value_type> v(data, data+size);
+    writer.typed_array(v.data(), v.size());
+}
+
+}
+
 // specializations
 
+// integer like
+
+template <class T>
+struct conversion_traits<T,
+    typename std::enable_if<jsoncons::detail::is_integer_like<T>::value
+>::type>
+{
+    template <class CharT>
+    static T decode(basic_staj_reader<CharT>& reader, std::error_code&)
+    {
+        return reader.current().template as<T>();
+    }
+
+    template <class CharT>
+    static void encode(const T& val, basic_json_content_handler<CharT>& writer)
+    {
+        writer.int64_value(static_cast<int64_t>(val));
+    }
+};
+
+// unsigned integer like
+
+template <class T>
+struct conversion_traits<T,
+    typename std::enable_if<jsoncons::detail::is_uinteger_like<T>::value
+>::type>
+{
+    template <class CharT>
+    static T decode(basic_staj_reader<CharT>& reader, std::error_code&)
+    {
+        return reader.current().template as<T>();
+    }
+
+    template <class CharT>
+    static void encode(const T& val, basic_json_content_handler<CharT>& writer)
+    {
+        writer.uint64_value(static_cast<uint64_t>(val));
+    }
+};
+
+// floating point like
+
+template <class T>
+struct conversion_traits<T,
+    typename std::enable_if<jsoncons::detail::is_floating_point_like<T>::value
+>::type>
+{
+    template <class CharT>
+    static T decode(basic_staj_reader<CharT>& reader, std::error_code&)
+    {
+        return reader.current().template as<T>();
+    }
+
+    template <class CharT>
+    static void encode(const T& val, basic_json_content_handler<CharT>& writer)
+    {
+        writer.double_value(static_cast<double>(val));
+    }
+};
+
+// bool
+
+template <>
+struct conversion_traits<bool>
+{
+    template <class CharT>
+    static bool decode(basic_staj_reader<CharT>& reader, std::error_code&)
+    {
+        return reader.current().template as<bool>();
+    }
+
+    template <class CharT>
+    static void encode(bool val, basic_json_content_handler<CharT>& writer)
+    {
+        writer.bool_value(val);
+    }
+};
+
+// string like
+
+template <class T>
+struct conversion_traits<T,
+    typename std::enable_if<jsoncons::detail::is_string_like<T>::value
+>::type>
+{
+    template <class CharT>
+    static T decode(basic_staj_reader<CharT>& reader, std::error_code&)
+    {
+        return reader.current().template as<T>();
+    }
+
+    template <class CharT>
+    static void encode(const T& val, basic_json_content_handler<CharT>& writer)
+    {
+        writer.string_value(basic_string_view<CharT>(val.data(),val.length()));
+    }
+};
+
 // vector like
 
 template <class T>
@@ -81,19 +218,26 @@ struct conversion_traits<T,
     static T decode(basic_staj_reader<CharT>& reader, std::error_code& ec)
     {
         T v;
-        basic_staj_array_iterator<CharT,value_type> end;
-        basic_staj_array_iterator<CharT,value_type> it(reader, ec);
-
-        while (it != end && !ec)
+        if (reader.current().event_type() != staj_event_type::begin_array)
+        {
+            return v;
+        }
+        reader.next(ec);
+        while (!ec && !reader.done() && reader.current().event_type() != staj_event_type::end_array)
         {
-            v.push_back(*it);
-            it.increment(ec);
+            v.push_back(conversion_traits<value_type>::decode(reader, ec));
+            if (ec)
+            {
+                break;
+            }
+            reader.next(ec);
         }
         return v;
     }
 
-    template <class CharT>
-    static void encode(const T& val, basic_json_content_handler<CharT>& writer)
+    template <class CharT, class U = T>
+    static typename std::enable_if<!jsoncons::detail::is_typed_array_like<U>::value>::type
+    encode(const T& val, basic_json_content_handler<CharT>& writer)
     {
         writer.begin_array();
         for (auto it = std::begin(val); it != std::end(val); ++it)
@@ -103,6 +247,14 @@ struct conversion_traits<T,
         writer.end_array();
         writer.flush();
     }
+
+    template <class CharT, class U = T>
+    static typename std::enable_if<jsoncons::detail::is_typed_array_like<U>::value>::type
+    encode(const T& val, basic_json_content_handler<CharT>& writer)
+    {
+        jsoncons::detail::encode_typed_array(val.data(), val.size(), writer);
+        writer.flush();
+    }
 };
 // std::array
 
@@ -116,19 +268,41 @@ struct conversion_traits<std::array<T,N>>
     {
         std::array<T,N> v;
         v.fill(T{});
-        basic_staj_array_iterator<CharT,value_type> end;
-        basic_staj_array_iterator<CharT,value_type> it(reader, ec);
-
-        for (size_t i = 0; it != end && i < N && !ec; ++i)
+        if (reader.current().event_type() != staj_event_type::begin_array)
+        {
+            return v;
+        }
+        reader.next(ec);
+        for (size_t i = 0; !ec && !reader.done() && reader.current().event_type() != staj_event_type::end_array; ++i)
         {
-            v[i] = *it;
-            it.increment(ec);
+            if (i < N)
+            {
+                v[i] = conversion_traits<value_type>::decode(reader, ec);
+            }
+            else
+            {
+                reader.skip(ec);
+            }
+            if (ec)
+            {
+                break;
+            }
+            reader.next(ec);
         }
         return v;
     }
 
-    template <class CharT>
-    static void encode(const std::array<T, N>& val, basic_json_content_handler<CharT>& writer)
+    template <class CharT, class U = T>
+    static typename std::enable_if<jsoncons::detail::is_typed_array_like<std::array<U,N>>::value>::type
+    encode(const std::array<T, N>& val, basic_json_content_handler<CharT>& writer)
+    {
+        jsoncons::detail::encode_typed_array(val.data(), val.size(), writer);
+        writer.flush();
+    }
+
+    template <class CharT, class U = T>
+    static typename std::enable_if<!jsoncons::detail::is_typed_array_like<std::array<U,N>>::value>::type
+    encode(const std::array<T, N>& val, basic_json_content_handler<CharT>& writer)
     {
         writer.begin_array();
         for (auto it = std::begin(val); it != std::end(val); ++it)
@@ -154,15 +328,27 @@ struct conversion_traits<T,
     template <class CharT>
     static T decode(basic_staj_reader<CharT>& reader, std::error_code& ec)
     {
-        
         T m;
-        basic_staj_object_iterator<CharT,mapped_type> end;
-        basic_staj_object_iterator<CharT,mapped_type> it(reader, ec);
-
-        while (it != end && !ec)
+        if (reader.current().event_type() != staj_event_type::begin_object)
+        {
+            return m;
+        }
+        reader.next(ec);
+        while (!ec && !reader.done() && reader.current().event_type() != staj_event_type::end_object)
         {
-            m.emplace(it->first,it->second);
-            it.increment(ec);
+            auto key = reader.current().template as<std::basic_string<CharT>>();
+            reader.next(ec);
+            if (ec)
+            {
+                break;
+            }
+            auto value = conversion_traits<mapped_type>::decode(reader, ec);
+            if (ec)
+            {
+                break;
+            }
+            m.emplace(std::move(key), std::move(value));
+            reader.next(ec);
         }
         return m;
     }
@@ -181,6 +367,148 @@ struct conversion_traits<T,
     }
 };
 
+#if defined(JSONCONS_HAS_OPTIONAL)
+
+// std::optional
+
+template <class T>
+struct conversion_traits<std::optional<T>>
+{
+    template <class CharT>
+    static std::optional<T> decode(basic_staj_reader<CharT>& reader, std::error_code& ec)
+    {
+        if (reader.current().event_type() == staj_event_type::null_value)
+        {
+            return std::optional<T>();
+        }
+        return std::optional<T>(conversion_traits<T>::decode(reader, ec));
+    }
+
+    template <class CharT>
+    static void encode(const std::optional<T>& val, basic_json_content_handler<CharT>& writer)
+    {
+        if (val.has_value())
+        {
+            conversion_traits<T>::encode(*val, writer);
+        }
+        else
+        {
+            writer.null_value();
+        }
+    }
+};
+
+#endif
+
+// member traits
+
+namespace detail {
+
+template <class CharT>
+class member_decoder
+{
+    basic_staj_reader<CharT>& reader_;
+    std::error_code& ec_;
+public:
+    member_decoder(basic_staj_reader<CharT>& reader, std::error_code& ec)
+        : reader_(reader), ec_(ec)
+    {
+    }
+
+    template <class T>
+    void operator()(T& val)
+    {
+        val = conversion_traits<T>::decode(reader_, ec_);
+    }
+};
+
+template <class CharT>
+class member_encoder
+{
+    basic_json_content_handler<CharT>& writer_;
+    const member_name& name_;
+public:
+    member_encoder(basic_json_content_handler<CharT>& writer, const member_name& name)
+        : writer_(writer), name_(name)
+    {
+    }
+
+    template <class T>
+    void operator()(const T& val)
+    {
+        if (!is_absent_member(val))
+        {
+            writer_.name(member_name_string<CharT>(name_));
+            conversion_traits<T>::encode(val, writer_);
+        }
+    }
+};
+
+}
+
+// Decodes members straight from the reader's events, without building a basic_json value.
+// Unknown members are skipped, and members that are missing keep their default values.
+// A value that isn't an object sets ec to conversion_errc::expected_object.
+
+template <class T>
+struct conversion_traits<T,
+    typename std::enable_if<is_member_traits_declared<T>::value
+>::type>
+{
+    typedef member_traits<T> traits_type;
+
+    template <class CharT>
+    static T decode(basic_staj_reader<CharT>& reader, std::error_code& ec)
+    {
+        if (reader.current().event_type() != staj_event_type::begin_object)
+        {
+            ec = conversion_errc::expected_object;
+            return T();
+        }
+        T val;
+        reader.next(ec);
+        while (!ec && !reader.done() && reader.current().event_type() != staj_event_type::end_object)
+        {
+            // The name is only valid until the next call to next()
+            auto name = reader.current().template as<basic_string_view<CharT>>();
+            size_t index = traits_type::find(name.data(), name.length());
+            reader.next(ec);
+            if (ec)
+            {
+                break;
+            }
+            if (index < traits_type::size())
+            {
+                jsoncons::detail::member_decoder<CharT> decoder(reader, ec);
+                traits_type::visit(index, val, decoder);
+            }
+            else
+            {
+                reader.skip(ec);
+            }
+            if (ec)
+            {
+                break;
+            }
+            reader.next(ec);
+        }
+        return val;
+    }
+
+    template <class CharT>
+    static void encode(const T& val, basic_json_content_handler<CharT>& writer)
+    {
+        writer.begin_object();
+        const member_name* names = traits_type::names();
+        for (size_t i = 0; i < traits_type::size(); ++i)
+        {
+            jsoncons::detail::member_encoder<CharT> encoder(writer, names[i]);
+            traits_type::visit(i, val, encoder);
+        }
+        writer.end_object();
+    }
+};
+
 template <class CharT, class T>
 void decode_stream(basic_staj_reader<CharT>& reader, T& val, std::error_code& ec)
 {
@@ -0,0 +1,151 @@
+// Copyright 2013 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_DETAIL_CHAR_SCANNER_HPP
+#define JSONCONS_DETAIL_CHAR_SCANNER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits> // std::integral_constant
+#include <jsoncons/config/jsoncons_config.hpp>
+#include <jsoncons/json_exception.hpp>
+#if defined(JSONCONS_HAS_SSE2)
+#include <emmintrin.h>
+#endif
+#if defined(JSONCONS_HAS_AVX2)
+#include <immintrin.h>
+#endif
+#if defined(_MSC_VER) && (defined(JSONCONS_HAS_SSE2) || defined(JSONCONS_HAS_AVX2))
+#include <intrin.h> // _BitScanForward
+#endif
+
+namespace jsoncons { namespace detail {
+
+#if defined(JSONCONS_HAS_SSE2) || defined(JSONCONS_HAS_AVX2)
+inline unsigned int trailing_zeros(uint32_t mask)
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    unsigned long index;
+    _BitScanForward(&index, mask);
+    return static_cast<unsigned int>(index);
+#else
+    return static_cast<unsigned int>(__builtin_ctz(mask));
+#endif
+}
+#endif
+
+// Finds the first occurrence of any of a small set of characters. For single byte
+// characters the input is compared 32 (AVX2) or 16 (SSE2) bytes at a time.
+
+template <class CharT>
+class char_scanner
+{
+    static const size_t max_chars = 8;
+
+    CharT chars_[max_chars];
+    size_t count_;
+public:
+    char_scanner()
+        : count_(0)
+    {
+    }
+
+    void add(CharT c)
+    {
+        if (!contains(c))
+        {
+            JSONCONS_ASSERT(count_ < max_chars);
+            chars_[count_++] = c;
+        }
+    }
+
+    bool contains(CharT c) const
+    {
+        for (size_t i = 0; i < count_; ++i)
+        {
+            if (chars_[i] == c)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    const CharT* find_first(const CharT* first, const CharT* last) const
+    {
+        return find_first(first, last, std::integral_constant<bool,sizeof(CharT) == 1>());
+    }
+private:
+    const CharT* find_first(const CharT* first, const CharT* last, std::false_type) const
+    {
+        while (first != last && !contains(*first))
+        {
+            ++first;
+        }
+        return first;
+    }
+
+    const CharT* find_first(const CharT* first, const CharT* last, std::true_type) const
+    {
+#if defined(JSONCONS_HAS_AVX2)
+        if (last - first >= 32)
+        {
+            __m256i needles[max_chars];
+            for (size_t i = 0; i < count_; ++i)
+            {
+                needles[i] = _mm256_set1_epi8(static_cast<char>(chars_[i]));
+            }
+            do
+            {
+                __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first));
+                __m256i matches = _mm256_cmpeq_epi8(block, needles[0]);
+                for (size_t i = 1; i < count_; ++i)
+                {
+                    matches = _mm256_or_si256(matches, _mm256_cmpeq_epi8(block, needles[i]));
+                }
+                uint32_t mask = static_cast<uint32_t>(_mm256_movemask_epi8(matches));
+                if (mask != 0)
+                {
+                    return first + trailing_zeros(mask);
+                }
+                first += 32;
+            }
+            while (last - first >= 32);
+        }
+#endif
+#if defined(JSONCONS_HAS_SSE2)
+        if (last - first >= 16)
+        {
+            __m128i needles[max_chars];
+            for (size_t i = 0; i < count_; ++i)
+            {
+                needles[i] = _mm_set1_epi8(static_cast<char>(chars_[i]));
+            }
+            do
+            {
+                __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+                __m128i matches = _mm_cmpeq_epi8(block, needles[0]);
+                for (size_t i = 1; i < count_; ++i)
+                {
+                    matches = _mm_or_si128(matches, _mm_cmpeq_epi8(block, needles[i]));
+                }
+                uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(matches));
+                if (mask != 0)
+                {
+                    return first + trailing_zeros(mask);
+                }
+                first += 16;
+            }
+            while (last - first >= 16);
+        }
+#endif
+        return find_first(first, last, std::false_type());
+    }
+};
+
+}}
+
+#endif
@@ -0,0 +1,162 @@
+// Copyright 2013 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_DETAIL_THREAD_POOL_HPP
+#define JSONCONS_DETAIL_THREAD_POOL_HPP
+
+#include <vector>
+#include <queue>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <future>
+#include <functional>
+#include <exception>
+#include <utility> // std::move
+#include <jsoncons/config/jsoncons_config.hpp>
+
+namespace jsoncons { namespace detail {
+
+// A fixed set of worker threads that run submitted tasks in FIFO order.
+// The destructor finishes the queued tasks and joins the workers.
+
+class thread_pool
+{
+    std::vector<std::thread> workers_;
+    std::queue<std::function<void()>> tasks_;
+    std::mutex mutex_;
+    std::condition_variable condition_;
+    bool stop_;
+public:
+    explicit thread_pool(size_t thread_count)
+        : stop_(false)
+    {
+        if (thread_count == 0)
+        {
+            thread_count = 1;
+        }
+        workers_.reserve(thread_count);
+        for (size_t i = 0; i < thread_count; ++i)
+        {
+            workers_.emplace_back([this]() {run();});
+        }
+    }
+
+    thread_pool(const thread_pool&) = delete;
+    thread_pool& operator=(const thread_pool&) = delete;
+
+    ~thread_pool()
+    {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        condition_.notify_all();
+        for (auto& worker : workers_)
+        {
+            worker.join();
+        }
+    }
+
+    size_t size() const
+    {
+        return workers_.size();
+    }
+
+    template <class F>
+    std::future<void> submit(F&& f)
+    {
+        auto task = std::make_shared<std::packaged_task<void()>>(std::forward<F>(f));
+        std::future<void> result = task->get_future();
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            tasks_.emplace([task]() {(*task)();});
+        }
+        condition_.notify_one();
+        return result;
+    }
+
+    static size_t default_thread_count()
+    {
+        size_t n = std::thread::hardware_concurrency();
+        return n > 0 ? n : 1;
+    }
+private:
+    void run()
+    {
+        for (;;)
+        {
+            std::function<void()> task;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                condition_.wait(lock, [this]() {return stop_ || !tasks_.empty();});
+                if (stop_ && tasks_.empty())
+                {
+                    return;
+                }
+                task = std::move(tasks_.front());
+                tasks_.pop();
+            }
+            task();
+        }
+    }
+};
+
+// Number of chunks that [0,count) is split into when each chunk
+// should hold at least min_chunk_size items
+
+inline
+size_t chunk_count(size_t count, size_t max_chunks, size_t min_chunk_size)
+{
+    if (min_chunk_size == 0)
+    {
+        min_chunk_size = 1;
+    }
+    size_t n = count / min_chunk_size;
+    if (n > max_chunks)
+    {
+        n = max_chunks;
+    }
+    return n > 0 ? n : 1;
+}
+
+// Splits [0,count) into chunk_count contiguous ranges and calls f(chunk_index, first, last)
+// for each of them on the pool. Returns after all chunks have completed, rethrowing
+// the exception of the lowest numbered chunk that failed.
+
+template <class F>
+void parallel_for(thread_pool& pool, size_t count, size_t chunk_count, F f)
+{
+    if (chunk_count <= 1)
+    {
+        f(0, 0, count);
+        return;
+    }
+    size_t chunk_size = count / chunk_count;
+    size_t remainder = count % chunk_count;
+
+    std::vector<std::future<void>> futures;
+    futures.reserve(chunk_count);
+    size_t first = 0;
+    for (size_t i = 0; i < chunk_count; ++i)
+    {
+        size_t last = first + chunk_size + (i < remainder ? 1 : 0);
+        futures.push_back(pool.submit([&f,i,first,last]() {f(i, first, last);}));
+        first = last;
+    }
+    for (auto& fut : futures)
+    {
+        fut.wait();
+    }
+    for (auto& fut : futures)
+    {
+        fut.get();
+    }
+}
+
+}}
+
+#endif
@@ -15,6 +15,7 @@
 #include <iterator> // std::iterator_traits
 #include <exception>
 #include <array>
+#include <utility> // std::declval
 #include <jsoncons/config/jsoncons_config.hpp>
 #include <jsoncons/json_exception.hpp>
 
@@ -221,6 +222,32 @@ struct is_vector_like<T,
 >::type> 
     : std::true_type {};
 
+// has_reserve
+
+template <class T, class Enable=void>
+struct has_reserve : std::false_type {};
+
+template <class T>
+struct has_reserve<T, 
+                   typename std::enable_if<std::is_void<decltype(std::declval<T&>().reserve(size_t()))>::value
+>::type> 
+    : std::true_type {};
+
+// is_typed_array_like, a contiguous sequence of numbers
+
+template <class T, class Enable=void>
+struct is_typed_array_like : std::false_type {};
+
+template <class T>
+struct is_typed_array_like<T, 
+                           typename std::enable_if<(is_integer_like<typename T::value_type>::value ||
+                                                    is_uinteger_like<typename T::value_type>::value ||
+                                                    is_floating_point_like<typename T::value_type>::value) &&
+                                                   !has_char_traits_member_type<T>::value &&
+                                                   std::is_same<decltype(std::declval<const T&>().data()),const typename T::value_type*>::value
+>::type> 
+    : std::true_type {};
+
 }
 
 }
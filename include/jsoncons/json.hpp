@@ -9,6 +9,8 @@
 
 #include <jsoncons/basic_json.hpp>
 #include <jsoncons/json_conversion.hpp>
+#include <jsoncons/json_type_traits_macros.hpp>
+#include <jsoncons/json_hash.hpp>
 
 #endif
 
@@ -221,6 +221,30 @@ public:
         return do_null_value(tag, context);
     }
 
+    // An array of size numbers in one call. Handlers that don't override do_typed_array
+    // receive it as begin_array(size), a value per element, and end_array.
+
+    bool typed_array(const int64_t* data, size_t size,
+                     semantic_tag_type tag = semantic_tag_type::none,
+                     const serializing_context& context=null_serializing_context()) 
+    {
+        return do_typed_array(data, size, tag, context);
+    }
+
+    bool typed_array(const uint64_t* data, size_t size,
+                     semantic_tag_type tag = semantic_tag_type::none,
+                     const serializing_context& context=null_serializing_context()) 
+    {
+        return do_typed_array(data, size, tag, context);
+    }
+
+    bool typed_array(const double* data, size_t size,
+                     semantic_tag_type tag = semantic_tag_type::none,
+                     const serializing_context& context=null_serializing_context()) 
+    {
+        return do_typed_array(data, size, tag, context);
+    }
+
 #if !defined(JSONCONS_NO_DEPRECATED)
 
     bool begin_document()
@@ -329,6 +353,36 @@ private:
                                  const serializing_context& context) = 0;
 
     virtual bool do_bool_value(bool value, semantic_tag_type tag, const serializing_context& context) = 0;
+
+    virtual bool do_typed_array(const int64_t* data, size_t size, semantic_tag_type tag, const serializing_context& context)
+    {
+        bool more = do_begin_array(size, tag, context);
+        for (size_t i = 0; more && i < size; ++i)
+        {
+            more = do_int64_value(data[i], semantic_tag_type::none, context);
+        }
+        return more && do_end_array(context);
+    }
+
+    virtual bool do_typed_array(const uint64_t* data, size_t size, semantic_tag_type tag, const serializing_context& context)
+    {
+        bool more = do_begin_array(size, tag, context);
+        for (size_t i = 0; more && i < size; ++i)
+        {
+            more = do_uint64_value(data[i], semantic_tag_type::none, context);
+        }
+        return more && do_end_array(context);
+    }
+
+    virtual bool do_typed_array(const double* data, size_t size, semantic_tag_type tag, const serializing_context& context)
+    {
+        bool more = do_begin_array(size, tag, context);
+        for (size_t i = 0; more && i < size; ++i)
+        {
+            more = do_double_value(data[i], semantic_tag_type::none, context);
+        }
+        return more && do_end_array(context);
+    }
 };
 
 template <class CharT>
@@ -29,6 +29,7 @@ public:
     typedef typename Json::string_type string_type;
     typedef typename Json::array array;
     typedef typename Json::object object;
+    typedef typename Json::typed_array typed_array_type;
     typedef typename Json::allocator_type json_allocator_type;
     typedef typename string_type::allocator_type json_string_allocator;
     typedef typename array::allocator_type json_array_allocator;
@@ -81,13 +82,18 @@ private:
     std::vector<stack_item,stack_item_allocator_type> stack_;
     std::vector<structure_offset,size_t_allocator_type> stack_offsets_;
     bool is_valid_;
+    bool typed_arrays_;
+
+    // With typed_arrays, arrays of at least this many numbers of one type are stored as a typed array
+    static const size_t typed_array_min_length = 16;
 
 public:
     json_decoder(const json_allocator_type& jallocator = json_allocator_type())
         : string_allocator_(jallocator),
           object_allocator_(jallocator),
           array_allocator_(jallocator),
-          is_valid_(false) 
+          is_valid_(false),
+          typed_arrays_(false)
 
     {
         stack_.reserve(1000);
@@ -95,6 +101,30 @@ public:
         stack_offsets_.push_back({0,container_type::root_t});
     }
 
+    json_decoder(const basic_json_read_options<char_type>& options,
+                 const json_allocator_type& jallocator = json_allocator_type())
+        : string_allocator_(jallocator),
+          object_allocator_(jallocator),
+          array_allocator_(jallocator),
+          is_valid_(false),
+          typed_arrays_(options.typed_arrays())
+
+    {
+        stack_.reserve(1000);
+        stack_offsets_.reserve(100);
+        stack_offsets_.push_back({0,container_type::root_t});
+    }
+
+    // Prepares to decode another value, keeping the capacity of the internal stacks
+    void reset()
+    {
+        stack_.clear();
+        stack_offsets_.clear();
+        stack_offsets_.push_back({0,container_type::root_t});
+        result_ = Json();
+        is_valid_ = false;
+    }
+
     bool is_valid() const
     {
         return is_valid_;
@@ -195,11 +225,14 @@ private:
         auto first = stack_.begin() + (structure_index+1);
         auto last = first + count;
         auto& j = stack_[structure_index].value_;
-        j.reserve(count);
-        while (first != last)
+        if (!typed_arrays_ || count < typed_array_min_length || !store_typed_array(first, last, j))
         {
-            j.push_back(std::move(first->value_));
-            ++first;
+            j.reserve(count);
+            while (first != last)
+            {
+                j.push_back(std::move(first->value_));
+                ++first;
+            }
         }
         stack_.erase(stack_.begin()+structure_index+1, stack_.end());
         stack_offsets_.pop_back();
@@ -213,6 +246,27 @@ private:
         return true;
     }
 
+    // Replaces j with a typed array if the values in [first,last) are all numbers of one type
+    template <class Iterator>
+    bool store_typed_array(Iterator first, Iterator last, Json& j)
+    {
+        typed_array_type values(array_allocator_);
+        if (!values.try_push_back(first->value_))
+        {
+            return false;
+        }
+        values.reserve(last - first);
+        for (++first; first != last; ++first)
+        {
+            if (!values.try_push_back(first->value_))
+            {
+                return false;
+            }
+        }
+        j = Json(std::move(values), j.semantic_tag());
+        return true;
+    }
+
     bool do_name(const string_view_type& name, const serializing_context&) override
     {
         stack_.emplace_back(std::true_type(), name.data(), name.length(), string_allocator_);
@@ -350,6 +404,42 @@ private:
         }
         return true;
     }
+
+    bool do_typed_array(const int64_t* data, size_t size, semantic_tag_type tag, const serializing_context&) override
+    {
+        return typed_array_value(data, size, tag);
+    }
+
+    bool do_typed_array(const uint64_t* data, size_t size, semantic_tag_type tag, const serializing_context&) override
+    {
+        return typed_array_value(data, size, tag);
+    }
+
+    bool do_typed_array(const double* data, size_t size, semantic_tag_type tag, const serializing_context&) override
+    {
+        return typed_array_value(data, size, tag);
+    }
+
+    template <class T>
+    bool typed_array_value(const T* data, size_t size, semantic_tag_type tag)
+    {
+        Json j = typed_arrays_ ? Json(typed_array_type(data, size, array_allocator_), tag) 
+                               : Json(array(data, data + size, array_allocator_), tag);
+        switch (stack_offsets_.back().type_)
+        {
+            case container_type::object_t:
+                stack_.back().value_ = std::move(j);
+                break;
+            case container_type::array_t:
+                stack_.emplace_back(std::false_type(), std::move(j));
+                break;
+            case container_type::root_t:
+                result_ = std::move(j);
+                is_valid_ = true;
+                return false;
+        }
+        return true;
+    }
 };
 
 }
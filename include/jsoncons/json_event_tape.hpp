@@ -0,0 +1,375 @@
+// Copyright 2013 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_JSON_EVENT_TAPE_HPP
+#define JSONCONS_JSON_EVENT_TAPE_HPP
+
+#include <cstdint>
+#include <vector>
+#include <memory> // std::allocator
+#include <jsoncons/json_content_handler.hpp>
+#include <jsoncons/byte_string.hpp>
+#include <jsoncons/parallel_policy.hpp>
+#include <jsoncons/detail/thread_pool.hpp>
+
+namespace jsoncons {
+
+// Records the events sent to it, so that they can be replayed to any number of content handlers
+// without parsing the input again. Each event is a fixed size entry, and names, strings, byte
+// strings and typed arrays are copied into arenas that the entries refer to by offset. Replaying
+// only reads the tape, so it may be replayed to several handlers on several threads at once.
+// The handlers are given a serializing_context with line and column zero. A tape may hold
+// several top level values, such as the lines of a JSON Lines file.
+
+template <class CharT,class Allocator=std::allocator<char>>
+class basic_json_event_tape final : public basic_json_content_handler<CharT>
+{
+public:
+    typedef CharT char_type;
+    using typename basic_json_content_handler<CharT>::string_view_type;
+    typedef Allocator allocator_type;
+private:
+    enum class event_kind : uint8_t
+    {
+        flush,
+        begin_object,
+        begin_object_with_length,
+        end_object,
+        begin_array,
+        begin_array_with_length,
+        end_array,
+        name,
+        null_value,
+        string_value,
+        byte_string_value,
+        int64_value,
+        uint64_value,
+        double_value,
+        bool_value,
+        int64_array,
+        uint64_array,
+        double_array
+    };
+
+    struct event
+    {
+        event_kind kind;
+        semantic_tag_type tag;
+        // Length of a container, string, byte string or typed array
+        size_t length;
+        union
+        {
+            size_t offset;
+            int64_t int64_value;
+            uint64_t uint64_value;
+            double double_value;
+            bool bool_value;
+        };
+
+        event(event_kind kind, semantic_tag_type tag, size_t length = 0)
+            : kind(kind), tag(tag), length(length), offset(0)
+        {
+        }
+    };
+
+    typedef typename std::allocator_traits<allocator_type>:: template rebind_alloc<event> event_allocator_type;
+    typedef typename std::allocator_traits<allocator_type>:: template rebind_alloc<char_type> char_allocator_type;
+    typedef typename std::allocator_traits<allocator_type>:: template rebind_alloc<uint8_t> byte_allocator_type;
+    typedef typename std::allocator_traits<allocator_type>:: template rebind_alloc<uint64_t> uint64_allocator_type;
+    typedef typename std::allocator_traits<allocator_type>:: template rebind_alloc<double> double_allocator_type;
+
+    std::vector<event,event_allocator_type> events_;
+    std::vector<char_type,char_allocator_type> chars_;
+    std::vector<uint8_t,byte_allocator_type> bytes_;
+    // int64_t and uint64_t typed arrays share one arena
+    std::vector<uint64_t,uint64_allocator_type> integers_;
+    std::vector<double,double_allocator_type> doubles_;
+
+    // Noncopyable and nonmoveable
+    basic_json_event_tape(const basic_json_event_tape&) = delete;
+    basic_json_event_tape& operator=(const basic_json_event_tape&) = delete;
+public:
+    basic_json_event_tape(const Allocator& alloc = Allocator())
+        : events_(event_allocator_type(alloc)),
+          chars_(char_allocator_type(alloc)),
+          bytes_(byte_allocator_type(alloc)),
+          integers_(uint64_allocator_type(alloc)),
+          doubles_(double_allocator_type(alloc))
+    {
+    }
+
+    // The number of recorded events
+    size_t size() const
+    {
+        return events_.size();
+    }
+
+    bool empty() const
+    {
+        return events_.empty();
+    }
+
+    // Erases the recorded events, keeping the memory for the next recording
+    void clear()
+    {
+        events_.clear();
+        chars_.clear();
+        bytes_.clear();
+        integers_.clear();
+        doubles_.clear();
+    }
+
+    // Replays the events to handler. As with json_reader::read, the replay goes on to the last
+    // event when the handler returns false, as json_decoder does at the end of each value.
+    void replay(basic_json_content_handler<CharT>& handler) const
+    {
+        null_serializing_context context;
+        for (const auto& e : events_)
+        {
+            replay_event(e, handler, context);
+        }
+    }
+
+    // Replays the events to each of the handlers in turn
+    void replay(const std::vector<basic_json_content_handler<CharT>*>& handlers) const
+    {
+        for (auto handler : handlers)
+        {
+            replay(*handler);
+        }
+    }
+
+    // Replays the events to the handlers concurrently, on up to policy.max_threads()
+    // threads. Each handler is called from one thread only.
+    void replay(const std::vector<basic_json_content_handler<CharT>*>& handlers,
+                const parallel_policy& policy) const
+    {
+        size_t chunk_count = jsoncons::detail::chunk_count(handlers.size(), policy.max_threads(), 1);
+        if (chunk_count <= 1)
+        {
+            replay(handlers);
+            return;
+        }
+        jsoncons::detail::thread_pool pool(chunk_count);
+        jsoncons::detail::parallel_for(pool, handlers.size(), chunk_count,
+            [&](size_t, size_t first, size_t last)
+            {
+                for (size_t i = first; i < last; ++i)
+                {
+                    replay(*handlers[i]);
+                }
+            });
+    }
+
+private:
+    void replay_event(const event& e,
+                      basic_json_content_handler<CharT>& handler,
+                      const serializing_context& context) const
+    {
+        switch (e.kind)
+        {
+            case event_kind::flush:
+                handler.flush();
+                break;
+            case event_kind::begin_object:
+                handler.begin_object(e.tag, context);
+                break;
+            case event_kind::begin_object_with_length:
+                handler.begin_object(e.length, e.tag, context);
+                break;
+            case event_kind::end_object:
+                handler.end_object(context);
+                break;
+            case event_kind::begin_array:
+                handler.begin_array(e.tag, context);
+                break;
+            case event_kind::begin_array_with_length:
+                handler.begin_array(e.length, e.tag, context);
+                break;
+            case event_kind::end_array:
+                handler.end_array(context);
+                break;
+            case event_kind::name:
+                handler.name(string_view_type(chars_.data() + e.offset, e.length), context);
+                break;
+            case event_kind::null_value:
+                handler.null_value(e.tag, context);
+                break;
+            case event_kind::string_value:
+                handler.string_value(string_view_type(chars_.data() + e.offset, e.length), e.tag, context);
+                break;
+            case event_kind::byte_string_value:
+                handler.byte_string_value(byte_string_view(bytes_.data() + e.offset, e.length), e.tag, context);
+                break;
+            case event_kind::int64_value:
+                handler.int64_value(e.int64_value, e.tag, context);
+                break;
+            case event_kind::uint64_value:
+                handler.uint64_value(e.uint64_value, e.tag, context);
+                break;
+            case event_kind::double_value:
+                handler.double_value(e.double_value, e.tag, context);
+                break;
+            case event_kind::bool_value:
+                handler.bool_value(e.bool_value, e.tag, context);
+                break;
+            case event_kind::int64_array:
+                handler.typed_array(reinterpret_cast<const int64_t*>(integers_.data() + e.offset), e.length, e.tag, context);
+                break;
+            case event_kind::uint64_array:
+                handler.typed_array(integers_.data() + e.offset, e.length, e.tag, context);
+                break;
+            case event_kind::double_array:
+                handler.typed_array(doubles_.data() + e.offset, e.length, e.tag, context);
+                break;
+            default:
+                break;
+        }
+    }
+
+    size_t append_chars(const string_view_type& s)
+    {
+        size_t offset = chars_.size();
+        chars_.insert(chars_.end(), s.data(), s.data() + s.length());
+        return offset;
+    }
+
+    void do_flush() override
+    {
+        events_.emplace_back(event_kind::flush, semantic_tag_type::none);
+    }
+
+    bool do_begin_object(semantic_tag_type tag, const serializing_context&) override
+    {
+        events_.emplace_back(event_kind::begin_object, tag);
+        return true;
+    }
+
+    bool do_begin_object(size_t length, semantic_tag_type tag, const serializing_context&) override
+    {
+        events_.emplace_back(event_kind::begin_object_with_length, tag, length);
+        return true;
+    }
+
+    bool do_end_object(const serializing_context&) override
+    {
+        events_.emplace_back(event_kind::end_object, semantic_tag_type::none);
+        return true;
+    }
+
+    bool do_begin_array(semantic_tag_type tag, const serializing_context&) override
+    {
+        events_.emplace_back(event_kind::begin_array, tag);
+        return true;
+    }
+
+    bool do_begin_array(size_t length, semantic_tag_type tag, const serializing_context&) override
+    {
+        events_.emplace_back(event_kind::begin_array_with_length, tag, length);
+        return true;
+    }
+
+    bool do_end_array(const serializing_context&) override
+    {
+        events_.emplace_back(event_kind::end_array, semantic_tag_type::none);
+        return true;
+    }
+
+    bool do_name(const string_view_type& name, const serializing_context&) override
+    {
+        events_.emplace_back(event_kind::name, semantic_tag_type::none, name.length());
+        events_.back().offset = append_chars(name);
+        return true;
+    }
+
+    bool do_null_value(semantic_tag_type tag, const serializing_context&) override
+    {
+        events_.emplace_back(event_kind::null_value, tag);
+        return true;
+    }
+
+    bool do_string_value(const string_view_type& value, semantic_tag_type tag, const serializing_context&) override
+    {
+        events_.emplace_back(event_kind::string_value, tag, value.length());
+        events_.back().offset = append_chars(value);
+        return true;
+    }
+
+    bool do_byte_string_value(const byte_string_view& b,
+                              semantic_tag_type tag,
+                              const serializing_context&) override
+    {
+        events_.emplace_back(event_kind::byte_string_value, tag, b.length());
+        events_.back().offset = bytes_.size();
+        bytes_.insert(bytes_.end(), b.begin(), b.end());
+        return true;
+    }
+
+    bool do_double_value(double value,
+                         semantic_tag_type tag,
+                         const serializing_context&) override
+    {
+        events_.emplace_back(event_kind::double_value, tag);
+        events_.back().double_value = value;
+        return true;
+    }
+
+    bool do_int64_value(int64_t value,
+                        semantic_tag_type tag,
+                        const serializing_context&) override
+    {
+        events_.emplace_back(event_kind::int64_value, tag);
+        events_.back().int64_value = value;
+        return true;
+    }
+
+    bool do_uint64_value(uint64_t value,
+                         semantic_tag_type tag,
+                         const serializing_context&) override
+    {
+        events_.emplace_back(event_kind::uint64_value, tag);
+        events_.back().uint64_value = value;
+        return true;
+    }
+
+    bool do_bool_value(bool value, semantic_tag_type tag, const serializing_context&) override
+    {
+        events_.emplace_back(event_kind::bool_value, tag);
+        events_.back().bool_value = value;
+        return true;
+    }
+
+    bool do_typed_array(const int64_t* data, size_t size, semantic_tag_type tag, const serializing_context&) override
+    {
+        events_.emplace_back(event_kind::int64_array, tag, size);
+        events_.back().offset = integers_.size();
+        integers_.insert(integers_.end(), data, data + size);
+        return true;
+    }
+
+    bool do_typed_array(const uint64_t* data, size_t size, semantic_tag_type tag, const serializing_context&) override
+    {
+        events_.emplace_back(event_kind::uint64_array, tag, size);
+        events_.back().offset = integers_.size();
+        integers_.insert(integers_.end(), data, data + size);
+        return true;
+    }
+
+    bool do_typed_array(const double* data, size_t size, semantic_tag_type tag, const serializing_context&) override
+    {
+        events_.emplace_back(event_kind::double_array, tag, size);
+        events_.back().offset = doubles_.size();
+        doubles_.insert(doubles_.end(), data, data + size);
+        return true;
+    }
+};
+
+typedef basic_json_event_tape<char> json_event_tape;
+typedef basic_json_event_tape<wchar_t> wjson_event_tape;
+
+}
+
+#endif
@@ -0,0 +1,351 @@
+// Copyright 2013 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_JSON_HASH_HPP
+#define JSONCONS_JSON_HASH_HPP
+
+#include <cstdint>
+#include <cstring> // std::memcpy
+#include <unordered_map>
+#include <functional> // std::hash
+#include <jsoncons/basic_json.hpp>
+
+namespace jsoncons {
+
+namespace detail {
+
+    // splitmix64 finalizer
+    inline
+    uint64_t hash_mix(uint64_t h) noexcept
+    {
+        h ^= h >> 30;
+        h *= 0xbf58476d1ce4e5b9ULL;
+        h ^= h >> 27;
+        h *= 0x94d049bb133111ebULL;
+        h ^= h >> 31;
+        return h;
+    }
+
+    // FNV-1a
+    inline
+    uint64_t hash_bytes(const void* data, size_t length, uint64_t seed) noexcept
+    {
+        const uint8_t* p = static_cast<const uint8_t*>(data);
+        uint64_t h = 0xcbf29ce484222325ULL ^ seed;
+        for (size_t i = 0; i < length; ++i)
+        {
+            h ^= p[i];
+            h *= 0x100000001b3ULL;
+        }
+        return hash_mix(h);
+    }
+
+    enum class hash_seed : uint64_t {null_value=1,false_value,true_value,integer,floating,string,byte_string,array,object};
+
+    // Numbers that compare equal must hash equal, and int64, uint64 and double values compare
+    // equal across types. Integers and integral doubles up to 2^53 in magnitude hash as integers,
+    // everything else by its value as a double.
+
+    inline
+    uint64_t hash_double(double val) noexcept
+    {
+        const double limit = 9007199254740992.0; // 2^53
+        if (val >= -limit && val <= limit && static_cast<double>(static_cast<int64_t>(val)) == val)
+        {
+            return hash_mix(static_cast<uint64_t>(static_cast<int64_t>(val)) ^ static_cast<uint64_t>(hash_seed::integer));
+        }
+        if (val == 0.0)
+        {
+            val = 0.0; // -0.0
+        }
+        uint64_t bits;
+        std::memcpy(&bits, &val, sizeof(bits));
+        return hash_mix(bits ^ static_cast<uint64_t>(hash_seed::floating));
+    }
+
+    inline
+    uint64_t hash_int64(int64_t val) noexcept
+    {
+        const int64_t limit = int64_t(1) << 53;
+        if (val >= -limit && val <= limit)
+        {
+            return hash_mix(static_cast<uint64_t>(val) ^ static_cast<uint64_t>(hash_seed::integer));
+        }
+        return hash_double(static_cast<double>(val));
+    }
+
+    inline
+    uint64_t hash_uint64(uint64_t val) noexcept
+    {
+        const uint64_t limit = uint64_t(1) << 53;
+        if (val <= limit)
+        {
+            return hash_mix(val ^ static_cast<uint64_t>(hash_seed::integer));
+        }
+        return hash_double(static_cast<double>(val));
+    }
+
+    template <class StringView>
+    uint64_t hash_string(const StringView& s) noexcept
+    {
+        return hash_bytes(s.data(), s.length()*sizeof(typename StringView::value_type), static_cast<uint64_t>(hash_seed::string));
+    }
+
+    inline
+    uint64_t hash_array_begin() noexcept
+    {
+        return static_cast<uint64_t>(hash_seed::array);
+    }
+
+    // Array elements are combined in order
+    inline
+    uint64_t hash_array_element(uint64_t h, uint64_t element) noexcept
+    {
+        return hash_mix(h * 0x9e3779b97f4a7c15ULL + element);
+    }
+
+    inline
+    uint64_t hash_array_end(uint64_t h, size_t size) noexcept
+    {
+        return hash_mix(h ^ static_cast<uint64_t>(size));
+    }
+
+    // Object members are combined with a commutative sum, since objects compare equal
+    // regardless of member order
+    inline
+    uint64_t hash_member(uint64_t key, uint64_t value) noexcept
+    {
+        return hash_mix(key ^ (value * 0x9e3779b97f4a7c15ULL));
+    }
+
+    inline
+    uint64_t hash_object_end(uint64_t sum, size_t size) noexcept
+    {
+        return hash_mix(sum ^ static_cast<uint64_t>(hash_seed::object) ^ (static_cast<uint64_t>(size) << 32));
+    }
+
+    // Hashes the same as an array holding the same numbers as basic_json values
+    template <class TypedArray>
+    uint64_t hash_typed_array(const TypedArray& values) noexcept
+    {
+        const size_t size = values.size();
+        uint64_t h = hash_array_begin();
+        if (values.int64_data() != nullptr)
+        {
+            const int64_t* p = values.int64_data();
+            for (size_t i = 0; i < size; ++i)
+            {
+                h = hash_array_element(h, hash_int64(p[i]));
+            }
+        }
+        else if (values.uint64_data() != nullptr)
+        {
+            const uint64_t* p = values.uint64_data();
+            for (size_t i = 0; i < size; ++i)
+            {
+                h = hash_array_element(h, hash_uint64(p[i]));
+            }
+        }
+        else if (values.double_data() != nullptr)
+        {
+            const double* p = values.double_data();
+            for (size_t i = 0; i < size; ++i)
+            {
+                h = hash_array_element(h, hash_double(p[i]));
+            }
+        }
+        return hash_array_end(h, size);
+    }
+
+    template <class Json>
+    uint64_t hash_scalar(const Json& val)
+    {
+        switch (val.structure_tag())
+        {
+            case structure_tag_type::null_tag:
+                return hash_mix(static_cast<uint64_t>(hash_seed::null_value));
+            case structure_tag_type::bool_tag:
+                return hash_mix(static_cast<uint64_t>(val.as_bool() ? hash_seed::true_value : hash_seed::false_value));
+            case structure_tag_type::int64_tag:
+                return hash_int64(val.template as_integer<int64_t>());
+            case structure_tag_type::uint64_tag:
+                return hash_uint64(val.template as_integer<uint64_t>());
+            case structure_tag_type::double_tag:
+                return hash_double(val.as_double());
+            case structure_tag_type::short_string_tag:
+            case structure_tag_type::long_string_tag:
+                return hash_string(val.as_string_view());
+            case structure_tag_type::byte_string_tag:
+            {
+                auto bs = val.as_byte_string_view();
+                return hash_bytes(bs.data(), bs.length(), static_cast<uint64_t>(hash_seed::byte_string));
+            }
+            case structure_tag_type::empty_object_tag:
+                return hash_object_end(0, 0);
+            case structure_tag_type::typed_array_tag:
+                return hash_typed_array(val.typed_array_value());
+            default:
+                return 0;
+        }
+    }
+
+    // Cache is a callable taking a const Json& container and returning a pointer to its
+    // hash if already known, or nullptr
+
+    template <class Json,class Cache>
+    uint64_t hash_value(const Json& val, Cache cache)
+    {
+        switch (val.structure_tag())
+        {
+            case structure_tag_type::array_tag:
+            {
+                const uint64_t* p = cache(val);
+                if (p != nullptr)
+                {
+                    return *p;
+                }
+                uint64_t h = hash_array_begin();
+                for (const auto& element : val.array_range())
+                {
+                    h = hash_array_element(h, hash_value(element, cache));
+                }
+                return hash_array_end(h, val.size());
+            }
+            case structure_tag_type::object_tag:
+            {
+                const uint64_t* p = cache(val);
+                if (p != nullptr)
+                {
+                    return *p;
+                }
+                uint64_t sum = 0;
+                for (const auto& member : val.object_range())
+                {
+                    sum += hash_member(hash_string(member.key()), hash_value(member.value(), cache));
+                }
+                return hash_object_end(sum, val.size());
+            }
+            case structure_tag_type::typed_array_tag:
+            {
+                const uint64_t* p = cache(val);
+                return p != nullptr ? *p : hash_scalar(val);
+            }
+            default:
+                return hash_scalar(val);
+        }
+    }
+
+    template <class Json>
+    const uint64_t* no_hash_cache(const Json&) noexcept
+    {
+        return nullptr;
+    }
+}
+
+// Returns a structural hash of val, consistent with operator==: values that compare
+// equal have the same hash. Array elements are hashed in order, object members
+// without regard to order.
+
+template <class CharT,class ImplementationPolicy,class Allocator>
+size_t hash_value(const basic_json<CharT,ImplementationPolicy,Allocator>& val)
+{
+    typedef basic_json<CharT,ImplementationPolicy,Allocator> json_type;
+    return static_cast<size_t>(jsoncons::detail::hash_value(val, jsoncons::detail::no_hash_cache<json_type>));
+}
+
+// Holds the hashes of every array and object in a document, computed in one pass.
+// The document must not be modified while the cache is in use.
+
+template <class Json>
+class json_hash_cache
+{
+    std::unordered_map<const Json*,uint64_t> hashes_;
+public:
+    explicit json_hash_cache(const Json& root)
+    {
+        build(root);
+    }
+
+    json_hash_cache(const json_hash_cache&) = default;
+    json_hash_cache(json_hash_cache&&) = default;
+    json_hash_cache& operator=(const json_hash_cache&) = default;
+    json_hash_cache& operator=(json_hash_cache&&) = default;
+
+    // Returns the hash of val, which is looked up if val is an array or object in the cached document
+    size_t hash(const Json& val) const
+    {
+        return static_cast<size_t>(jsoncons::detail::hash_value(val, [this](const Json& v) {return find(v);}));
+    }
+
+    // Compares a value in this cache's document with a value in other's document by hash.
+    // Unequal hashes prove the values unequal. Equal hashes are taken to mean equal values,
+    // with a chance of collision of about 2^-64 for 64-bit hashes.
+    bool equal(const Json& val, const json_hash_cache& other, const Json& other_val) const
+    {
+        return hash(val) == other.hash(other_val);
+    }
+private:
+    const uint64_t* find(const Json& val) const
+    {
+        auto it = hashes_.find(&val);
+        return it == hashes_.end() ? nullptr : &(it->second);
+    }
+
+    uint64_t build(const Json& val)
+    {
+        uint64_t h;
+        switch (val.structure_tag())
+        {
+            case structure_tag_type::array_tag:
+            {
+                h = jsoncons::detail::hash_array_begin();
+                for (const auto& element : val.array_range())
+                {
+                    h = jsoncons::detail::hash_array_element(h, build(element));
+                }
+                h = jsoncons::detail::hash_array_end(h, val.size());
+                hashes_.emplace(&val, h);
+                break;
+            }
+            case structure_tag_type::object_tag:
+            {
+                uint64_t sum = 0;
+                for (const auto& member : val.object_range())
+                {
+                    sum += jsoncons::detail::hash_member(jsoncons::detail::hash_string(member.key()), build(member.value()));
+                }
+                h = jsoncons::detail::hash_object_end(sum, val.size());
+                hashes_.emplace(&val, h);
+                break;
+            }
+            case structure_tag_type::typed_array_tag:
+                h = jsoncons::detail::hash_scalar(val);
+                hashes_.emplace(&val, h);
+                break;
+            default:
+                h = jsoncons::detail::hash_scalar(val);
+                break;
+        }
+        return h;
+    }
+};
+
+}
+
+namespace std {
+
+template <class CharT,class ImplementationPolicy,class Allocator>
+struct hash<jsoncons::basic_json<CharT,ImplementationPolicy,Allocator>>
+{
+    size_t operator()(const jsoncons::basic_json<CharT,ImplementationPolicy,Allocator>& val) const
+    {
+        return jsoncons::hash_value(val);
+    }
+};
+
+}
+
+#endif
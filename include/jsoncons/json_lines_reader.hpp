@@ -0,0 +1,447 @@
+// Copyright 2013 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_JSON_LINES_READER_HPP
+#define JSONCONS_JSON_LINES_READER_HPP
+
+#include <string>
+#include <vector>
+#include <memory> // std::allocator
+#include <utility> // std::move, std::pair
+#include <istream> // std::basic_istream
+#include <algorithm> // std::find, std::count
+#include <system_error>
+#include <jsoncons/json_exception.hpp>
+#include <jsoncons/json_content_handler.hpp>
+#include <jsoncons/json_options.hpp>
+#include <jsoncons/json_parser.hpp>
+#include <jsoncons/json_decoder.hpp>
+#include <jsoncons/json_error.hpp>
+#include <jsoncons/parallel_policy.hpp>
+#include <jsoncons/detail/thread_pool.hpp>
+
+namespace jsoncons {
+
+namespace detail {
+
+struct json_lines_error
+{
+    std::error_code ec;
+    size_t line;
+    size_t column;
+
+    json_lines_error()
+        : line(0), column(0)
+    {
+    }
+};
+
+// Parses the lines in [first,last) as one JSON text each, skipping blank lines, and sends
+// the events of each to handler followed by a call to f(line). line is the number of the
+// line at first. Stops at the first line that fails to parse, with its position in error.
+
+template <class CharT,class Allocator,class F>
+void parse_json_lines(basic_json_parser<CharT,Allocator>& parser,
+                      basic_json_content_handler<CharT>& handler,
+                      const CharT* first,
+                      const CharT* last,
+                      size_t line,
+                      F f,
+                      json_lines_error& error)
+{
+    while (first != last)
+    {
+        const CharT* end = std::find(first, last, '\n');
+        const CharT* p = first;
+        while (p != end && (*p == ' ' || *p == '\t' || *p == '\r'))
+        {
+            ++p;
+        }
+        if (p != end)
+        {
+            parser.reset();
+            parser.set_column_number(static_cast<size_t>(p - first) + 1);
+            parser.update(p, static_cast<size_t>(end - p));
+            std::error_code ec;
+            while (!parser.finished())
+            {
+                parser.parse_some(handler, ec);
+                if (ec)
+                {
+                    break;
+                }
+            }
+            if (!ec)
+            {
+                parser.check_done(ec);
+            }
+            if (ec)
+            {
+                error.ec = ec;
+                error.line = line + parser.line_number() - 1;
+                error.column = parser.column_number();
+                return;
+            }
+            f(line);
+        }
+        ++line;
+        first = end == last ? last : end + 1;
+    }
+}
+
+}
+
+// Reads newline delimited JSON, one JSON text per line, from text held in memory, such as
+// a string or a memory mapped file, or from a stream. The text is taken a batch of lines
+// at a time, and each batch is split at newlines into chunks that are parsed on a thread
+// pool, each chunk with its own parser. Blank lines are skipped.
+
+template<class CharT,class Allocator=std::allocator<char>>
+class basic_json_lines_reader
+{
+public:
+    typedef CharT char_type;
+    typedef basic_string_view<CharT> string_view_type;
+private:
+    // Each chunk of a batch is at least this long, unless limited by max_threads
+    static const size_t default_batch_chunk_length = 256*1024;
+
+    basic_json_lines_reader(const basic_json_lines_reader&) = delete;
+    basic_json_lines_reader& operator = (const basic_json_lines_reader&) = delete;
+
+    const CharT* data_;
+    size_t length_;
+    std::basic_istream<CharT>* is_;
+    basic_json_options<CharT> options_;
+    parallel_policy policy_;
+    size_t position_;
+    std::basic_string<CharT> buffer_;
+public:
+    basic_json_lines_reader(const string_view_type& s,
+                            const parallel_policy& policy)
+       : basic_json_lines_reader(s, basic_json_options<CharT>(), policy)
+    {
+    }
+
+    basic_json_lines_reader(const string_view_type& s,
+                            const basic_json_options<CharT>& options,
+                            const parallel_policy& policy)
+       : data_(s.data()),
+         length_(s.length()),
+         is_(nullptr),
+         options_(options),
+         policy_(policy),
+         position_(0)
+    {
+    }
+
+    basic_json_lines_reader(std::basic_istream<CharT>& is,
+                            const parallel_policy& policy)
+       : basic_json_lines_reader(is, basic_json_options<CharT>(), policy)
+    {
+    }
+
+    basic_json_lines_reader(std::basic_istream<CharT>& is,
+                            const basic_json_options<CharT>& options,
+                            const parallel_policy& policy)
+       : data_(nullptr),
+         length_(0),
+         is_(std::addressof(is)),
+         options_(options),
+         policy_(policy),
+         position_(0)
+    {
+    }
+
+    // Calls f(line, value) on the calling thread for each line in order
+    template <class Json,class F>
+    void read(F f)
+    {
+        detail::json_lines_error error = read_ordered<Json>(f);
+        if (error.ec)
+        {
+            throw serialization_error(error.ec,error.line,error.column);
+        }
+    }
+
+    template <class Json,class F>
+    void read(F f, std::error_code& ec)
+    {
+        ec = read_ordered<Json>(f).ec;
+    }
+
+    // Calls f(line, value) on the pool threads as lines are parsed, concurrently and in no
+    // particular order
+    template <class Json,class F>
+    void read_unordered(F f)
+    {
+        detail::json_lines_error error = read_concurrently<Json>(f);
+        if (error.ec)
+        {
+            throw serialization_error(error.ec,error.line,error.column);
+        }
+    }
+
+    template <class Json,class F>
+    void read_unordered(F f, std::error_code& ec)
+    {
+        ec = read_concurrently<Json>(f).ec;
+    }
+
+    // Sends each line, as a complete JSON text, to one of the handlers, with no more workers
+    // than handlers. A handler receives the lines of one chunk at a time, in order, and is
+    // not called concurrently with itself.
+    void read_unordered(const std::vector<basic_json_content_handler<CharT>*>& handlers)
+    {
+        detail::json_lines_error error = read_handlers(handlers);
+        if (error.ec)
+        {
+            throw serialization_error(error.ec,error.line,error.column);
+        }
+    }
+
+    void read_unordered(const std::vector<basic_json_content_handler<CharT>*>& handlers,
+                        std::error_code& ec)
+    {
+        ec = read_handlers(handlers).ec;
+    }
+
+private:
+    template <class Json,class F>
+    detail::json_lines_error read_ordered(F& f)
+    {
+        if (max_chunk_count() == 1)
+        {
+            // Parsed on the calling thread, in order
+            return read_concurrently<Json>(f);
+        }
+        std::vector<std::vector<std::pair<size_t,Json>>> results;
+        auto parse = [&](size_t index, const CharT* first, const CharT* last, size_t line,
+                         detail::json_lines_error& error)
+        {
+            auto& values = results[index];
+            values.clear();
+            json_decoder<Json> decoder(options_);
+            basic_json_parser<CharT,Allocator> parser(options_);
+            detail::parse_json_lines(parser, decoder, first, last, line,
+                                     [&](size_t n)
+                                     {
+                                         values.emplace_back(n, decoder.get_result());
+                                         decoder.reset();
+                                     },
+                                     error);
+        };
+        auto deliver = [&](size_t index)
+        {
+            for (auto& item : results[index])
+            {
+                f(item.first, std::move(item.second));
+            }
+            results[index].clear();
+        };
+        size_t max_chunks = max_chunk_count();
+        results.resize(max_chunks);
+        return read_chunks(max_chunks, parse, deliver);
+    }
+
+    template <class Json,class F>
+    detail::json_lines_error read_concurrently(F& f)
+    {
+        auto parse = [&](size_t, const CharT* first, const CharT* last, size_t line,
+                         detail::json_lines_error& error)
+        {
+            json_decoder<Json> decoder(options_);
+            basic_json_parser<CharT,Allocator> parser(options_);
+            detail::parse_json_lines(parser, decoder, first, last, line,
+                                     [&](size_t n)
+                                     {
+                                         f(n, decoder.get_result());
+                                         decoder.reset();
+                                     },
+                                     error);
+        };
+        return read_chunks(max_chunk_count(), parse, [](size_t){});
+    }
+
+    detail::json_lines_error read_handlers(const std::vector<basic_json_content_handler<CharT>*>& handlers)
+    {
+        auto parse = [&](size_t index, const CharT* first, const CharT* last, size_t line,
+                         detail::json_lines_error& error)
+        {
+            basic_json_parser<CharT,Allocator> parser(options_);
+            detail::parse_json_lines(parser, *handlers[index], first, last, line,
+                                     [](size_t){},
+                                     error);
+        };
+        size_t max_chunks = max_chunk_count();
+        if (handlers.size() < max_chunks)
+        {
+            max_chunks = handlers.size();
+        }
+        if (max_chunks == 0)
+        {
+            return detail::json_lines_error();
+        }
+        return read_chunks(max_chunks, parse, [](size_t){});
+    }
+
+    size_t max_chunk_count() const
+    {
+        return policy_.max_threads() > 0 ? policy_.max_threads() : 1;
+    }
+
+    // Parses the text a batch at a time. For each batch, calls parse(index, first, last, line, error)
+    // for each chunk on the pool, and then deliver(index) on the calling thread for the chunks in
+    // order, up to and including the first that failed.
+    template <class Parse,class Deliver>
+    detail::json_lines_error read_chunks(size_t max_chunks, Parse& parse, Deliver deliver)
+    {
+        size_t chunk_length = default_batch_chunk_length;
+        if (policy_.min_chunk_size() > chunk_length)
+        {
+            chunk_length = policy_.min_chunk_size();
+        }
+        size_t batch_length = max_chunks * chunk_length;
+
+        jsoncons::detail::thread_pool pool(max_chunks);
+        std::vector<size_t> splits;
+        std::vector<size_t> lines(max_chunks + 1);
+        std::vector<detail::json_lines_error> errors(max_chunks);
+        size_t line = 1;
+
+        const CharT* data;
+        size_t length;
+        detail::json_lines_error error;
+        while (next_batch(batch_length, data, length, error.ec))
+        {
+            size_t count = jsoncons::detail::chunk_count(length, max_chunks, policy_.min_chunk_size());
+            splits.resize(count + 1);
+            splits[0] = 0;
+            splits[count] = length;
+            for (size_t i = 1; i < count; ++i)
+            {
+                size_t nominal = static_cast<size_t>((static_cast<unsigned long long>(length) * i) / count);
+                const CharT* p = std::find(data + nominal, data + length, '\n');
+                splits[i] = p == data + length ? length : static_cast<size_t>(p - data) + 1;
+            }
+            splits.erase(std::unique(splits.begin(), splits.end()), splits.end());
+            count = splits.size() - 1;
+
+            // The number of the first line of each chunk
+            jsoncons::detail::parallel_for(pool, count, count,
+                [&](size_t i, size_t, size_t)
+                {
+                    lines[i+1] = static_cast<size_t>(std::count(data + splits[i], data + splits[i+1], '\n'));
+                });
+            lines[0] = line;
+            for (size_t i = 0; i < count; ++i)
+            {
+                lines[i+1] += lines[i];
+            }
+            line = lines[count];
+
+            jsoncons::detail::parallel_for(pool, count, count,
+                [&](size_t i, size_t, size_t)
+                {
+                    errors[i] = detail::json_lines_error();
+                    parse(i, data + splits[i], data + splits[i+1], lines[i], errors[i]);
+                });
+            for (size_t i = 0; i < count; ++i)
+            {
+                deliver(i);
+                if (errors[i].ec)
+                {
+                    return errors[i];
+                }
+            }
+        }
+        return error;
+    }
+
+    // Sets [data,data+length) to the next run of complete lines, at least batch_length long
+    // unless at the end of the text. Returns false at the end of the text or on a stream error.
+    bool next_batch(size_t batch_length, const CharT*& data, size_t& length, std::error_code& ec)
+    {
+        if (is_ == nullptr)
+        {
+            if (position_ >= length_)
+            {
+                return false;
+            }
+            size_t end = length_;
+            if (length_ - position_ > batch_length)
+            {
+                const CharT* p = std::find(data_ + position_ + batch_length, data_ + length_, '\n');
+                end = p == data_ + length_ ? length_ : static_cast<size_t>(p - data_) + 1;
+            }
+            data = data_ + position_;
+            length = end - position_;
+            position_ = end;
+            return true;
+        }
+
+        // Keep the partial line that followed the last batch
+        buffer_.erase(0, position_);
+        position_ = 0;
+        size_t end = 0;
+        while (end == 0 && is_->good())
+        {
+            size_t size = buffer_.size();
+            buffer_.resize(size + batch_length);
+            is_->read(&buffer_[size], static_cast<std::streamsize>(batch_length));
+            if (is_->bad())
+            {
+                ec = json_errc::source_error;
+                return false;
+            }
+            buffer_.resize(size + static_cast<size_t>(is_->gcount()));
+            size_t pos = buffer_.rfind('\n');
+            if (pos != std::basic_string<CharT>::npos && pos >= size)
+            {
+                end = pos + 1;
+            }
+        }
+        if (end == 0)
+        {
+            end = buffer_.size();
+        }
+        if (end == 0)
+        {
+            return false;
+        }
+        data = buffer_.data();
+        length = end;
+        position_ = end;
+        return true;
+    }
+};
+
+typedef basic_json_lines_reader<char> json_lines_reader;
+typedef basic_json_lines_reader<wchar_t> wjson_lines_reader;
+
+template <class Json>
+std::vector<Json> decode_json_lines(const typename Json::string_view_type& s,
+                                    const parallel_policy& policy = parallel_policy())
+{
+    std::vector<Json> values;
+    basic_json_lines_reader<typename Json::char_type> reader(s, policy);
+    reader.template read<Json>([&](size_t, Json&& value){values.push_back(std::move(value));});
+    return values;
+}
+
+template <class Json>
+std::vector<Json> decode_json_lines(std::basic_istream<typename Json::char_type>& is,
+                                    const parallel_policy& policy = parallel_policy())
+{
+    std::vector<Json> values;
+    basic_json_lines_reader<typename Json::char_type> reader(is, policy);
+    reader.template read<Json>([&](size_t, Json&& value){values.push_back(std::move(value));});
+    return values;
+}
+
+}
+
+#endif
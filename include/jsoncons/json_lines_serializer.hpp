@@ -0,0 +1,301 @@
+// Copyright 2013 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_JSON_LINES_SERIALIZER_HPP
+#define JSONCONS_JSON_LINES_SERIALIZER_HPP
+
+#include <string>
+#include <vector>
+#include <memory> // std::addressof
+#include <ostream> // std::basic_ostream
+#include <iterator> // std::distance
+#include <jsoncons/json_content_handler.hpp>
+#include <jsoncons/json_options.hpp>
+#include <jsoncons/json_serializer.hpp>
+#include <jsoncons/result.hpp>
+#include <jsoncons/parallel_policy.hpp>
+#include <jsoncons/detail/thread_pool.hpp>
+
+namespace jsoncons {
+
+// Writes newline delimited JSON (JSON Lines), each top level value compressed on a line of
+// its own. One serializer is kept for all lines, and the lines are collected in a buffer
+// that is written to the stream once it holds at least batch_length characters. flush(),
+// which basic_json::dump and the parsers call at the end of each value, doesn't write the
+// buffer, flush_buffer() and the destructor do.
+
+template<class CharT>
+class basic_json_lines_serializer final : public basic_json_content_handler<CharT>
+{
+public:
+    typedef CharT char_type;
+    using typename basic_json_content_handler<CharT>::string_view_type;
+    typedef std::basic_string<CharT> string_type;
+private:
+    typedef basic_json_compressed_serializer<CharT,jsoncons::string_result<string_type>> line_serializer_type;
+
+    static const size_t default_batch_length = 65536;
+
+    // Noncopyable and nonmoveable
+    basic_json_lines_serializer(const basic_json_lines_serializer&) = delete;
+    basic_json_lines_serializer& operator=(const basic_json_lines_serializer&) = delete;
+
+    std::basic_ostream<CharT>* os_;
+    basic_json_options<CharT> options_;
+    size_t batch_length_;
+    string_type buffer_;
+    line_serializer_type serializer_;
+    size_t depth_;
+    std::vector<string_type> chunks_;
+public:
+    basic_json_lines_serializer(std::basic_ostream<CharT>& os)
+        : basic_json_lines_serializer(os, basic_json_options<CharT>())
+    {
+    }
+
+    basic_json_lines_serializer(std::basic_ostream<CharT>& os,
+                                const basic_json_options<CharT>& options)
+        : basic_json_lines_serializer(os, options, default_batch_length)
+    {
+    }
+
+    basic_json_lines_serializer(std::basic_ostream<CharT>& os,
+                                const basic_json_options<CharT>& options,
+                                size_t batch_length)
+       : os_(std::addressof(os)),
+         options_(options),
+         batch_length_(batch_length),
+         serializer_(jsoncons::string_result<string_type>(buffer_), options),
+         depth_(0)
+    {
+        buffer_.reserve(batch_length_);
+    }
+
+    ~basic_json_lines_serializer()
+    {
+        try
+        {
+            flush_buffer();
+        }
+        catch (...)
+        {
+        }
+    }
+
+    // Writes value on a line
+    template <class Json>
+    void write(const Json& value)
+    {
+        value.dump(serializer_);
+        end_line();
+    }
+
+    // Writes the values in [first,last), each on a line. The lines are encoded on a thread pool,
+    // a batch at a time, each chunk of a batch into a buffer of its own, and the buffers are
+    // written to the stream in order.
+    template <class RandomAccessIterator>
+    void write(RandomAccessIterator first, RandomAccessIterator last, const parallel_policy& policy)
+    {
+        size_t max_chunks = policy.max_threads() > 0 ? policy.max_threads() : 1;
+        size_t min_chunk_size = policy.min_chunk_size() > 0 ? policy.min_chunk_size() : 1;
+        size_t batch_size = max_chunks * min_chunk_size;
+        size_t count = static_cast<size_t>(std::distance(first, last));
+        if (jsoncons::detail::chunk_count(count, max_chunks, min_chunk_size) <= 1)
+        {
+            for (; first != last; ++first)
+            {
+                write(*first);
+            }
+            return;
+        }
+
+        write_buffer();
+        jsoncons::detail::thread_pool pool(max_chunks);
+        chunks_.resize(max_chunks);
+        while (count > 0)
+        {
+            size_t n = count < batch_size ? count : batch_size;
+            size_t chunk_count = jsoncons::detail::chunk_count(n, max_chunks, min_chunk_size);
+            jsoncons::detail::parallel_for(pool, n, chunk_count,
+                [&](size_t i, size_t begin, size_t end)
+                {
+                    string_type& chunk = chunks_[i];
+                    chunk.clear();
+                    line_serializer_type serializer(jsoncons::string_result<string_type>(chunk), options_);
+                    for (size_t j = begin; j < end; ++j)
+                    {
+                        first[j].dump(serializer);
+                        chunk.push_back('\n');
+                        serializer.reset();
+                    }
+                });
+            for (size_t i = 0; i < chunk_count; ++i)
+            {
+                os_->write(chunks_[i].data(), chunks_[i].size());
+            }
+            first += n;
+            count -= n;
+        }
+    }
+
+    // Writes the buffered lines to the stream, and flushes the stream
+    void flush_buffer()
+    {
+        write_buffer();
+        os_->flush();
+    }
+
+private:
+    void write_buffer()
+    {
+        if (!buffer_.empty())
+        {
+            os_->write(buffer_.data(), buffer_.size());
+            buffer_.clear();
+        }
+    }
+
+    void end_line()
+    {
+        buffer_.push_back('\n');
+        serializer_.reset();
+        if (buffer_.size() >= batch_length_)
+        {
+            write_buffer();
+        }
+    }
+
+    bool end_value()
+    {
+        if (depth_ == 0)
+        {
+            end_line();
+        }
+        return true;
+    }
+
+    void do_flush() override
+    {
+    }
+
+    bool do_begin_object(semantic_tag_type tag, const serializing_context& context) override
+    {
+        ++depth_;
+        return serializer_.begin_object(tag, context);
+    }
+
+    bool do_begin_object(size_t length, semantic_tag_type tag, const serializing_context& context) override
+    {
+        ++depth_;
+        return serializer_.begin_object(length, tag, context);
+    }
+
+    bool do_end_object(const serializing_context& context) override
+    {
+        serializer_.end_object(context);
+        --depth_;
+        return end_value();
+    }
+
+    bool do_begin_array(semantic_tag_type tag, const serializing_context& context) override
+    {
+        ++depth_;
+        return serializer_.begin_array(tag, context);
+    }
+
+    bool do_begin_array(size_t length, semantic_tag_type tag, const serializing_context& context) override
+    {
+        ++depth_;
+        return serializer_.begin_array(length, tag, context);
+    }
+
+    bool do_end_array(const serializing_context& context) override
+    {
+        serializer_.end_array(context);
+        --depth_;
+        return end_value();
+    }
+
+    bool do_name(const string_view_type& name, const serializing_context& context) override
+    {
+        return serializer_.name(name, context);
+    }
+
+    bool do_null_value(semantic_tag_type tag, const serializing_context& context) override
+    {
+        serializer_.null_value(tag, context);
+        return end_value();
+    }
+
+    bool do_string_value(const string_view_type& value, semantic_tag_type tag, const serializing_context& context) override
+    {
+        serializer_.string_value(value, tag, context);
+        return end_value();
+    }
+
+    bool do_byte_string_value(const byte_string_view& b,
+                              semantic_tag_type tag,
+                              const serializing_context& context) override
+    {
+        serializer_.byte_string_value(b, tag, context);
+        return end_value();
+    }
+
+    bool do_double_value(double value,
+                         semantic_tag_type tag,
+                         const serializing_context& context) override
+    {
+        serializer_.double_value(value, tag, context);
+        return end_value();
+    }
+
+    bool do_int64_value(int64_t value,
+                        semantic_tag_type tag,
+                        const serializing_context& context) override
+    {
+        serializer_.int64_value(value, tag, context);
+        return end_value();
+    }
+
+    bool do_uint64_value(uint64_t value,
+                         semantic_tag_type tag,
+                         const serializing_context& context) override
+    {
+        serializer_.uint64_value(value, tag, context);
+        return end_value();
+    }
+
+    bool do_bool_value(bool value, semantic_tag_type tag, const serializing_context& context) override
+    {
+        serializer_.bool_value(value, tag, context);
+        return end_value();
+    }
+
+    bool do_typed_array(const int64_t* data, size_t size, semantic_tag_type tag, const serializing_context& context) override
+    {
+        serializer_.typed_array(data, size, tag, context);
+        return end_value();
+    }
+
+    bool do_typed_array(const uint64_t* data, size_t size, semantic_tag_type tag, const serializing_context& context) override
+    {
+        serializer_.typed_array(data, size, tag, context);
+        return end_value();
+    }
+
+    bool do_typed_array(const double* data, size_t size, semantic_tag_type tag, const serializing_context& context) override
+    {
+        serializer_.typed_array(data, size, tag, context);
+        return end_value();
+    }
+};
+
+typedef basic_json_lines_serializer<char> json_lines_serializer;
+typedef basic_json_lines_serializer<wchar_t> wjson_lines_serializer;
+
+}
+
+#endif
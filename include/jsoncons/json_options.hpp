@@ -107,6 +107,8 @@ public:
     virtual std::basic_string<CharT> neginf_to_str() const = 0;
 
     virtual bool lossless_number() const = 0;
+
+    virtual bool typed_arrays() const = 0;
 };
 
 template <class CharT>
@@ -232,6 +234,7 @@ private:
     std::basic_string<CharT> neginf_to_str_;
 
     bool lossless_number_;
+    bool typed_arrays_;
 public:
     static const size_t indent_size_default = 4;
     static const size_t line_length_limit_default = 120;
@@ -270,7 +273,8 @@ public:
           is_str_to_nan_(false),
           is_str_to_inf_(false),
           is_str_to_neginf_(false),
-          lossless_number_(false)
+          lossless_number_(false),
+          typed_arrays_(false)
     {
         new_line_chars_.push_back('\n');
     }
@@ -593,6 +597,17 @@ public:
         return *this;
     }
 
+    bool typed_arrays() const override
+    {
+        return typed_arrays_;
+    }
+
+    basic_json_options<CharT>& typed_arrays(bool value) 
+    {
+        typed_arrays_ = value;
+        return *this;
+    }
+
     size_t line_length_limit() const override
     {
         return line_length_limit_;
@@ -0,0 +1,489 @@
+// Copyright 2013 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_JSON_PARALLEL_READER_HPP
+#define JSONCONS_JSON_PARALLEL_READER_HPP
+
+#include <string>
+#include <vector>
+#include <memory> // std::allocator
+#include <utility> // std::move
+#include <algorithm> // std::unique
+#include <stdexcept>
+#include <system_error>
+#include <jsoncons/json_exception.hpp>
+#include <jsoncons/json_options.hpp>
+#include <jsoncons/json_parser.hpp>
+#include <jsoncons/json_decoder.hpp>
+#include <jsoncons/parallel_policy.hpp>
+#include <jsoncons/detail/thread_pool.hpp>
+#include <jsoncons/detail/unicode_traits.hpp>
+#include <jsoncons/detail/char_scanner.hpp>
+
+namespace jsoncons {
+
+namespace detail {
+
+// Whether the quote at data[i] is escaped by an odd number of backslashes before it
+
+template <class CharT>
+bool is_escaped_quote(const CharT* data, size_t i)
+{
+    size_t n = 0;
+    while (i > 0 && data[i-1] == '\\')
+    {
+        ++n;
+        --i;
+    }
+    return (n & 1) != 0;
+}
+
+// What a segment of JSON text contributes to the string state and nesting depth. Quotes
+// that aren't escaped toggle the state, so depth[p] and slash[p] are the change in depth
+// and whether there's a '/' over the parts of the segment where the parity of the quotes
+// seen so far is p. If the segment starts outside a string, those with p == 0 are outside
+// strings, otherwise those with p == 1.
+
+struct json_segment_scan
+{
+    bool odd;
+    long long depth[2];
+    bool slash[2];
+
+    json_segment_scan()
+        : odd(false), depth{0,0}, slash{false,false}
+    {
+    }
+};
+
+// Scans the quotes, brackets and slashes of a segment, skipping the characters between
+// them a block at a time
+
+template <class CharT>
+json_segment_scan scan_json_segment(const CharT* data, size_t first, size_t last)
+{
+    char_scanner<CharT> scanner;
+    scanner.add('\"');
+    scanner.add('[');
+    scanner.add('{');
+    scanner.add(']');
+    scanner.add('}');
+    scanner.add('/');
+
+    json_segment_scan scan;
+    size_t p = 0;
+    const CharT* end = data + last;
+    for (const CharT* it = scanner.find_first(data + first, end); it != end; it = scanner.find_first(it + 1, end))
+    {
+        switch (*it)
+        {
+            case '\"':
+                if (!is_escaped_quote(data, static_cast<size_t>(it - data)))
+                {
+                    p ^= 1;
+                }
+                break;
+            case '[':
+            case '{':
+                ++scan.depth[p];
+                break;
+            case ']':
+            case '}':
+                --scan.depth[p];
+                break;
+            default: // '/'
+                scan.slash[p] = true;
+                break;
+        }
+    }
+    scan.odd = p != 0;
+    return scan;
+}
+
+// Offset of the first comma at or after first that separates elements of the top level array,
+// given whether first is inside a string and the nesting depth there, or length if there's none.
+// Inside a string only the closing quote is looked for.
+
+template <class CharT>
+size_t next_element_boundary(const CharT* data, size_t first, size_t length, bool quoted, long long depth)
+{
+    char_scanner<CharT> quote_scanner;
+    quote_scanner.add('\"');
+
+    char_scanner<CharT> scanner;
+    scanner.add('\"');
+    scanner.add('[');
+    scanner.add('{');
+    scanner.add(']');
+    scanner.add('}');
+    scanner.add(',');
+
+    const CharT* end = data + length;
+    const CharT* it = data + first;
+    while ((it = (quoted ? quote_scanner : scanner).find_first(it, end)) != end)
+    {
+        switch (*it)
+        {
+            case '\"':
+                if (!is_escaped_quote(data, static_cast<size_t>(it - data)))
+                {
+                    quoted = !quoted;
+                }
+                break;
+            case '[':
+            case '{':
+                ++depth;
+                break;
+            case ']':
+            case '}':
+                if (--depth <= 0)
+                {
+                    return length;
+                }
+                break;
+            default: // ','
+                if (depth == 1)
+                {
+                    return static_cast<size_t>(it - data);
+                }
+                break;
+        }
+        ++it;
+    }
+    return length;
+}
+
+// Finds the commas between elements of the top level array at which to split the text
+// [first,length) into count chunks, scanning count segments on the pool. Returns false
+// if the text should be parsed serially instead: it doesn't start with an array, it has
+// comments, or it doesn't split.
+
+template <class CharT>
+bool find_json_array_splits(const CharT* data,
+                            size_t first,
+                            size_t length,
+                            size_t count,
+                            jsoncons::detail::thread_pool& pool,
+                            size_t thread_count,
+                            std::vector<size_t>& splits)
+{
+    size_t start = first;
+    while (start < length && (data[start] == ' ' || data[start] == '\t' || data[start] == '\r' || data[start] == '\n'))
+    {
+        ++start;
+    }
+    if (start == length || data[start] != '[')
+    {
+        return false;
+    }
+
+    std::vector<size_t> nominal(count + 1);
+    for (size_t i = 0; i <= count; ++i)
+    {
+        nominal[i] = first + static_cast<size_t>((static_cast<unsigned long long>(length - first) * i) / count);
+    }
+    std::vector<json_segment_scan> scans(count);
+    jsoncons::detail::parallel_for(pool, count, thread_count < count ? thread_count : count,
+        [&](size_t, size_t begin, size_t end)
+        {
+            for (size_t i = begin; i < end; ++i)
+            {
+                scans[i] = scan_json_segment(data, nominal[i], nominal[i+1]);
+            }
+        });
+
+    // The string state and depth at the start of each segment
+    std::vector<char> quoted(count, 0);
+    std::vector<long long> depth(count, 0);
+    bool q = false;
+    long long d = 0;
+    for (size_t i = 0; i < count; ++i)
+    {
+        quoted[i] = q;
+        depth[i] = d;
+        size_t p = q ? 1 : 0;
+        if (scans[i].slash[p])
+        {
+            return false;
+        }
+        d += scans[i].depth[p];
+        q = q != scans[i].odd;
+    }
+
+    splits.resize(count - 1);
+    jsoncons::detail::parallel_for(pool, count - 1, thread_count < count - 1 ? thread_count : count - 1,
+        [&](size_t, size_t begin, size_t end)
+        {
+            for (size_t i = begin; i < end; ++i)
+            {
+                splits[i] = next_element_boundary(data, nominal[i+1], length, quoted[i+1] != 0, depth[i+1]);
+            }
+        });
+    for (size_t i = 1; i < splits.size(); ++i)
+    {
+        if (splits[i] < splits[i-1])
+        {
+            splits[i] = splits[i-1];
+        }
+    }
+    splits.erase(std::unique(splits.begin(), splits.end()), splits.end());
+    if (!splits.empty() && splits.back() == length)
+    {
+        splits.pop_back();
+    }
+    return !splits.empty();
+}
+
+}
+
+// Parses JSON text held in memory, such as a string or a memory mapped file. If the text is
+// an array, it is split at commas between its elements into chunks that are parsed on a
+// thread pool, each chunk with its own parser and decoder. The split points are found with
+// a pre-scan that tracks strings and nesting depth, and each chunk is parsed as an array of
+// its own, which only succeeds if the chunk holds whole elements. Text that isn't an array,
+// has comments, or has a chunk that fails to parse, is parsed serially.
+
+template<class CharT,class Allocator=std::allocator<char>>
+class basic_json_parallel_reader
+{
+public:
+    typedef CharT char_type;
+    typedef basic_string_view<CharT> string_view_type;
+private:
+    // The elements are delivered by read_elements after each batch of chunks this long
+    static const size_t default_element_chunk_length = 1024*1024;
+
+    basic_json_parallel_reader(const basic_json_parallel_reader&) = delete;
+    basic_json_parallel_reader& operator = (const basic_json_parallel_reader&) = delete;
+
+    string_view_type s_;
+    basic_json_options<CharT> options_;
+    parallel_policy policy_;
+public:
+    basic_json_parallel_reader(const string_view_type& s,
+                               const parallel_policy& policy)
+       : basic_json_parallel_reader(s, basic_json_options<CharT>(), policy)
+    {
+    }
+
+    basic_json_parallel_reader(const string_view_type& s,
+                               const basic_json_options<CharT>& options,
+                               const parallel_policy& policy)
+       : s_(s),
+         options_(options),
+         policy_(policy)
+    {
+    }
+
+    // Returns the value of the text
+    template <class Json>
+    Json read()
+    {
+        std::vector<Json> chunks;
+        if (!read_chunks(0, chunks))
+        {
+            return read_serially<Json>();
+        }
+        size_t size = 0;
+        for (const auto& chunk : chunks)
+        {
+            size += chunk.size();
+        }
+        Json result = std::move(chunks[0]);
+        result.reserve(size);
+        for (size_t i = 1; i < chunks.size(); ++i)
+        {
+            for (auto& element : chunks[i].array_range())
+            {
+                result.push_back(std::move(element));
+            }
+        }
+        return result;
+    }
+
+    // Calls f(index, element) on the calling thread for the elements of the array, in order.
+    // With a parallel parse, the chunks are parsed a batch at a time, and the elements of
+    // a batch are delivered before the next is parsed.
+    template <class Json,class F>
+    void read_elements(F f)
+    {
+        size_t chunk_length = default_element_chunk_length;
+        if (policy_.min_chunk_size() > chunk_length)
+        {
+            chunk_length = policy_.min_chunk_size();
+        }
+        size_t index = 0;
+        std::vector<Json> chunks;
+        if (!read_chunks(chunk_length, chunks,
+                         [&](std::vector<Json>& batch)
+                         {
+                             for (auto& chunk : batch)
+                             {
+                                 for (auto& element : chunk.array_range())
+                                 {
+                                     f(index++, std::move(element));
+                                 }
+                                 chunk = Json();
+                             }
+                         }))
+        {
+            // The elements not yet delivered
+            Json value = read_serially<Json>();
+            if (!value.is_array())
+            {
+                JSONCONS_THROW(json_exception_impl<std::runtime_error>("Not an array"));
+            }
+            for (size_t i = index; i < value.size(); ++i)
+            {
+                f(i, std::move(value[i]));
+            }
+        }
+    }
+
+private:
+    template <class Json>
+    bool read_chunks(size_t chunk_length, std::vector<Json>& chunks)
+    {
+        return read_chunks(chunk_length, chunks, [](std::vector<Json>&){});
+    }
+
+    // Splits the text into chunks, of about chunk_length characters if not 0, and parses
+    // them a batch of max_threads at a time, or all at once if chunk_length is 0, passing
+    // each batch to deliver. Returns false if the rest of the text should be read serially.
+    template <class Json,class Deliver>
+    bool read_chunks(size_t chunk_length, std::vector<Json>& chunks, Deliver deliver)
+    {
+        const CharT* data = s_.data();
+        size_t length = s_.length();
+        size_t thread_count = policy_.max_threads();
+        size_t count = jsoncons::detail::chunk_count(length, thread_count, policy_.min_chunk_size());
+        if (count <= 1)
+        {
+            return false;
+        }
+        if (chunk_length > 0 && length / chunk_length > count)
+        {
+            count = length / chunk_length;
+        }
+
+        auto result = unicons::skip_bom(s_.begin(), s_.end());
+        if (result.ec != unicons::encoding_errc())
+        {
+            return false;
+        }
+        size_t first = result.it - s_.begin();
+
+        jsoncons::detail::thread_pool pool(thread_count);
+        std::vector<size_t> splits;
+        if (!detail::find_json_array_splits(data, first, length, count, pool, thread_count, splits))
+        {
+            return false;
+        }
+        count = splits.size() + 1;
+
+        size_t batch_size = chunk_length > 0 ? thread_count : count;
+        std::vector<char> failed(batch_size, 0);
+        for (size_t batch = 0; batch < count; batch += batch_size)
+        {
+            size_t n = count - batch < batch_size ? count - batch : batch_size;
+            chunks.resize(n);
+            jsoncons::detail::parallel_for(pool, n, n < thread_count ? n : thread_count,
+                [&](size_t, size_t begin, size_t end)
+                {
+                    for (size_t i = begin; i < end; ++i)
+                    {
+                        size_t k = batch + i;
+                        size_t chunk_first = k == 0 ? first : splits[k-1] + 1;
+                        size_t chunk_last = k + 1 == count ? length : splits[k];
+                        failed[i] = parse_chunk(data + chunk_first, data + chunk_last, k > 0, k + 1 < count, chunks[i]) ? 0 : 1;
+                    }
+                });
+            for (size_t i = 0; i < n; ++i)
+            {
+                if (failed[i])
+                {
+                    return false;
+                }
+            }
+            deliver(chunks);
+        }
+        return true;
+    }
+
+    // Parses [first,last) as an array, with an opening bracket before it if open and a closing
+    // bracket after it if close. Returns false if that fails or the array is empty.
+    template <class Json>
+    bool parse_chunk(const CharT* first, const CharT* last, bool open, bool close, Json& result)
+    {
+        static const CharT open_bracket = '[';
+        static const CharT close_bracket = ']';
+
+        json_decoder<Json> decoder(options_);
+        basic_json_parser<CharT,Allocator> parser(options_);
+        std::error_code ec;
+        try
+        {
+            if (open)
+            {
+                parser.update(&open_bracket, 1);
+                parser.parse_some(decoder, ec);
+                if (ec || first == last)
+                {
+                    return false;
+                }
+            }
+            parser.update(first, static_cast<size_t>(last - first));
+            parser.parse_some(decoder, ec);
+            if (ec)
+            {
+                return false;
+            }
+            if (close)
+            {
+                parser.update(&close_bracket, 1);
+                parser.parse_some(decoder, ec);
+                if (ec)
+                {
+                    return false;
+                }
+            }
+            while (!parser.finished())
+            {
+                parser.parse_some(decoder, ec);
+                if (ec)
+                {
+                    return false;
+                }
+            }
+            parser.check_done(ec);
+        }
+        catch (const std::exception&)
+        {
+            // Left to a serial read, which reports it with the right position
+            return false;
+        }
+        if (ec || !decoder.is_valid())
+        {
+            return false;
+        }
+        result = decoder.get_result();
+        // A chunk is next to a comma, and so holds at least one element
+        return result.is_array() && !result.empty();
+    }
+
+    template <class Json>
+    Json read_serially()
+    {
+        return Json::parse(s_, options_);
+    }
+};
+
+typedef basic_json_parallel_reader<char> json_parallel_reader;
+typedef basic_json_parallel_reader<wchar_t> wjson_parallel_reader;
+
+}
+
+#endif
@@ -184,6 +184,8 @@ class basic_json_parser : private serializing_context
     json_parse_state state_;
     bool continue_;
     bool done_;
+    size_t skip_depth_;
+    json_parse_state skip_state_;
 
     std::basic_string<CharT,std::char_traits<CharT>,char_allocator_type> string_buffer_;
     jsoncons::detail::string_to_double to_double_;
@@ -233,7 +235,9 @@ public:
          input_ptr_(nullptr),
          state_(json_parse_state::start),
          continue_(true),
-         done_(false)
+         done_(false),
+         skip_depth_(0),
+         skip_state_(json_parse_state::expect_value)
     {
         string_buffer_.reserve(initial_string_buffer_capacity_);
 
@@ -485,6 +489,7 @@ public:
         line_ = 1;
         column_ = 1;
         nesting_depth_ = 0;
+        skip_depth_ = 0;
     }
 
     void restart()
@@ -572,6 +577,184 @@ public:
         }
     }
 
+    // Skipping scans past the rest of the array or object whose begin event was the last
+    // one reported, matching brackets without converting numbers or unescaping strings,
+    // and then reports the end event. Only the final closing bracket is checked against
+    // the container, the skipped content is otherwise accepted as long as its brackets
+    // balance outside of strings and comments.
+
+    void begin_skip()
+    {
+        skip_depth_ = 1;
+        skip_state_ = json_parse_state::expect_value;
+    }
+
+    bool skipping() const
+    {
+        return skip_depth_ > 0;
+    }
+
+    void skip_some(basic_json_content_handler<CharT>& handler, std::error_code& ec)
+    {
+        const CharT* local_input_end = input_end_;
+
+        if (input_ptr_ == local_input_end)
+        {
+            skip_depth_ = 0;
+            err_handler_.fatal_error(json_errc::unexpected_eof, *this);
+            ec = json_errc::unexpected_eof;
+            continue_ = false;
+            return;
+        }
+
+        while (input_ptr_ < local_input_end)
+        {
+            switch (skip_state_)
+            {
+                case json_parse_state::expect_value:
+                    while (input_ptr_ < local_input_end && skip_state_ == json_parse_state::expect_value)
+                    {
+                        switch (*input_ptr_)
+                        {
+                            case '\"':
+                                skip_state_ = json_parse_state::string;
+                                break;
+                            case '[':
+                            case '{':
+                                ++skip_depth_;
+                                break;
+                            case ']':
+                            case '}':
+                                if (--skip_depth_ == 0)
+                                {
+                                    if (*input_ptr_ == ']')
+                                    {
+                                        end_array(handler, ec);
+                                    }
+                                    else
+                                    {
+                                        end_object(handler, ec);
+                                    }
+                                    if (ec) return;
+                                    ++input_ptr_;
+                                    ++column_;
+                                    return;
+                                }
+                                break;
+                            case '/':
+                                skip_state_ = json_parse_state::slash;
+                                break;
+                            case '\r':
+                                skip_cr();
+                                continue;
+                            case '\n':
+                                ++input_ptr_;
+                                ++line_;
+                                column_ = 1;
+                                continue;
+                            default:
+                                break;
+                        }
+                        ++input_ptr_;
+                        ++column_;
+                    }
+                    break;
+                case json_parse_state::string:
+                    while (input_ptr_ < local_input_end && *input_ptr_ != '\"' && *input_ptr_ != '\\')
+                    {
+                        ++input_ptr_;
+                        ++column_;
+                    }
+                    if (input_ptr_ < local_input_end)
+                    {
+                        skip_state_ = *input_ptr_ == '\"' ? json_parse_state::expect_value : json_parse_state::escape;
+                        ++input_ptr_;
+                        ++column_;
+                    }
+                    break;
+                case json_parse_state::escape:
+                    skip_state_ = json_parse_state::string;
+                    ++input_ptr_;
+                    ++column_;
+                    break;
+                case json_parse_state::slash:
+                    switch (*input_ptr_)
+                    {
+                        case '*':
+                            skip_state_ = json_parse_state::slash_star;
+                            ++input_ptr_;
+                            ++column_;
+                            break;
+                        case '/':
+                            skip_state_ = json_parse_state::slash_slash;
+                            ++input_ptr_;
+                            ++column_;
+                            break;
+                        default:
+                            skip_state_ = json_parse_state::expect_value;
+                            break;
+                    }
+                    break;
+                case json_parse_state::slash_slash:
+                    while (input_ptr_ < local_input_end && *input_ptr_ != '\r' && *input_ptr_ != '\n')
+                    {
+                        ++input_ptr_;
+                        ++column_;
+                    }
+                    if (input_ptr_ < local_input_end)
+                    {
+                        skip_state_ = json_parse_state::expect_value;
+                    }
+                    break;
+                case json_parse_state::slash_star:
+                    switch (*input_ptr_)
+                    {
+                        case '*':
+                            skip_state_ = json_parse_state::slash_star_star;
+                            break;
+                        case '\r':
+                            skip_cr();
+                            continue;
+                        case '\n':
+                            ++input_ptr_;
+                            ++line_;
+                            column_ = 1;
+                            continue;
+                    }
+                    ++input_ptr_;
+                    ++column_;
+                    break;
+                case json_parse_state::slash_star_star:
+                    switch (*input_ptr_)
+                    {
+                        case '/':
+                            skip_state_ = json_parse_state::expect_value;
+                            ++input_ptr_;
+                            ++column_;
+                            break;
+                        case '*':
+                            ++input_ptr_;
+                            ++column_;
+                            break;
+                        default:
+                            skip_state_ = json_parse_state::slash_star;
+                            break;
+                    }
+                    break;
+                case json_parse_state::cr:
+                    if (*input_ptr_ == '\n')
+                    {
+                        ++input_ptr_;
+                    }
+                    skip_state_ = pop_state();
+                    break;
+                default:
+                    JSONCONS_ASSERT(false);
+                    break;
+            }
+        }
+    }
+
     void finish_parse(basic_json_content_handler<CharT>& handler)
     {
         std::error_code ec;
@@ -2830,6 +3013,26 @@ private:
         }
     }
 
+    // Counts a line break that may be followed by a '\n' in the next buffer
+    void skip_cr()
+    {
+        ++input_ptr_;
+        ++line_;
+        column_ = 1;
+        if (input_ptr_ < input_end_)
+        {
+            if (*input_ptr_ == '\n')
+            {
+                ++input_ptr_;
+            }
+        }
+        else
+        {
+            push_state(skip_state_);
+            skip_state_ = json_parse_state::cr;
+        }
+    }
+
     void push_state(json_parse_state state)
     {
         state_stack_.push_back(state);
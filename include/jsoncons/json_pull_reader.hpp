@@ -29,14 +29,28 @@ public:
     using typename basic_json_content_handler<CharT>::string_view_type;
 private:
     basic_staj_event<CharT> event_;
+
+    // A typed array is stored and reported as begin_array, one event per element, 
+    // and end_array, with each call to advance_typed_array() moving to the next
+    std::vector<int64_t> int64_array_;
+    std::vector<uint64_t> uint64_array_;
+    std::vector<double> double_array_;
+    staj_event_type typed_array_element_type_;
+    size_t typed_array_size_;
+    size_t typed_array_index_;
+    bool in_typed_array_;
 public:
     basic_staj_event_handler()
-        : event_(staj_event_type::null_value)
+        : basic_staj_event_handler(staj_event_type::null_value)
     {
     }
 
     basic_staj_event_handler(staj_event_type event_type)
-        : event_(event_type)
+        : event_(event_type),
+          typed_array_element_type_(staj_event_type::null_value),
+          typed_array_size_(0),
+          typed_array_index_(0),
+          in_typed_array_(false)
     {
     }
 
@@ -44,11 +58,69 @@ public:
     {
         return event_;
     }
+
+    bool in_typed_array() const
+    {
+        return in_typed_array_;
+    }
+
+    void advance_typed_array()
+    {
+        if (typed_array_index_ < typed_array_size_)
+        {
+            switch (typed_array_element_type_)
+            {
+                case staj_event_type::int64_value:
+                    event_ = basic_staj_event<CharT>(int64_array_[typed_array_index_], semantic_tag_type::none);
+                    break;
+                case staj_event_type::uint64_value:
+                    event_ = basic_staj_event<CharT>(uint64_array_[typed_array_index_], semantic_tag_type::none);
+                    break;
+                default:
+                    event_ = basic_staj_event<CharT>(double_array_[typed_array_index_], semantic_tag_type::none);
+                    break;
+            }
+            ++typed_array_index_;
+        }
+        else
+        {
+            event_ = basic_staj_event<CharT>(staj_event_type::end_array);
+            in_typed_array_ = false;
+        }
+    }
 private:
+    template <class T>
+    bool begin_typed_array(const T* data, size_t size, std::vector<T>& v,
+                           staj_event_type element_type, semantic_tag_type tag)
+    {
+        v.assign(data, data+size);
+        typed_array_element_type_ = element_type;
+        typed_array_size_ = size;
+        typed_array_index_ = 0;
+        in_typed_array_ = true;
+        event_ = basic_staj_event<CharT>(staj_event_type::begin_array, tag);
+        return false;
+    }
+
+    bool do_typed_array(const int64_t* data, size_t size, semantic_tag_type tag, const serializing_context&) override
+    {
+        return begin_typed_array(data, size, int64_array_, staj_event_type::int64_value, tag);
+    }
+
+    bool do_typed_array(const uint64_t* data, size_t size, semantic_tag_type tag, const serializing_context&) override
+    {
+        return begin_typed_array(data, size, uint64_array_, staj_event_type::uint64_value, tag);
+    }
+
+    bool do_typed_array(const double* data, size_t size, semantic_tag_type tag, const serializing_context&) override
+    {
+        return begin_typed_array(data, size, double_array_, staj_event_type::double_value, tag);
+    }
+
 
-    bool do_begin_object(semantic_tag_type, const serializing_context&) override
+    bool do_begin_object(semantic_tag_type tag, const serializing_context&) override
     {
-        event_ = basic_staj_event<CharT>(staj_event_type::begin_object);
+        event_ = basic_staj_event<CharT>(staj_event_type::begin_object, tag);
         return false;
     }
 
@@ -58,9 +130,9 @@ private:
         return false;
     }
 
-    bool do_begin_array(semantic_tag_type, const serializing_context&) override
+    bool do_begin_array(semantic_tag_type tag, const serializing_context&) override
     {
-        event_ = basic_staj_event<CharT>(staj_event_type::begin_array);
+        event_ = basic_staj_event<CharT>(staj_event_type::begin_array, tag);
         return false;
     }
 
@@ -76,9 +148,9 @@ private:
         return false;
     }
 
-    bool do_null_value(semantic_tag_type, const serializing_context&) override
+    bool do_null_value(semantic_tag_type tag, const serializing_context&) override
     {
-        event_ = basic_staj_event<CharT>(staj_event_type::null_value);
+        event_ = basic_staj_event<CharT>(staj_event_type::null_value, tag);
         return false;
     }
 
@@ -94,11 +166,12 @@ private:
         return false;
     }
 
-    bool do_byte_string_value(const byte_string_view&, 
-                              semantic_tag_type,
+    bool do_byte_string_value(const byte_string_view& b, 
+                              semantic_tag_type tag,
                               const serializing_context&) override
     {
-        JSONCONS_UNREACHABLE();
+        event_ = basic_staj_event<CharT>(b.data(), b.length(), tag);
+        return false;
     }
 
     bool do_int64_value(int64_t value, 
@@ -146,7 +219,7 @@ class basic_json_pull_reader : public basic_staj_reader<CharT>, private virtual
 
     basic_json_parser<CharT,Allocator> parser_;
     basic_null_istream<CharT> null_is_;
-    std::basic_istream<CharT>& is_;
+    std::basic_istream<CharT>* is_;
     basic_staj_filter<CharT>& filter_;
     bool eof_;
     std::vector<CharT,char_allocator_type> buffer_;
@@ -203,7 +276,7 @@ public:
                              const basic_json_read_options<CharT>& options,
                              parse_error_handler& err_handler)
        : parser_(options,err_handler),
-         is_(is),
+         is_(std::addressof(is)),
          filter_(filter),
          eof_(false),
          buffer_length_(default_max_buffer_length),
@@ -266,7 +339,7 @@ public:
                              parse_error_handler& err_handler,
                              std::error_code& ec)
        : parser_(options,err_handler),
-         is_(is),
+         is_(std::addressof(is)),
          filter_(filter),
          eof_(false),
          buffer_length_(default_max_buffer_length),
@@ -322,7 +395,7 @@ public:
                            const basic_json_read_options<CharT>& options,
                            parse_error_handler& err_handler)
        : parser_(options,err_handler),
-         is_(null_is_),
+         is_(std::addressof(null_is_)),
          filter_(filter),
          eof_(false),
          buffer_(s.begin(), s.end()),
@@ -386,7 +459,7 @@ public:
                              parse_error_handler& err_handler,
                              std::error_code& ec)
        : parser_(options,err_handler),
-         is_(null_is_),
+         is_(std::addressof(null_is_)),
          filter_(filter),
          eof_(false),
          buffer_(s.begin(), s.end()),
@@ -400,6 +473,45 @@ public:
         }
     }
 
+    // Reads from another stream or string, keeping the read buffer and the parser's stacks
+    void reset(std::basic_istream<CharT>& is)
+    {
+        std::error_code ec;
+        reset(is, ec);
+        if (ec)
+        {
+            throw serialization_error(ec,parser_.line_number(),parser_.column_number());
+        }
+    }
+
+    void reset(std::basic_istream<CharT>& is, std::error_code& ec)
+    {
+        is_ = std::addressof(is);
+        buffer_.clear();
+        parser_.update(buffer_.data(),0);
+        begin_ = true;
+        start(ec);
+    }
+
+    void reset(const string_view_type& s)
+    {
+        std::error_code ec;
+        reset(s, ec);
+        if (ec)
+        {
+            throw serialization_error(ec,parser_.line_number(),parser_.column_number());
+        }
+    }
+
+    void reset(const string_view_type& s, std::error_code& ec)
+    {
+        is_ = std::addressof(null_is_);
+        buffer_.assign(s.begin(), s.end());
+        parser_.update(buffer_.data(),buffer_.size());
+        begin_ = true;
+        start(ec);
+    }
+
     size_t buffer_length() const
     {
         return buffer_length_;
@@ -531,12 +643,59 @@ public:
         while (!ec && !done() && !filter_.accept(event_handler_.event(), *this));
     }
 
+    void skip() override
+    {
+        std::error_code ec;
+        skip(ec);
+        if (ec)
+        {
+            throw serialization_error(ec,parser_.line_number(),parser_.column_number());
+        }
+    }
+
+    void skip(std::error_code& ec) override
+    {
+        switch (event_handler_.event().event_type())
+        {
+            case staj_event_type::begin_array:
+            case staj_event_type::begin_object:
+                break;
+            default:
+                return;
+        }
+        parser_.restart();
+        parser_.begin_skip();
+        while (parser_.skipping())
+        {
+            if (parser_.source_exhausted())
+            {
+                if (!is_->eof())
+                {
+                    if (is_->fail())
+                    {
+                        ec = json_errc::source_error;
+                        return;
+                    }        
+                    read_buffer(ec);
+                    if (ec) return;
+                }
+                else
+                {
+                    parser_.update(buffer_.data(),0);
+                    eof_ = true;
+                }
+            }
+            parser_.skip_some(event_handler_, ec);
+            if (ec) return;
+        }
+    }
+
     void read_buffer(std::error_code& ec)
     {
         buffer_.clear();
         buffer_.resize(buffer_length_);
-        is_.read(buffer_.data(), buffer_length_);
-        buffer_.resize(static_cast<size_t>(is_.gcount()));
+        is_->read(buffer_.data(), buffer_length_);
+        buffer_.resize(static_cast<size_t>(is_->gcount()));
         if (buffer_.size() == 0)
         {
             eof_ = true;
@@ -571,9 +730,9 @@ public:
         {
             if (parser_.source_exhausted())
             {
-                if (!is_.eof())
+                if (!is_->eof())
                 {
-                    if (is_.fail())
+                    if (is_->fail())
                     {
                         ec = json_errc::source_error;
                         return;
@@ -620,9 +779,9 @@ public:
             {
                 if (parser_.source_exhausted())
                 {
-                    if (!is_.eof())
+                    if (!is_->eof())
                     {
-                        if (is_.fail())
+                        if (is_->fail())
                         {
                             ec = json_errc::source_error;
                             return;
@@ -659,6 +818,15 @@ public:
         return parser_.column_number();
     }
 private:
+    void start(std::error_code& ec)
+    {
+        parser_.reset();
+        eof_ = false;
+        if (!done())
+        {
+            next(ec);
+        }
+    }
 };
 
 typedef basic_json_pull_reader<char,std::allocator<char>> json_pull_reader;
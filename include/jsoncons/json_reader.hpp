@@ -246,6 +246,17 @@ public:
         buffer_.reserve(buffer_length_);
     }
 
+    // Reads from another source, keeping the read buffer and the parser's stacks
+    void reset(source_type source)
+    {
+        source_ = std::move(source);
+        buffer_.clear();
+        parser_.update(buffer_.data(),0);
+        parser_.reset();
+        eof_ = false;
+        begin_ = true;
+    }
+
     size_t buffer_length() const
     {
         return buffer_length_;
@@ -413,6 +413,22 @@ public:
         }
     }
 
+    // Prepares to write another value, keeping the capacity of the container stack
+    void reset()
+    {
+        stack_.clear();
+        indent_amount_ = 0;
+        column_ = 0;
+    }
+
+    // Flushes the current output, and writes the next value to result
+    void reset(result_type result)
+    {
+        result_.flush();
+        result_ = std::move(result);
+        reset();
+    }
+
 private:
     // Implementing methods
     void do_flush() override
@@ -1122,6 +1138,20 @@ public:
         }
     }
 
+    // Prepares to write another value, keeping the capacity of the container stack
+    void reset()
+    {
+        stack_.clear();
+    }
+
+    // Flushes the current output, and writes the next value to result
+    void reset(result_type result)
+    {
+        result_.flush();
+        result_ = std::move(result);
+        reset();
+    }
+
 
 private:
     // Implementing methods
@@ -13,6 +13,7 @@
 #include <valarray>
 #include <exception>
 #include <cstring>
+#include <cstdint>
 #include <utility>
 #include <algorithm> // std::swap
 #include <limits> // std::numeric_limits
@@ -22,6 +23,9 @@
 #include <jsoncons/bignum.hpp>
 #include <jsoncons/json_content_handler.hpp>
 #include <jsoncons/detail/type_traits_helper.hpp>
+#if defined(JSONCONS_HAS_OPTIONAL)
+#include <optional>
+#endif
 
 namespace jsoncons {
 
@@ -268,6 +272,49 @@ private:
     iterator_base it_;
 };
 
+// Appends the values of a typed array to v, converted as as<T>() converts numbers
+
+template <class T, class TypedArray, class Container>
+typename std::enable_if<std::is_arithmetic<T>::value && !std::is_same<T,bool>::value>::type
+append_typed_array(const TypedArray& values, Container& v)
+{
+    const size_t size = values.size();
+    if (values.int64_data() != nullptr)
+    {
+        const int64_t* p = values.int64_data();
+        for (size_t i = 0; i < size; ++i)
+        {
+            v.push_back(static_cast<T>(p[i]));
+        }
+    }
+    else if (values.uint64_data() != nullptr)
+    {
+        const uint64_t* p = values.uint64_data();
+        for (size_t i = 0; i < size; ++i)
+        {
+            v.push_back(static_cast<T>(p[i]));
+        }
+    }
+    else if (values.double_data() != nullptr)
+    {
+        const double* p = values.double_data();
+        for (size_t i = 0; i < size; ++i)
+        {
+            v.push_back(static_cast<T>(p[i]));
+        }
+    }
+}
+
+template <class T, class TypedArray, class Container>
+typename std::enable_if<!(std::is_arithmetic<T>::value && !std::is_same<T,bool>::value)>::type
+append_typed_array(const TypedArray& values, Container& v)
+{
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+        v.push_back(values.elements()[i].template as<T>());
+    }
+}
+
 }
 
 template<class Json>
@@ -537,7 +584,15 @@ struct json_type_traits<Json, T,
     static bool is(const Json& j) noexcept
     {
         bool result = j.is_array();
-        if (result)
+        if (result && j.is_typed_array())
+        {
+            const auto& values = j.typed_array_value();
+            for (size_t i = 0; result && i < values.size(); ++i)
+            {
+                result = values.elements()[i].template is<element_type>();
+            }
+        }
+        else if (result)
         {
             for (auto e : j.array_range())
             {
@@ -557,9 +612,7 @@ struct json_type_traits<Json, T,
     {
         if (j.is_array())
         {
-            T v(jsoncons::detail::json_array_input_iterator<Json, element_type>(j.array_range().begin()),
-                jsoncons::detail::json_array_input_iterator<Json, element_type>(j.array_range().end()));
-            return v;
+            return from_array(j);
         }
         else
         {
@@ -573,9 +626,7 @@ struct json_type_traits<Json, T,
     {
         if (j.is_array())
         {
-            T v(jsoncons::detail::json_array_input_iterator<Json, element_type>(j.array_range().begin()),
-                jsoncons::detail::json_array_input_iterator<Json, element_type>(j.array_range().end()));
-            return v;
+            return from_array(j);
         }
         else if (j.is_byte_string_view())
         {
@@ -594,6 +645,36 @@ struct json_type_traits<Json, T,
         }
     }
 
+    // Containers that can reserve are filled after a single allocation
+    template <class Ty = T>
+    static typename std::enable_if<jsoncons::detail::has_reserve<Ty>::value,T>::type
+    from_array(const Json& j)
+    {
+        T v;
+        v.reserve(j.size());
+        if (j.is_typed_array())
+        {
+            jsoncons::detail::append_typed_array<element_type>(j.typed_array_value(), v);
+        }
+        else
+        {
+            for (const auto& item : j.array_range())
+            {
+                v.push_back(item.template as<element_type>());
+            }
+        }
+        return v;
+    }
+
+    template <class Ty = T>
+    static typename std::enable_if<!jsoncons::detail::has_reserve<Ty>::value,T>::type
+    from_array(const Json& j)
+    {
+        T v(jsoncons::detail::json_array_input_iterator<Json, element_type>(j.array_range().begin()),
+            jsoncons::detail::json_array_input_iterator<Json, element_type>(j.array_range().end()));
+        return v;
+    }
+
     static Json to_json(const T& val)
     {
         Json j = typename Json::array();
@@ -1012,7 +1093,226 @@ struct json_type_traits<Json, std::valarray<T>>
     }
 };
 
+#if defined(JSONCONS_HAS_OPTIONAL)
+
+// std::optional
+
+template<class Json, class T>
+struct json_type_traits<Json, std::optional<T>>
+{
+    typedef typename Json::allocator_type allocator_type;
+
+    static bool is(const Json& j) noexcept
+    {
+        return j.is_null() || j.template is<T>();
+    }
+
+    static std::optional<T> as(const Json& j)
+    {
+        if (j.is_null())
+        {
+            return std::optional<T>();
+        }
+        return std::optional<T>(j.template as<T>());
+    }
+
+    static Json to_json(const std::optional<T>& val)
+    {
+        return val.has_value() ? Json(*val) : Json::null();
+    }
+
+    static Json to_json(const std::optional<T>& val, const allocator_type& allocator)
+    {
+        return val.has_value() ? Json(*val, allocator) : Json::null();
+    }
+};
+
+#endif
+
+// member_traits
+
+// The name of a data member mapped with JSONCONS_MEMBER_TRAITS_DECL
+struct member_name
+{
+    const char* data;
+    size_t length;
+};
+
+// Specialized by JSONCONS_MEMBER_TRAITS_DECL, with 
+//     size(), the number of mapped members
+//     names(), their names in declaration order
+//     find(s, length), the index of the member named s, or size() if there is none
+//     visit(index, val, visitor), which calls visitor(val.member) for the member at index 
+template <class T, class Enable=void>
+struct member_traits;
+
+template <class T>
+struct is_member_traits_declared : public std::false_type
+{};
+
+namespace detail {
+
+template <class CharT>
+typename std::enable_if<std::is_same<CharT,char>::value,basic_string_view<CharT>>::type
+member_name_string(const member_name& name)
+{
+    return basic_string_view<CharT>(name.data, name.length);
 }
 
+template <class CharT>
+typename std::enable_if<!std::is_same<CharT,char>::value,std::basic_string<CharT>>::type
+member_name_string(const member_name& name)
+{
+    return std::basic_string<CharT>(name.data, name.data + name.length);
+}
+
+template <class CharT>
+bool member_name_equals(const member_name& name, const CharT* s, size_t length)
+{
+    if (name.length != length)
+    {
+        return false;
+    }
+    for (size_t i = 0; i < length; ++i)
+    {
+        if (static_cast<CharT>(name.data[i]) != s[i])
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+inline
+bool member_name_equals(const member_name& name, const char* s, size_t length)
+{
+    return name.length == length && std::memcmp(name.data, s, length) == 0;
+}
+
+// FNV-1a over the code units of a member name. The constexpr form gives the case labels
+// that member_traits::find switches on, the loop form hashes the names being looked up.
+
+template <class CharT>
+constexpr uint64_t member_name_hash(const CharT* s, size_t length, uint64_t h = 0xcbf29ce484222325ULL)
+{
+    return length == 0 ? h : member_name_hash(s + 1, length - 1, 
+        (h ^ static_cast<uint64_t>(static_cast<typename std::make_unsigned<CharT>::type>(*s))) * 0x100000001b3ULL);
+}
+
+template <class CharT>
+uint64_t hash_member_name(const CharT* s, size_t length)
+{
+    uint64_t h = 0xcbf29ce484222325ULL;
+    for (size_t i = 0; i < length; ++i)
+    {
+        h = (h ^ static_cast<uint64_t>(static_cast<typename std::make_unsigned<CharT>::type>(s[i]))) * 0x100000001b3ULL;
+    }
+    return h;
+}
+
+// Members that are left out when encoding
+
+template <class T>
+bool is_absent_member(const T&)
+{
+    return false;
+}
+
+#if defined(JSONCONS_HAS_OPTIONAL)
+template <class T>
+bool is_absent_member(const std::optional<T>& val)
+{
+    return !val.has_value();
+}
 #endif
 
+template <class Json>
+class member_from_json
+{
+    const Json& j_;
+public:
+    member_from_json(const Json& j)
+        : j_(j)
+    {
+    }
+
+    template <class T>
+    void operator()(T& val)
+    {
+        val = j_.template as<T>();
+    }
+};
+
+template <class Json>
+class member_to_json
+{
+    Json& j_;
+    typename Json::string_view_type name_;
+public:
+    member_to_json(Json& j, const typename Json::string_view_type& name)
+        : j_(j), name_(name)
+    {
+    }
+
+    template <class T>
+    void operator()(const T& val)
+    {
+        if (!is_absent_member(val))
+        {
+            j_.insert_or_assign(name_, val);
+        }
+    }
+};
+
+}
+
+template<class Json, class T>
+struct json_type_traits<Json, T,
+                        typename std::enable_if<is_member_traits_declared<T>::value>::type>
+{
+    typedef typename Json::char_type char_type;
+    typedef typename Json::allocator_type allocator_type;
+    typedef member_traits<T> traits_type;
+
+    static bool is(const Json& j) noexcept
+    {
+        return j.is_object();
+    }
+
+    // Members that are missing from j keep their default values
+    static T as(const Json& j)
+    {
+        if (!j.is_object())
+        {
+            JSONCONS_THROW(json_exception_impl<std::runtime_error>("Not an object"));
+        }
+        T val;
+        for (const auto& member : j.object_range())
+        {
+            size_t index = traits_type::find(member.key().data(), member.key().length());
+            if (index < traits_type::size())
+            {
+                jsoncons::detail::member_from_json<Json> visitor(member.value());
+                traits_type::visit(index, val, visitor);
+            }
+        }
+        return val;
+    }
+
+    static Json to_json(const T& val, const allocator_type& allocator = allocator_type())
+    {
+        Json j = typename Json::object(allocator);
+        const member_name* names = traits_type::names();
+        for (size_t i = 0; i < traits_type::size(); ++i)
+        {
+            auto name = jsoncons::detail::member_name_string<char_type>(names[i]);
+            jsoncons::detail::member_to_json<Json> visitor(j, name);
+            traits_type::visit(i, val, visitor);
+        }
+        return j;
+    }
+};
+
+}
+
+#endif
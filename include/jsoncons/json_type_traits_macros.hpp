@@ -0,0 +1,189 @@
+// Copyright 2013 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_JSON_TYPE_TRAITS_MACROS_HPP
+#define JSONCONS_JSON_TYPE_TRAITS_MACROS_HPP
+
+#include <type_traits> // std::true_type
+#include <jsoncons/json_type_traits.hpp>
+#include <jsoncons/conversion_traits.hpp>
+
+// Preprocessor helpers for up to 100 arguments
+
+#define JSONCONS_PP_EXPAND(X) X
+#define JSONCONS_PP_CAT(A, B) JSONCONS_PP_CAT_(A, B)
+#define JSONCONS_PP_CAT_(A, B) A ## B
+
+#define JSONCONS_PP_NARGS(...) JSONCONS_PP_EXPAND(JSONCONS_PP_NARGS_(__VA_ARGS__, 100, 99, 98, 97, 96, 95, 94, 93, 92, 91, 90, 89, 88, 87, 86, 85, 84, 83, 82, 81, 80, 79, 78, 77, 76, 75, 74, 73, 72, 71, 70, 69, 68, 67, 66, 65, 64, 63, 62, 61, 60, 59, 58, 57, 56, 55, 54, 53, 52, 51, 50, 49, 48, 47, 46, 45, 44, 43, 42, 41, 40, 39, 38, 37, 36, 35, 34, 33, 32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0))
+#define JSONCONS_PP_NARGS_(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37, _38, _39, _40, _41, _42, _43, _44, _45, _46, _47, _48, _49, _50, _51, _52, _53, _54, _55, _56, _57, _58, _59, _60, _61, _62, _63, _64, _65, _66, _67, _68, _69, _70, _71, _72, _73, _74, _75, _76, _77, _78, _79, _80, _81, _82, _83, _84, _85, _86, _87, _88, _89, _90, _91, _92, _93, _94, _95, _96, _97, _98, _99, _100, N, ...) N
+
+// JSONCONS_PP_FOR_EACH(Macro, x1, ..., xn) expands to Macro(0, x1) ... Macro(n-1, xn)
+
+#define JSONCONS_PP_FOR_EACH(Macro, ...) JSONCONS_PP_FOR_EACH_(JSONCONS_PP_NARGS(__VA_ARGS__), Macro, __VA_ARGS__)
+#define JSONCONS_PP_FOR_EACH_(Count, Macro, ...) JSONCONS_PP_EXPAND(JSONCONS_PP_CAT(JSONCONS_PP_FOR_EACH_, Count)(Macro, Count, __VA_ARGS__))
+
+#define JSONCONS_PP_FOR_EACH_1(Macro, Count, X) Macro((Count-1), X)
+#define JSONCONS_PP_FOR_EACH_2(Macro, Count, X, ...) Macro((Count-2), X) JSONCONS_PP_EXPAND(JSONCONS_PP_FOR_EACH_1(Macro, Count, __VA_ARGS__))
+#define JSONCONS_PP_FOR_EACH_3(Macro, Count, X, ...) Macro((Count-3), X) JSONCONS_PP_EXPAND(JSONCONS_PP_FOR_EACH_2(Macro, Count, __VA_ARGS__))
+#define JSONCONS_PP_FOR_EACH_4(Macro, Count, X, ...) Macro((Count-4), X) JSONCONS_PP_EXPAND(JSONCONS_PP_FOR_EACH_3(Macro, Count, __VA_ARGS__))
+#define JSONCONS_PP_FOR_EACH_5(Macro, Count, X, ...) Macro((Count-5), X) JSONCONS_PP_EXPAND(JSONCONS_PP_FOR_EACH_4(Macro, Count, __VA_ARGS__))
+#define JSONCONS_PP_FOR_EACH_6(Macro, Count, X, ...) Macro((Count-6), X) JSONCONS_PP_EXPAND(JSONCONS_PP_FOR_EACH_5(Macro, Count, __VA_ARGS__))
+#define JSONCONS_PP_FOR_EACH_7(Macro, Count, X, ...) Macro((Count-7), X) JSONCONS_PP_EXPAND(JSONCONS_PP_FOR_EACH_6(Macro, Count, __VA_ARGS__))
+#define JSONCONS_PP_FOR_EACH_8(Macro, Count, X, ...) Macro((Count-8), X) JSONCONS_PP_EXPAND(JSONCONS_PP_FOR_EACH_7(Macro, Count, __VA_ARGS__))
+#define JSONCONS_PP_FOR_EACH_9(Macro, Count, X, ...) Macro((Count-9), X) JSONCONS_PP_EXPAND(JSONCONS_PP_FOR_EACH_8(Macro, Count, __VA_ARGS__))
+#define JSONCONS_PP_FOR_EACH_10(Macro, Count, X, ...) Macro((Count-10), X) JSONCONS_PP_EXPAND(JSONCONS_PP_FOR_EACH_9(Macro, Count, __VA_ARGS__))
+#define JSONCONS_PP_FOR_EACH_11(Macro, Count, X, ...) Macro((Count-11), X) JSONCONS_PP_EXPAND(JSONCONS_PP_FOR_EACH_10(Macro, Count, __VA_ARGS__))
+#define JSONCONS_PP_FOR_EACH_12(Macro, Count, X, ...) Macro((Count-12), X) JSONCONS_PP_EXPAND(JSONCONS_PP_FOR_EACH_11(Macro, Count, __VA_ARGS__))
+#define JSONCONS_PP_FOR_EACH_13(Macro, Count, X, ...) Macro((Count-13), X) JSONCONS_PP_EXPAND(JSONCONS_PP_FOR_EACH_12(Macro, Count, __VA_ARGS__))
+#define JSONCONS_PP_FOR_EACH_14(Macro, Count, X, ...) Macro((Count-14), X) JSONCONS_PP_EXPAND(JSONCONS_PP_FOR_EACH_13(Macro, Count, __VA_ARGS__))
+#define JSONCONS_PP_FOR_EACH_15(Macro, Count, X, ...) Macro((Count-15), X) JSONCONS_PP_EXPAND(JSONCONS_PP_FOR_EACH_14(Macro, Count, __VA_ARGS__))
+#define JSONCONS_PP_FOR_EACH_16(Macro, Count, X, ...) Macro((Count-16), X) JSONCONS_PP_EXPAND(JSONCONS_PP_FOR_EACH_15(Macro, Count, __VA_ARGS__))
+#define JSONCONS_PP_FOR_EACH_17(Macro, Count, X, ...) Macro((Count-17), X) JSONCONS_PP_EXPAND(JSONCONS_PP_FOR_EACH_16(Macro, Count, __VA_ARGS__))
+#define JSONCONS_PP_FOR_EACH_18(Macro, Count, X, ...) Macro((Count-18), X) JSONCONS_PP_EXPAND(JSONCONS_PP_FOR_EACH_17(Macro, Count, __VA_ARGS__))
+#define JSONCONS_PP_FOR_EACH_19(Macro, Count, X, ...) Macro((Count-19), X) JSONCONS_PP_EXPAND(JSONCONS_PP_FOR_EACH_18(Macro, Count, __VA_ARGS__))
+#define JSONCONS_PP_FOR_EACH_20(Macro, Count, X, ...) Macro((Count-20), X) JSONCONS_PP_EXPAND(JSONCONS_PP_FOR_EACH_19(Macro, Count, __VA_ARGS__))
+#define JSONCONS_PP_FOR_EACH_21(Macro, Count, X, ...) Macro((Count-21), X) JSONCONS_PP_EXPAND(JSONCONS_PP_FOR_EACH_20(Macro, Count, __VA_ARGS__))
+#define JSONCONS_PP_FOR_EACH_22(Macro, Count, X, ...) Macro((Count-22), X) JSONCONS_PP_EXPAND(JSONCONS_PP_FOR_EACH_21(Macro, Count, __VA_ARGS__))
+#define JSONCONS_PP_FOR_EACH_23(Macro, Count, X, ...) Macro((Count-23), X) JSONCONS_PP_EXPAND(JSONCONS_PP_FOR_EACH_22(Macro, Count, __VA_ARGS__))
+#define JSONCONS_PP_FOR_EACH_24(Macro, Count, X, ...) Macro((Count-24), X) JSONCONS_PP_EXPAND(JSONCONS_PP_FOR_EACH_23(Macro, Count, __VA_ARGS__))
+#define JSONCONS_PP_FOR_EACH_25(Macro, Count, X, ...) Macro((Count-25), X) JSONCONS_PP_EXPAND(JSONCONS_PP_FOR_EACH_24(Macro, Count, __VA_ARGS__))
+#define JSONCONS_PP_FOR_EACH_26(Macro, Count, X, ...) Macro((Count-26), X) JSONCONS_PP_EXPAND(JSONCONS_PP_FOR_EACH_25(Macro, Count, __VA_ARGS__))
+#define JSONCONS_PP_FOR_EACH_27(Macro, Count, X, ...) Macro((Count-27), X) JSONCONS_PP_EXPAND(JSONCONS_PP_FOR_EACH_26(Macro, Count, __VA_ARGS__))
+#define JSONCONS_PP_FOR_EACH_28(Macro, Count, X, ...) Macro((Count-28), X) JSONCONS_PP_EXPAND(JSONCONS_PP_FOR_EACH_27(Macro, Count, __VA_ARGS__))
+#define JSONCONS_PP_FOR_EACH_29(Macro, Count, X, ...) Macro((Count-29), X) JSONCONS_PP_EXPAND(JSONCONS_PP_FOR_EACH_28(Macro, Count, __VA_ARGS__))
+#define JSONCONS_PP_FOR_EACH_30(Macro, Count, X, ...) Macro((Count-30), X) JSONCONS_PP_EXPAND(JSONCONS_PP_FOR_EACH_29(Macro, Count, __VA_ARGS__))
+#define JSONCONS_PP_FOR_EACH_31(Macro, Count, X, ...) Macro((Count-31), X) JSONCONS_PP_EXPAND(JSONCONS_PP_FOR_EACH_30(Macro, Count, __VA_ARGS__))
+#define JSONCONS_PP_FOR_EACH_32(Macro, Count, X, ...) Macro((Count-32), X) JSONCONS_PP_EXPAND(JSONCONS_PP_FOR_EACH_31(Macro, Count, __VA_ARGS__))
+#define JSONCONS_PP_FOR_EACH_33(Macro, Count, X, ...) Macro((Count-33), X) JSONCONS_PP_EXPAND(JSONCONS_PP_FOR_EACH_32(Macro, Count, __VA_ARGS__))
+#define JSONCONS_PP_FOR_EACH_34(Macro, Count, X, ...) Macro((Count-34), X) JSONCONS_PP_EXPAND(JSONCONS_PP_FOR_EACH_33(Macro, Count, __VA_ARGS__))
+#define JSONCONS_PP_FOR_EACH_35(Macro, Count, X, ...) Macro((Count-35), X) JSONCONS_PP_EXPAND(JSONCONS_PP_FOR_EACH_34(Macro, Count, __VA_ARGS__))
+#define JSONCONS_PP_FOR_EACH_36(Macro, Count, X, ...) Macro((Count-36), X) JSONCONS_PP_EXPAND(JSONCONS_PP_FOR_EACH_35(Macro, Count, __VA_ARGS__))
+#define JSONCONS_PP_FOR_EACH_37(Macro, Count, X, ...) Macro((Count-37), X) JSONCONS_PP_EXPAND(JSONCONS_PP_FOR_EACH_36(Macro, Count, __VA_ARGS__))
+#define JSONCONS_PP_FOR_EACH_38(Macro, Count, X, ...) Macro((Count-38), X) JSONCONS_PP_EXPAND(JSONCONS_PP_FOR_EACH_37(Macro, Count, __VA_ARGS__))
+#define JSONCONS_PP_FOR_EACH_39(Macro, Count, X, ...) Macro((Count-39), X) JSONCONS_PP_EXPAND(JSONCONS_PP_FOR_EACH_38(Macro, Count, __VA_ARGS__))
+#define JSONCONS_PP_FOR_EACH_40(Macro, Count, X, ...) Macro((Count-40), X) JSONCONS_PP_EXPAND(JSONCONS_PP_FOR_EACH_39(Macro, Count, __VA_ARGS__))
+#define JSONCONS_PP_FOR_EACH_41(Macro, Count, X, ...) Macro((Count-41), X) JSONCONS_PP_EXPAND(JSONCONS_PP_FOR_EACH_40(Macro, Count, __VA_ARGS__))
+#define JSONCONS_PP_FOR_EACH_42(Macro, Count, X, ...) Macro((Count-42), X) JSONCONS_PP_EXPAND(JSONCONS_PP_FOR_EACH_41(Macro, Count, __VA_ARGS__))
+#define JSONCONS_PP_FOR_EACH_43(Macro, Count, X, ...) Macro((Count-43), X) JSONCONS_PP_EXPAND(JSONCONS_PP_FOR_EACH_42(Macro, Count, __VA_ARGS__))
+#define JSONCONS_PP_FOR_EACH_44(Macro, Count, X, ...) Macro((Count-44), X) JSONCONS_PP_EXPAND(JSONCONS_PP_FOR_EACH_43(Macro, Count, __VA_ARGS__))
+#define JSONCONS_PP_FOR_EACH_45(Macro, Count, X, ...) Macro((Count-45), X) JSONCONS_PP_EXPAND(JSONCONS_PP_FOR_EACH_44(Macro, Count, __VA_ARGS__))
+#define JSONCONS_PP_FOR_EACH_46(Macro, Count, X, ...) Macro((Count-46), X) JSONCONS_PP_EXPAND(JSONCONS_PP_FOR_EACH_45(Macro, Count, __VA_ARGS__))
+#define JSONCONS_PP_FOR_EACH_47(Macro, Count, X, ...) Macro((Count-47), X) JSONCONS_PP_EXPAND(JSONCONS_PP_FOR_EACH_46(Macro, Count, __VA_ARGS__))
+#define JSONCONS_PP_FOR_EACH_48(Macro, Count, X, ...) Macro((Count-48), X) JSONCONS_PP_EXPAND(JSONCONS_PP_FOR_EACH_47(Macro, Count, __VA_ARGS__))
+#define JSONCONS_PP_FOR_EACH_49(Macro, Count, X, ...) Macro((Count-49), X) JSONCONS_PP_EXPAND(JSONCONS_PP_FOR_EACH_48(Macro, Count, __VA_ARGS__))
+#define JSONCONS_PP_FOR_EACH_50(Macro, Count, X, ...) Macro((Count-50), X) JSONCONS_PP_EXPAND(JSONCONS_PP_FOR_EACH_49(Macro, Count, __VA_ARGS__))
+#define JSONCONS_PP_FOR_EACH_51(Macro, Count, X, ...) Macro((Count-51), X) JSONCONS_PP_EXPAND(JSONCONS_PP_FOR_EACH_50(Macro, Count, __VA_ARGS__))
+#define JSONCONS_PP_FOR_EACH_52(Macro, Count, X, ...) Macro((Count-52), X) JSONCONS_PP_EXPAND(JSONCONS_PP_FOR_EACH_51(Macro, Count, __VA_ARGS__))
+#define JSONCONS_PP_FOR_EACH_53(Macro, Count, X, ...) Macro((Count-53), X) JSONCONS_PP_EXPAND(JSONCONS_PP_FOR_EACH_52(Macro, Count, __VA_ARGS__))
+#define JSONCONS_PP_FOR_EACH_54(Macro, Count, X, ...) Macro((Count-54), X) JSONCONS_PP_EXPAND(JSONCONS_PP_FOR_EACH_53(Macro, Count, __VA_ARGS__))
+#define JSONCONS_PP_FOR_EACH_55(Macro, Count, X, ...) Macro((Count-55), X) JSONCONS_PP_EXPAND(JSONCONS_PP_FOR_EACH_54(Macro, Count, __VA_ARGS__))
+#define JSONCONS_PP_FOR_EACH_56(Macro, Count, X, ...) Macro((Count-56), X) JSONCONS_PP_EXPAND(JSONCONS_PP_FOR_EACH_55(Macro, Count, __VA_ARGS__))
+#define JSONCONS_PP_FOR_EACH_57(Macro, Count, X, ...) Macro((Count-57), X) JSONCONS_PP_EXPAND(JSONCONS_PP_FOR_EACH_56(Macro, Count, __VA_ARGS__))
+#define JSONCONS_PP_FOR_EACH_58(Macro, Count, X, ...) Macro((Count-58), X) JSONCONS_PP_EXPAND(JSONCONS_PP_FOR_EACH_57(Macro, Count, __VA_ARGS__))
+#define JSONCONS_PP_FOR_EACH_59(Macro, Count, X, ...) Macro((Count-59), X) JSONCONS_PP_EXPAND(JSONCONS_PP_FOR_EACH_58(Macro, Count, __VA_ARGS__))
+#define JSONCONS_PP_FOR_EACH_60(Macro, Count, X, ...) Macro((Count-60), X) JSONCONS_PP_EXPAND(JSONCONS_PP_FOR_EACH_59(Macro, Count, __VA_ARGS__))
+#define JSONCONS_PP_FOR_EACH_61(Macro, Count, X, ...) Macro((Count-61), X) JSONCONS_PP_EXPAND(JSONCONS_PP_FOR_EACH_60(Macro, Count, __VA_ARGS__))
+#define JSONCONS_PP_FOR_EACH_62(Macro, Count, X, ...) Macro((Count-62), X) JSONCONS_PP_EXPAND(JSONCONS_PP_FOR_EACH_61(Macro, Count, __VA_ARGS__))
+#define JSONCONS_PP_FOR_EACH_63(Macro, Count, X, ...) Macro((Count-63), X) JSONCONS_PP_EXPAND(JSONCONS_PP_FOR_EACH_62(Macro, Count, __VA_ARGS__))
+#define JSONCONS_PP_FOR_EACH_64(Macro, Count, X, ...) Macro((Count-64), X) JSONCONS_PP_EXPAND(JSONCONS_PP_FOR_EACH_63(Macro, Count, __VA_ARGS__))
+#define JSONCONS_PP_FOR_EACH_65(Macro, Count, X, ...) Macro((Count-65), X) JSONCONS_PP_EXPAND(JSONCONS_PP_FOR_EACH_64(Macro, Count, __VA_ARGS__))
+#define JSONCONS_PP_FOR_EACH_66(Macro, Count, X, ...) Macro((Count-66), X) JSONCONS_PP_EXPAND(JSONCONS_PP_FOR_EACH_65(Macro, Count, __VA_ARGS__))
+#define JSONCONS_PP_FOR_EACH_67(Macro, Count, X, ...) Macro((Count-67), X) JSONCONS_PP_EXPAND(JSONCONS_PP_FOR_EACH_66(Macro, Count, __VA_ARGS__))
+#define JSONCONS_PP_FOR_EACH_68(Macro, Count, X, ...) Macro((Count-68), X) JSONCONS_PP_EXPAND(JSONCONS_PP_FOR_EACH_67(Macro, Count, __VA_ARGS__))
+#define JSONCONS_PP_FOR_EACH_69(Macro, Count, X, ...) Macro((Count-69), X) JSONCONS_PP_EXPAND(JSONCONS_PP_FOR_EACH_68(Macro, Count, __VA_ARGS__))
+#define JSONCONS_PP_FOR_EACH_70(Macro, Count, X, ...) Macro((Count-70), X) JSONCONS_PP_EXPAND(JSONCONS_PP_FOR_EACH_69(Macro, Count, __VA_ARGS__))
+#define JSONCONS_PP_FOR_EACH_71(Macro, Count, X, ...) Macro((Count-71), X) JSONCONS_PP_EXPAND(JSONCONS_PP_FOR_EACH_70(Macro, Count, __VA_ARGS__))
+#define JSONCONS_PP_FOR_EACH_72(Macro, Count, X, ...) Macro((Count-72), X) JSONCONS_PP_EXPAND(JSONCONS_PP_FOR_EACH_71(Macro, Count, __VA_ARGS__))
+#define JSONCONS_PP_FOR_EACH_73(Macro, Count, X, ...) Macro((Count-73), X) JSONCONS_PP_EXPAND(JSONCONS_PP_FOR_EACH_72(Macro, Count, __VA_ARGS__))
+#define JSONCONS_PP_FOR_EACH_74(Macro, Count, X, ...) Macro((Count-74), X) JSONCONS_PP_EXPAND(JSONCONS_PP_FOR_EACH_73(Macro, Count, __VA_ARGS__))
+#define JSONCONS_PP_FOR_EACH_75(Macro, Count, X, ...) Macro((Count-75), X) JSONCONS_PP_EXPAND(JSONCONS_PP_FOR_EACH_74(Macro, Count, __VA_ARGS__))
+#define JSONCONS_PP_FOR_EACH_76(Macro, Count, X, ...) Macro((Count-76), X) JSONCONS_PP_EXPAND(JSONCONS_PP_FOR_EACH_75(Macro, Count, __VA_ARGS__))
+#define JSONCONS_PP_FOR_EACH_77(Macro, Count, X, ...) Macro((Count-77), X) JSONCONS_PP_EXPAND(JSONCONS_PP_FOR_EACH_76(Macro, Count, __VA_ARGS__))
+#define JSONCONS_PP_FOR_EACH_78(Macro, Count, X, ...) Macro((Count-78), X) JSONCONS_PP_EXPAND(JSONCONS_PP_FOR_EACH_77(Macro, Count, __VA_ARGS__))
+#define JSONCONS_PP_FOR_EACH_79(Macro, Count, X, ...) Macro((Count-79), X) JSONCONS_PP_EXPAND(JSONCONS_PP_FOR_EACH_78(Macro, Count, __VA_ARGS__))
+#define JSONCONS_PP_FOR_EACH_80(Macro, Count, X, ...) Macro((Count-80), X) JSONCONS_PP_EXPAND(JSONCONS_PP_FOR_EACH_79(Macro, Count, __VA_ARGS__))
+#define JSONCONS_PP_FOR_EACH_81(Macro, Count, X, ...) Macro((Count-81), X) JSONCONS_PP_EXPAND(JSONCONS_PP_FOR_EACH_80(Macro, Count, __VA_ARGS__))
+#define JSONCONS_PP_FOR_EACH_82(Macro, Count, X, ...) Macro((Count-82), X) JSONCONS_PP_EXPAND(JSONCONS_PP_FOR_EACH_81(Macro, Count, __VA_ARGS__))
+#define JSONCONS_PP_FOR_EACH_83(Macro, Count, X, ...) Macro((Count-83), X) JSONCONS_PP_EXPAND(JSONCONS_PP_FOR_EACH_82(Macro, Count, __VA_ARGS__))
+#define JSONCONS_PP_FOR_EACH_84(Macro, Count, X, ...) Macro((Count-84), X) JSONCONS_PP_EXPAND(JSONCONS_PP_FOR_EACH_83(Macro, Count, __VA_ARGS__))
+#define JSONCONS_PP_FOR_EACH_85(Macro, Count, X, ...) Macro((Count-85), X) JSONCONS_PP_EXPAND(JSONCONS_PP_FOR_EACH_84(Macro, Count, __VA_ARGS__))
+#define JSONCONS_PP_FOR_EACH_86(Macro, Count, X, ...) Macro((Count-86), X) JSONCONS_PP_EXPAND(JSONCONS_PP_FOR_EACH_85(Macro, Count, __VA_ARGS__))
+#define JSONCONS_PP_FOR_EACH_87(Macro, Count, X, ...) Macro((Count-87), X) JSONCONS_PP_EXPAND(JSONCONS_PP_FOR_EACH_86(Macro, Count, __VA_ARGS__))
+#define JSONCONS_PP_FOR_EACH_88(Macro, Count, X, ...) Macro((Count-88), X) JSONCONS_PP_EXPAND(JSONCONS_PP_FOR_EACH_87(Macro, Count, __VA_ARGS__))
+#define JSONCONS_PP_FOR_EACH_89(Macro, Count, X, ...) Macro((Count-89), X) JSONCONS_PP_EXPAND(JSONCONS_PP_FOR_EACH_88(Macro, Count, __VA_ARGS__))
+#define JSONCONS_PP_FOR_EACH_90(Macro, Count, X, ...) Macro((Count-90), X) JSONCONS_PP_EXPAND(JSONCONS_PP_FOR_EACH_89(Macro, Count, __VA_ARGS__))
+#define JSONCONS_PP_FOR_EACH_91(Macro, Count, X, ...) Macro((Count-91), X) JSONCONS_PP_EXPAND(JSONCONS_PP_FOR_EACH_90(Macro, Count, __VA_ARGS__))
+#define JSONCONS_PP_FOR_EACH_92(Macro, Count, X, ...) Macro((Count-92), X) JSONCONS_PP_EXPAND(JSONCONS_PP_FOR_EACH_91(Macro, Count, __VA_ARGS__))
+#define JSONCONS_PP_FOR_EACH_93(Macro, Count, X, ...) Macro((Count-93), X) JSONCONS_PP_EXPAND(JSONCONS_PP_FOR_EACH_92(Macro, Count, __VA_ARGS__))
+#define JSONCONS_PP_FOR_EACH_94(Macro, Count, X, ...) Macro((Count-94), X) JSONCONS_PP_EXPAND(JSONCONS_PP_FOR_EACH_93(Macro, Count, __VA_ARGS__))
+#define JSONCONS_PP_FOR_EACH_95(Macro, Count, X, ...) Macro((Count-95), X) JSONCONS_PP_EXPAND(JSONCONS_PP_FOR_EACH_94(Macro, Count, __VA_ARGS__))
+#define JSONCONS_PP_FOR_EACH_96(Macro, Count, X, ...) Macro((Count-96), X) JSONCONS_PP_EXPAND(JSONCONS_PP_FOR_EACH_95(Macro, Count, __VA_ARGS__))
+#define JSONCONS_PP_FOR_EACH_97(Macro, Count, X, ...) Macro((Count-97), X) JSONCONS_PP_EXPAND(JSONCONS_PP_FOR_EACH_96(Macro, Count, __VA_ARGS__))
+#define JSONCONS_PP_FOR_EACH_98(Macro, Count, X, ...) Macro((Count-98), X) JSONCONS_PP_EXPAND(JSONCONS_PP_FOR_EACH_97(Macro, Count, __VA_ARGS__))
+#define JSONCONS_PP_FOR_EACH_99(Macro, Count, X, ...) Macro((Count-99), X) JSONCONS_PP_EXPAND(JSONCONS_PP_FOR_EACH_98(Macro, Count, __VA_ARGS__))
+#define JSONCONS_PP_FOR_EACH_100(Macro, Count, X, ...) Macro((Count-100), X) JSONCONS_PP_EXPAND(JSONCONS_PP_FOR_EACH_99(Macro, Count, __VA_ARGS__))
+
+#define JSONCONS_MEMBER_NAME_(Index, Member) {#Member, sizeof(#Member) - 1},
+#define JSONCONS_MEMBER_CASE_(Index, Member) case Index: visitor(val.Member); break;
+#define JSONCONS_MEMBER_FIND_CASE_(Index, Member) \
+    case jsoncons::detail::member_name_hash(#Member, sizeof(#Member) - 1): \
+        return jsoncons::detail::member_name_equals(jsoncons::member_name{#Member, sizeof(#Member) - 1}, s, length) ? (Index) : size();
+
+// Maps the listed public data members of ValueType to the members of a JSON object with
+// the same names. Must be used at global scope, and ValueType must be default constructible.
+//
+// decode_json<ValueType> then reads the members straight from the pull reader, and
+// encode_json writes them straight to the content handler, without a basic_json in between.
+// Members may be of any type that has conversion_traits, including other mapped types, 
+// vector like and map like containers, and, in C++17, std::optional. Members that are
+// missing from the input keep their default values, and empty std::optional members are
+// left out of the output.
+//
+// Incoming member names are matched with a switch over name hashes computed at compile time,
+// followed by one comparison with the candidate name, so lookup cost doesn't grow with the
+// number of members. Listing the same member twice is a compile time error (duplicate case value.)
+
+#define JSONCONS_MEMBER_TRAITS_DECL(ValueType, ...) \
+namespace jsoncons \
+{ \
+    template <> \
+    struct is_member_traits_declared<ValueType> : public std::true_type \
+    {}; \
+    template <> \
+    struct member_traits<ValueType> \
+    { \
+        typedef ValueType value_type; \
+        static constexpr size_t size() \
+        { \
+            return JSONCONS_PP_NARGS(__VA_ARGS__); \
+        } \
+        static const member_name* names() \
+        { \
+            static const member_name member_names[] = {JSONCONS_PP_FOR_EACH(JSONCONS_MEMBER_NAME_, __VA_ARGS__)}; \
+            return member_names; \
+        } \
+        template <class CharT> \
+        static size_t find(const CharT* s, size_t length) \
+        { \
+            switch (jsoncons::detail::hash_member_name(s, length)) \
+            { \
+                JSONCONS_PP_FOR_EACH(JSONCONS_MEMBER_FIND_CASE_, __VA_ARGS__) \
+                default: return size(); \
+            } \
+        } \
+        template <class T, class Visitor> \
+        static void visit(size_t index, T& val, Visitor& visitor) \
+        { \
+            switch (index) \
+            { \
+                JSONCONS_PP_FOR_EACH(JSONCONS_MEMBER_CASE_, __VA_ARGS__) \
+                default: break; \
+            } \
+        } \
+    }; \
+}
+
+#endif
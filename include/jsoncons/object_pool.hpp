@@ -0,0 +1,141 @@
+// Copyright 2018 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_OBJECT_POOL_HPP
+#define JSONCONS_OBJECT_POOL_HPP
+
+#include <cstddef>
+#include <memory> // std::unique_ptr
+#include <vector>
+#include <utility> // std::move, std::forward
+
+namespace jsoncons {
+
+// Keeps up to max_size released objects, such as parsers, decoders and serializers, so
+// that their buffers can be reused. acquire hands out a pooled object if there is one,
+// as it was left, and otherwise constructs a new one from its arguments. The object goes
+// back to the pool when its handle is destroyed. A pool isn't synchronized, it is meant
+// to be declared thread_local.
+
+template <class T>
+class object_pool
+{
+    std::vector<std::unique_ptr<T>> free_;
+    size_t max_size_;
+
+    // Noncopyable and nonmoveable
+    object_pool(const object_pool&) = delete;
+    object_pool& operator=(const object_pool&) = delete;
+public:
+    class handle
+    {
+        friend class object_pool;
+
+        object_pool* pool_;
+        std::unique_ptr<T> ptr_;
+
+        handle(object_pool* pool, std::unique_ptr<T>&& ptr)
+            : pool_(pool), ptr_(std::move(ptr))
+        {
+        }
+
+        handle(const handle&) = delete;
+        handle& operator=(const handle&) = delete;
+    public:
+        handle(handle&& other)
+            : pool_(other.pool_), ptr_(std::move(other.ptr_))
+        {
+        }
+
+        ~handle()
+        {
+            release();
+        }
+
+        handle& operator=(handle&& other)
+        {
+            if (this != &other)
+            {
+                release();
+                pool_ = other.pool_;
+                ptr_ = std::move(other.ptr_);
+            }
+            return *this;
+        }
+
+        T& operator*() const
+        {
+            return *ptr_;
+        }
+
+        T* operator->() const
+        {
+            return ptr_.get();
+        }
+
+        T* get() const
+        {
+            return ptr_.get();
+        }
+    private:
+        void release()
+        {
+            if (ptr_)
+            {
+                pool_->release(std::move(ptr_));
+            }
+        }
+    };
+
+    explicit object_pool(size_t max_size = 4)
+        : max_size_(max_size)
+    {
+    }
+
+    template <class... Args>
+    handle acquire(Args&&... args)
+    {
+        if (!free_.empty())
+        {
+            std::unique_ptr<T> ptr = std::move(free_.back());
+            free_.pop_back();
+            return handle(this, std::move(ptr));
+        }
+        return handle(this, std::unique_ptr<T>(new T(std::forward<Args>(args)...)));
+    }
+
+    // The number of objects waiting in the pool
+    size_t size() const
+    {
+        return free_.size();
+    }
+
+    size_t max_size() const
+    {
+        return max_size_;
+    }
+
+    void clear()
+    {
+        free_.clear();
+    }
+private:
+    void release(std::unique_ptr<T>&& ptr)
+    {
+        if (free_.size() < max_size_)
+        {
+            free_.push_back(std::move(ptr));
+        }
+        else
+        {
+            ptr.reset();
+        }
+    }
+};
+
+}
+
+#endif
@@ -0,0 +1,53 @@
+// Copyright 2013 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_PARALLEL_POLICY_HPP
+#define JSONCONS_PARALLEL_POLICY_HPP
+
+#include <cstddef>
+#include <jsoncons/detail/thread_pool.hpp>
+
+namespace jsoncons {
+
+// parallel_policy
+
+class parallel_policy
+{
+    size_t max_threads_;
+    size_t min_chunk_size_;
+public:
+    parallel_policy()
+        : max_threads_(jsoncons::detail::thread_pool::default_thread_count()), 
+          min_chunk_size_(4096)
+    {
+    }
+
+    size_t max_threads() const
+    {
+        return max_threads_;
+    }
+
+    parallel_policy& max_threads(size_t value)
+    {
+        max_threads_ = value;
+        return *this;
+    }
+
+    size_t min_chunk_size() const
+    {
+        return min_chunk_size_;
+    }
+
+    parallel_policy& min_chunk_size(size_t value)
+    {
+        min_chunk_size_ = value;
+        return *this;
+    }
+};
+
+}
+
+#endif
@@ -224,6 +224,7 @@ public:
     string_result& operator=(string_result&& val)
     {
         std::swap(s_, val.s_);
+        return *this;
     }
 
     void flush()
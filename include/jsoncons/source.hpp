@@ -252,6 +252,7 @@ public:
         std::swap(input_ptr_,val.input_ptr_);
         std::swap(input_end_,val.input_end_);
         std::swap(eof_,val.eof_);
+        return *this;
     }
 
     bool eof() const
@@ -665,6 +666,236 @@ public:
     }
 };
 
+
+// A binary source for input that arrives in pieces, for instance from a socket. Each
+// piece is given to update(), and is read in place until an item runs past its end.
+// The parser then rewinds to the mark it set at the start of the item, and the bytes
+// from there on are kept until the next piece arrives.
+
+class partial_buffer_source 
+{
+public:
+    typedef uint8_t value_type;
+    typedef binary_traits traits_type;
+private:
+    std::vector<value_type> buffer_;
+    const value_type* data_;
+    const value_type* input_ptr_;
+    const value_type* input_end_;
+    const value_type* mark_;
+    size_t offset_;
+    size_t required_;
+    bool eof_;
+
+    // Noncopyable 
+    partial_buffer_source(const partial_buffer_source&) = delete;
+    partial_buffer_source& operator=(const partial_buffer_source&) = delete;
+public:
+    partial_buffer_source()
+        : data_(nullptr), 
+          input_ptr_(nullptr), 
+          input_end_(nullptr), 
+          mark_(nullptr), 
+          offset_(0),
+          required_(0),
+          eof_(false)
+    {
+    }
+
+    partial_buffer_source(partial_buffer_source&&) = default;
+
+    partial_buffer_source& operator=(partial_buffer_source&&) = default;
+
+    // Appends the next piece of input. The bytes must stay valid until they have been
+    // read, or until the parser returns for more input.
+    void update(const value_type* data, size_t length)
+    {
+        if (input_ptr_ < input_end_)
+        {
+            if (data_ == buffer_.data())
+            {
+                buffer_.erase(buffer_.begin(), buffer_.begin() + (input_ptr_ - data_));
+            }
+            else
+            {
+                buffer_.assign(input_ptr_, input_end_);
+            }
+            offset_ += input_ptr_ - data_;
+            buffer_.insert(buffer_.end(), data, data + length);
+            data_ = buffer_.data();
+            input_end_ = data_ + buffer_.size();
+        }
+        else
+        {
+            offset_ += input_end_ - data_;
+            buffer_.clear();
+            data_ = data;
+            input_end_ = data + length;
+        }
+        input_ptr_ = data_;
+        mark_ = data_;
+        eof_ = false;
+    }
+
+    // Marks the start of an item
+    void mark()
+    {
+        mark_ = input_ptr_;
+        required_ = 0;
+        eof_ = false;
+    }
+
+    // Returns to the last mark, keeping the bytes from there on for the next update
+    void rewind()
+    {
+        if (data_ != buffer_.data())
+        {
+            buffer_.assign(mark_, input_end_);
+            offset_ += mark_ - data_;
+            data_ = buffer_.data();
+            input_end_ = data_ + buffer_.size();
+            mark_ = data_;
+        }
+        input_ptr_ = mark_;
+        eof_ = false;
+    }
+
+    // True if there is no more input to read, or not enough to finish the item that
+    // was rewound
+    bool exhausted() const
+    {
+        return input_ptr_ == input_end_ || !can_resume();
+    }
+
+    // False if the item that was rewound still runs past the end of the input
+    bool can_resume() const
+    {
+        return (size_t)(input_end_ - input_ptr_) >= required_;
+    }
+
+    bool eof() const
+    {
+        return eof_;  
+    }
+
+    bool is_error() const
+    {
+        return false;  
+    }
+
+    size_t position() const
+    {
+        return offset_ + (input_ptr_ - data_) + 1;
+    }
+
+    size_t get(value_type& c)
+    {
+        if (input_ptr_ < input_end_)
+        {
+            c = *input_ptr_++;
+            return 1;
+        }
+        else
+        {
+            short_of(1);
+            return 0;
+        }
+    }
+
+    int get()
+    {
+        if (input_ptr_ < input_end_)
+        {
+            return *input_ptr_++;
+        }
+        else
+        {
+            short_of(1);
+            return traits_type::eof();
+        }
+    }
+
+    void ignore(size_t count)
+    {
+        size_t len;
+        if ((size_t)(input_end_ - input_ptr_) < count)
+        {
+            len = input_end_ - input_ptr_;
+            short_of(count);
+        }
+        else
+        {
+            len = count;
+        }
+        input_ptr_ += len;
+    }
+
+    int peek() 
+    {
+        if (input_ptr_ < input_end_)
+        {
+            return *input_ptr_;
+        }
+        else
+        {
+            short_of(1);
+            return traits_type::eof();
+        }
+    }
+
+    size_t read(value_type* p, size_t length)
+    {
+        size_t len;
+        if ((size_t)(input_end_ - input_ptr_) < length)
+        {
+            len = input_end_ - input_ptr_;
+            short_of(length);
+        }
+        else
+        {
+            len = length;
+        }
+        if (len > 0)
+        {
+            std::memcpy(p, input_ptr_, len);
+        }
+        input_ptr_  += len;
+        return len;
+    }
+
+    template <class OutputIt>
+    typename std::enable_if<!std::is_same<OutputIt,value_type*>::value,size_t>::type
+    read(OutputIt d_first, size_t count)
+    {
+        size_t len;
+        if ((size_t)(input_end_ - input_ptr_) < count)
+        {
+            len = input_end_ - input_ptr_;
+            short_of(count);
+        }
+        else
+        {
+            len = count;
+        }
+        for (size_t i = 0; i < len; ++i)
+        {
+            *d_first++ = *input_ptr_++;
+        }
+        return len;
+    }
+private:
+    // Records that a read of count bytes ran past the end of the input
+    void short_of(size_t count)
+    {
+        eof_ = true;
+        size_t required = (input_ptr_ - mark_) + count;
+        if (required > required_)
+        {
+            required_ = required;
+        }
+    }
+};
+
 }
 
 #endif
@@ -26,6 +26,7 @@ class basic_staj_array_iterator
 
     basic_staj_reader<char_type>* reader_;
     T value_;
+    bool done_;
 public:
     typedef T value_type;
     typedef std::ptrdiff_t difference_type;
@@ -34,12 +35,12 @@ public:
     typedef std::input_iterator_tag iterator_category;
 
     basic_staj_array_iterator() noexcept
-        : reader_(nullptr)
+        : reader_(nullptr), done_(true)
     {
     }
 
     basic_staj_array_iterator(basic_staj_reader<char_type>& reader)
-        : reader_(std::addressof(reader))
+        : reader_(std::addressof(reader)), done_(false)
     {
         if (reader_->current().event_type() == staj_event_type::begin_array)
         {
@@ -53,7 +54,7 @@ public:
 
     basic_staj_array_iterator(basic_staj_reader<char_type>& reader,
                         std::error_code& ec)
-        : reader_(std::addressof(reader))
+        : reader_(std::addressof(reader)), done_(false)
     {
         if (reader_->current().event_type() == staj_event_type::begin_array)
         {
@@ -102,6 +103,10 @@ public:
         return temp;
     }
 
+    void skip();
+
+    void skip(std::error_code& ec);
+
     friend bool operator==(const basic_staj_array_iterator<CharT, T>& a, const basic_staj_array_iterator<CharT, T>& b)
     {
         return (!a.reader_ && !b.reader_)
@@ -116,7 +121,14 @@ public:
 
 private:
 
+    // done_ is updated each time the reader moves past a whole member, since after a
+    // nested container has been read the reader's current event is that container's end
     bool done() const
+    {
+        return done_;
+    }
+
+    bool at_end() const
     {
         return reader_->done() || reader_->current().event_type() == staj_event_type::end_array;
     }
@@ -153,15 +165,16 @@ public:
 private:
     basic_staj_reader<char_type>* reader_;
     value_type kv_;
+    bool done_;
 public:
 
     basic_staj_object_iterator() noexcept
-        : reader_(nullptr)
+        : reader_(nullptr), done_(true)
     {
     }
 
     basic_staj_object_iterator(basic_staj_reader<char_type>& reader)
-        : reader_(std::addressof(reader))
+        : reader_(std::addressof(reader)), done_(false)
     {
         if (reader_->current().event_type() == staj_event_type::begin_object)
         {
@@ -175,7 +188,7 @@ public:
 
     basic_staj_object_iterator(basic_staj_reader<char_type>& reader, 
                          std::error_code& ec)
-        : reader_(std::addressof(reader))
+        : reader_(std::addressof(reader)), done_(false)
     {
         if (reader_->current().event_type() == staj_event_type::begin_object)
         {
@@ -224,6 +237,10 @@ public:
         return temp;
     }
 
+    void skip();
+
+    void skip(std::error_code& ec);
+
     friend bool operator==(const basic_staj_object_iterator<CharT,T>& a, const basic_staj_object_iterator<CharT,T>& b)
     {
         return (!a.reader_ && !b.reader_)
@@ -238,7 +255,14 @@ public:
 
 private:
 
+    // done_ is updated each time the reader moves past a whole member, since after a
+    // nested container has been read the reader's current event is that container's end
     bool done() const
+    {
+        return done_;
+    }
+
+    bool at_end() const
     {
         return reader_->done() || reader_->current().event_type() == staj_event_type::end_object;
     }
@@ -308,6 +332,7 @@ void basic_staj_array_iterator<CharT,T>::next()
     if (!done())
     {
         reader_->next();
+        done_ = at_end();
         if (!done())
         {
             decode_stream(*reader_, value_);
@@ -325,6 +350,7 @@ void basic_staj_array_iterator<CharT,T>::next(std::error_code& ec)
         {
             return;
         }
+        done_ = at_end();
         if (!done())
         {
             decode_stream(*reader_, value_, ec);
@@ -336,11 +362,13 @@ template<class CharT, class T>
 void basic_staj_object_iterator<CharT,T>::next()
 {
     reader_->next();
+    done_ = at_end();
     if (!done())
     {
         JSONCONS_ASSERT(reader_->current().event_type() == staj_event_type::name);
         kv_.first =reader_->current(). template as<key_type>();
         reader_->next();
+        done_ = reader_->done();
         if (!done())
         {
             decode_stream(*reader_, kv_.second);
@@ -356,6 +384,7 @@ void basic_staj_object_iterator<CharT,T>::next(std::error_code& ec)
     {
         return;
     }
+    done_ = at_end();
     if (!done())
     {
         JSONCONS_ASSERT(reader_->current().event_type() == staj_event_type::name);
@@ -365,6 +394,7 @@ void basic_staj_object_iterator<CharT,T>::next(std::error_code& ec)
         {
             return;
         }
+        done_ = reader_->done();
         if (!done())
         {
              decode_stream(*reader_, kv_.second, ec);
@@ -372,7 +402,88 @@ void basic_staj_object_iterator<CharT,T>::next(std::error_code& ec)
     }
 }
 
+template<class CharT, class T>
+void basic_staj_array_iterator<CharT,T>::skip()
+{
+    basic_staj_reader<char_type>* reader = reader_;
+    std::error_code ec;
+    skip(ec);
+    if (ec)
+    {
+        throw serialization_error(ec,reader->context().line_number(),reader->context().column_number());
+    }
 }
 
-#endif
+template<class CharT, class T>
+void basic_staj_array_iterator<CharT,T>::skip(std::error_code& ec)
+{
+    while (reader_ && !done())
+    {
+        reader_->next(ec);
+        if (ec)
+        {
+            reader_ = nullptr;
+            return;
+        }
+        done_ = at_end();
+        if (!done())
+        {
+            reader_->skip(ec);
+            if (ec)
+            {
+                reader_ = nullptr;
+                return;
+            }
+        }
+    }
+}
+
+template<class CharT, class T>
+void basic_staj_object_iterator<CharT,T>::skip()
+{
+    basic_staj_reader<char_type>* reader = reader_;
+    std::error_code ec;
+    skip(ec);
+    if (ec)
+    {
+        throw serialization_error(ec,reader->context().line_number(),reader->context().column_number());
+    }
+}
+
+template<class CharT, class T>
+void basic_staj_object_iterator<CharT,T>::skip(std::error_code& ec)
+{
+    while (reader_ && !done())
+    {
+        reader_->next(ec);
+        if (ec)
+        {
+            reader_ = nullptr;
+            return;
+        }
+        done_ = at_end();
+        if (!done())
+        {
+            reader_->next(ec);
+            if (ec)
+            {
+                reader_ = nullptr;
+                return;
+            }
+            done_ = reader_->done();
+            if (!done())
+            {
+                reader_->skip(ec);
+                if (ec)
+                {
+                    reader_ = nullptr;
+                    return;
+                }
+            }
+        }
+    }
+}
+
+}
 
+#endif
@@ -97,6 +97,13 @@ public:
         value_.string_data_ = data;
     }
 
+    basic_staj_event(const uint8_t* data, size_t length,
+        semantic_tag_type semantic_tag)
+        : event_type_(staj_event_type::byte_string_value), semantic_tag_(semantic_tag), length_(length)
+    {
+        value_.byte_string_data_ = data;
+    }
+
     template<class T, class CharT_ = CharT>
     typename std::enable_if<jsoncons::detail::is_string_like<T>::value && std::is_same<typename T::value_type, CharT_>::value, T>::type
         as() const
@@ -207,6 +214,17 @@ public:
         return as_bool();
     }
 
+    template<class T>
+    typename std::enable_if<std::is_same<T, byte_string_view>::value || std::is_same<T, byte_string>::value, T>::type
+        as() const
+    {
+        if (event_type_ != staj_event_type::byte_string_value)
+        {
+            JSONCONS_THROW(json_exception_impl<std::runtime_error>("Not a byte string"));
+        }
+        return T(value_.byte_string_data_, length_);
+    }
+
     staj_event_type event_type() const noexcept { return event_type_; }
 
     semantic_tag_type semantic_tag() const noexcept { return semantic_tag_; }
@@ -359,6 +377,47 @@ private:
 
 };
 
+namespace detail {
+
+// Reports event to handler, returning the handler's result
+template<class CharT>
+bool send_event(const basic_staj_event<CharT>& event,
+                basic_json_content_handler<CharT>& handler,
+                const serializing_context& context)
+{
+    switch (event.event_type())
+    {
+        case staj_event_type::begin_array:
+            return handler.begin_array(event.semantic_tag(), context);
+        case staj_event_type::end_array:
+            return handler.end_array(context);
+        case staj_event_type::begin_object:
+            return handler.begin_object(event.semantic_tag(), context);
+        case staj_event_type::end_object:
+            return handler.end_object(context);
+        case staj_event_type::name:
+            return handler.name(event.template as<jsoncons::basic_string_view<CharT>>(), context);
+        case staj_event_type::string_value:
+            return handler.string_value(event.template as<jsoncons::basic_string_view<CharT>>(), event.semantic_tag(), context);
+        case staj_event_type::byte_string_value:
+            return handler.byte_string_value(event.template as<byte_string_view>(), event.semantic_tag(), context);
+        case staj_event_type::null_value:
+            return handler.null_value(event.semantic_tag(), context);
+        case staj_event_type::bool_value:
+            return handler.bool_value(event.template as<bool>(), event.semantic_tag(), context);
+        case staj_event_type::int64_value:
+            return handler.int64_value(event.template as<int64_t>(), event.semantic_tag(), context);
+        case staj_event_type::uint64_value:
+            return handler.uint64_value(event.template as<uint64_t>(), event.semantic_tag(), context);
+        case staj_event_type::double_value:
+            return handler.double_value(event.template as<double>(), event.semantic_tag(), context);
+        default:
+            return true;
+    }
+}
+
+}
+
 template<class CharT>
 class basic_staj_reader
 {
@@ -379,6 +438,49 @@ public:
     virtual void next(std::error_code& ec) = 0;
 
     virtual const serializing_context& context() const = 0;
+
+    virtual void skip()
+    {
+        std::error_code ec;
+        skip(ec);
+        if (ec)
+        {
+            throw serialization_error(ec,context().line_number(),context().column_number());
+        }
+    }
+
+    // If the current event begins an array or object, advances to the matching end event,
+    // otherwise leaves the reader where it is. Readers that can scan past the content
+    // without reporting its events override this.
+    virtual void skip(std::error_code& ec)
+    {
+        size_t depth = 0;
+        for (;;)
+        {
+            switch (current().event_type())
+            {
+                case staj_event_type::begin_array:
+                case staj_event_type::begin_object:
+                    ++depth;
+                    break;
+                case staj_event_type::end_array:
+                case staj_event_type::end_object:
+                    --depth;
+                    break;
+                default:
+                    break;
+            }
+            if (depth == 0 || done())
+            {
+                return;
+            }
+            next(ec);
+            if (ec)
+            {
+                return;
+            }
+        }
+    }
 };
 
 template<class CharT>
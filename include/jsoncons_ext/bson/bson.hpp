@@ -16,13 +16,15 @@
 #include <jsoncons/config/binary_detail.hpp>
 #include <jsoncons_ext/bson/bson_serializer.hpp>
 #include <jsoncons_ext/bson/bson_reader.hpp>
+#include <jsoncons_ext/bson/bson_pull_reader.hpp>
 
 namespace jsoncons { namespace bson {
 
 // decode_bson
 
 template<class Json>
-Json decode_bson(const std::vector<uint8_t>& v)
+typename std::enable_if<jsoncons::detail::is_basic_json_class<Json>::value,Json>::type 
+decode_bson(const std::vector<uint8_t>& v)
 {
     jsoncons::json_decoder<Json> decoder;
     basic_bson_reader<jsoncons::buffer_source> parser{ v, decoder };
@@ -36,7 +38,7 @@ Json decode_bson(const std::vector<uint8_t>& v)
 }
 
 template<class Json>
-typename std::enable_if<std::is_same<typename Json::char_type,char>::value,Json>::type 
+typename std::enable_if<jsoncons::detail::is_basic_json_class<Json>::value && std::is_same<typename Json::char_type,char>::value,Json>::type 
 decode_bson(std::basic_istream<typename Json::char_type>& is)
 {
     //typedef typename Json::char_type char_type;
@@ -53,7 +55,7 @@ decode_bson(std::basic_istream<typename Json::char_type>& is)
 }
 
 template<class Json>
-typename std::enable_if<!std::is_same<typename Json::char_type,char>::value,Json>::type 
+typename std::enable_if<jsoncons::detail::is_basic_json_class<Json>::value && !std::is_same<typename Json::char_type,char>::value,Json>::type 
 decode_bson(std::basic_istream<typename Json::char_type>& is)
 {
     //typedef typename Json::char_type char_type;
@@ -70,6 +72,28 @@ decode_bson(std::basic_istream<typename Json::char_type>& is)
     return decoder.get_result();
 }
 
+// Decodes a BSON document into T with conversion_traits<T>
+
+template<class T>
+typename std::enable_if<!jsoncons::detail::is_basic_json_class<T>::value,T>::type 
+decode_bson(const std::vector<uint8_t>& v)
+{
+    bson_buffer_pull_reader reader(v);
+    T val;
+    decode_stream(reader, val);
+    return val;
+}
+
+template<class T>
+typename std::enable_if<!jsoncons::detail::is_basic_json_class<T>::value,T>::type 
+decode_bson(std::istream& is)
+{
+    bson_pull_reader reader(is);
+    T val;
+    decode_stream(reader, val);
+    return val;
+}
+
 // encode_bson
 
 template<class Json>
@@ -17,7 +17,8 @@ enum class bson_errc
     ok = 0,
     unexpected_eof = 1,
     source_error,
-    invalid_utf8_text_string
+    invalid_utf8_text_string,
+    unknown_type
 };
 
 class bson_error_category_impl
@@ -38,6 +39,8 @@ public:
                 return "Source error";
             case bson_errc::invalid_utf8_text_string:
                 return "Illegal UTF-8 encoding in text string";
+            case bson_errc::unknown_type:
+                return "An unknown type was found in the stream";
            default:
                 return "Unknown BSON parser error";
         }
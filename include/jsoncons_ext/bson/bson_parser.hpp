@@ -0,0 +1,473 @@
+// Copyright 2017 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_BSON_BSON_PARSER_HPP
+#define JSONCONS_BSON_BSON_PARSER_HPP
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <utility> // std::move
+#include <jsoncons/json.hpp>
+#include <jsoncons/source.hpp>
+#include <jsoncons/json_content_handler.hpp>
+#include <jsoncons/config/binary_detail.hpp>
+#include <jsoncons_ext/bson/bson_detail.hpp>
+#include <jsoncons_ext/bson/bson_error.hpp>
+
+namespace jsoncons { namespace bson {
+
+enum class bson_parse_mode {root,before_done,document,document_value,array};
+
+struct bson_parse_state
+{
+    bson_parse_mode mode;
+    uint8_t type;
+
+    bson_parse_state(bson_parse_mode mode)
+        : mode(mode), type(0)
+    {
+    }
+};
+
+// Reads one BSON document from source, reporting its events to a handler. Embedded
+// documents and arrays are tracked on an explicit stack, so nesting depth doesn't grow
+// the call stack, and parsing stops after any event for which the handler returns false,
+// resuming there on the next call to parse. With a partial_buffer_source, the input may
+// be given a piece at a time with update and parse_some.
+
+template <class Source>
+class basic_bson_parser : public serializing_context
+{
+    Source source_;
+    bool continue_;
+    bool done_;
+    std::string buffer_;
+    std::vector<uint8_t> bytes_buffer_;
+    std::vector<bson_parse_state> state_stack_;
+public:
+    typedef Source source_type;
+
+    basic_bson_parser(Source source)
+       : source_(std::move(source)),
+         continue_(true),
+         done_(false)
+    {
+        state_stack_.emplace_back(bson_parse_mode::root);
+    }
+
+    // Prepares to read the next document from the source
+    void reset()
+    {
+        state_stack_.clear();
+        state_stack_.emplace_back(bson_parse_mode::root);
+        continue_ = true;
+        done_ = false;
+    }
+
+    bool done() const
+    {
+        return done_;
+    }
+
+    bool stopped() const
+    {
+        return !continue_;
+    }
+
+    void restart()
+    {
+        continue_ = true;
+    }
+
+    void parse(json_content_handler& handler, std::error_code& ec)
+    {
+        try
+        {
+            while (!done_ && continue_)
+            {
+                parse_step(handler, ec);
+                if (ec)
+                {
+                    return;
+                }
+            }
+        }
+        catch (const serialization_error& e)
+        {
+            ec = e.code();
+        }
+    }
+
+    // Gives the parser the next piece of input, when Source is partial_buffer_source
+    void update(const uint8_t* data, size_t length)
+    {
+        source_.update(data, length);
+    }
+
+    bool source_exhausted() const
+    {
+        return source_.exhausted();
+    }
+
+    // Parses the input given to update so far. An item that runs past the end of it is
+    // put back, along with its parse state, and read again once more input arrives.
+    void parse_some(json_content_handler& handler, std::error_code& ec)
+    {
+        if (!source_.can_resume())
+        {
+            return;
+        }
+        try
+        {
+            while (!done_ && continue_)
+            {
+                bson_parse_state state = state_stack_.back();
+                size_t depth = state_stack_.size();
+                source_.mark();
+                parse_step(handler, ec);
+                if (ec)
+                {
+                    if (ec == bson_errc::unexpected_eof && source_.eof())
+                    {
+                        source_.rewind();
+                        if (state_stack_.size() > depth)
+                        {
+                            state_stack_.erase(state_stack_.begin() + depth, state_stack_.end());
+                        }
+                        state_stack_.back() = state;
+                        ec = std::error_code();
+                    }
+                    return;
+                }
+            }
+        }
+        catch (const serialization_error& e)
+        {
+            ec = e.code();
+        }
+    }
+
+    size_t line_number() const override
+    {
+        return 0;
+    }
+
+    size_t column_number() const override
+    {
+        return source_.position();
+    }
+private:
+    void parse_step(json_content_handler& handler, std::error_code& ec)
+    {
+        bson_parse_state& state = state_stack_.back();
+        switch (state.mode)
+        {
+            case bson_parse_mode::document:
+            {
+                uint8_t type = read_element_type(ec);
+                if (ec)
+                {
+                    return;
+                }
+                if (type == 0x00)
+                {
+                    state_stack_.pop_back();
+                    continue_ = handler.end_object(*this);
+                }
+                else
+                {
+                    read_element_name(ec);
+                    if (ec)
+                    {
+                        return;
+                    }
+                    state.type = type;
+                    state.mode = bson_parse_mode::document_value;
+                    continue_ = handler.name(basic_string_view<char>(buffer_.data(),buffer_.length()), *this);
+                }
+                break;
+            }
+            case bson_parse_mode::document_value:
+            {
+                state.mode = bson_parse_mode::document;
+                read_item(handler, state.type, ec);
+                if (ec)
+                {
+                    return;
+                }
+                break;
+            }
+            case bson_parse_mode::array:
+            {
+                uint8_t type = read_element_type(ec);
+                if (ec)
+                {
+                    return;
+                }
+                if (type == 0x00)
+                {
+                    state_stack_.pop_back();
+                    continue_ = handler.end_array(*this);
+                }
+                else
+                {
+                    // array element names are the indices "0", "1", ...
+                    read_element_name(ec);
+                    if (ec)
+                    {
+                        return;
+                    }
+                    read_item(handler, type, ec);
+                    if (ec)
+                    {
+                        return;
+                    }
+                }
+                break;
+            }
+            case bson_parse_mode::root:
+            {
+                if (source_.is_error())
+                {
+                    ec = bson_errc::source_error;
+                    return;
+                }
+                state.mode = bson_parse_mode::before_done;
+                read_item(handler, bson_format::document_cd, ec);
+                if (ec)
+                {
+                    return;
+                }
+                break;
+            }
+            case bson_parse_mode::before_done:
+            {
+                JSONCONS_ASSERT(state_stack_.size() == 1);
+                handler.flush();
+                done_ = true;
+                break;
+            }
+        }
+    }
+
+
+    void read_item(json_content_handler& handler, uint8_t type, std::error_code& ec)
+    {
+        switch (type)
+        {
+            case bson_format::double_cd:
+            {
+                double res = read_number<double>(ec);
+                if (ec)
+                {
+                    return;
+                }
+                continue_ = handler.double_value(res, semantic_tag_type::none, *this);
+                break;
+            }
+            case bson_format::string_cd:
+            {
+                int32_t len = read_number<int32_t>(ec);
+                if (ec)
+                {
+                    return;
+                }
+                if (len < 1)
+                {
+                    ec = bson_errc::unexpected_eof;
+                    return;
+                }
+
+                buffer_.clear();
+                if ((int32_t)source_.read(std::back_inserter(buffer_), len-1) != len-1)
+                {
+                    ec = bson_errc::unexpected_eof;
+                    return;
+                }
+                uint8_t c{};
+                if (source_.get(c) == 0) // discard 0
+                {
+                    ec = bson_errc::unexpected_eof;
+                    return;
+                }
+                auto result = unicons::validate(buffer_.begin(),buffer_.end());
+                if (result.ec != unicons::conv_errc())
+                {
+                    ec = bson_errc::invalid_utf8_text_string;
+                    return;
+                }
+                continue_ = handler.string_value(basic_string_view<char>(buffer_.data(),buffer_.length()), semantic_tag_type::none, *this);
+                break;
+            }
+            case bson_format::document_cd:
+            {
+                /* auto len = */ read_number<int32_t>(ec);
+                if (ec)
+                {
+                    return;
+                }
+                state_stack_.emplace_back(bson_parse_mode::document);
+                continue_ = handler.begin_object(semantic_tag_type::none, *this);
+                break;
+            }
+
+            case bson_format::array_cd:
+            {
+                /* auto len = */ read_number<int32_t>(ec);
+                if (ec)
+                {
+                    return;
+                }
+                state_stack_.emplace_back(bson_parse_mode::array);
+                continue_ = handler.begin_array(semantic_tag_type::none, *this);
+                break;
+            }
+            case bson_format::null_cd:
+            {
+                continue_ = handler.null_value(semantic_tag_type::none, *this);
+                break;
+            }
+            case bson_format::bool_cd:
+            {
+                uint8_t val{};
+                if (source_.get(val) == 0)
+                {
+                    ec = bson_errc::unexpected_eof;
+                    return;
+                }
+                continue_ = handler.bool_value(val != 0, semantic_tag_type::none, *this);
+                break;
+            }
+            case bson_format::int32_cd:
+            {
+                int32_t val = read_number<int32_t>(ec);
+                if (ec)
+                {
+                    return;
+                }
+                continue_ = handler.int64_value(val, semantic_tag_type::none, *this);
+                break;
+            }
+
+            case bson_format::timestamp_cd:
+            {
+                uint64_t val = read_number<uint64_t>(ec);
+                if (ec)
+                {
+                    return;
+                }
+                continue_ = handler.uint64_value(val, semantic_tag_type::timestamp, *this);
+                break;
+            }
+
+            case bson_format::int64_cd:
+            {
+                int64_t val = read_number<int64_t>(ec);
+                if (ec)
+                {
+                    return;
+                }
+                continue_ = handler.int64_value(val, semantic_tag_type::none, *this);
+                break;
+            }
+
+            case bson_format::datetime_cd:
+            {
+                int64_t val = read_number<int64_t>(ec);
+                if (ec)
+                {
+                    return;
+                }
+                continue_ = handler.int64_value(val, semantic_tag_type::timestamp, *this);
+                break;
+            }
+            case bson_format::binary_cd:
+            {
+                int32_t len = read_number<int32_t>(ec);
+                if (ec)
+                {
+                    return;
+                }
+                if (len < 0)
+                {
+                    ec = bson_errc::unexpected_eof;
+                    return;
+                }
+
+                bytes_buffer_.clear();
+                if ((int32_t)source_.read(std::back_inserter(bytes_buffer_), len) != len)
+                {
+                    ec = bson_errc::unexpected_eof;
+                    return;
+                }
+
+                continue_ = handler.byte_string_value(byte_string_view(bytes_buffer_.data(),bytes_buffer_.size()),
+                                                      semantic_tag_type::none,
+                                                      *this);
+                break;
+            }
+            default:
+            {
+                ec = bson_errc::unknown_type;
+                return;
+            }
+        }
+    }
+
+    uint8_t read_element_type(std::error_code& ec)
+    {
+        uint8_t type{};
+        if (source_.get(type) == 0)
+        {
+            ec = bson_errc::unexpected_eof;
+        }
+        return type;
+    }
+
+    // Reads an element name, a null terminated string, into buffer_
+    void read_element_name(std::error_code& ec)
+    {
+        buffer_.clear();
+        uint8_t c{};
+        for (;;)
+        {
+            if (source_.get(c) == 0)
+            {
+                ec = bson_errc::unexpected_eof;
+                return;
+            }
+            if (c == 0)
+            {
+                break;
+            }
+            buffer_.push_back(c);
+        }
+        auto result = unicons::validate(buffer_.begin(),buffer_.end());
+        if (result.ec != unicons::conv_errc())
+        {
+            ec = bson_errc::invalid_utf8_text_string;
+            return;
+        }
+    }
+
+    template <class T>
+    T read_number(std::error_code& ec)
+    {
+        uint8_t buf[sizeof(T)];
+        if (source_.read(buf, sizeof(T)) != sizeof(T))
+        {
+            ec = bson_errc::unexpected_eof;
+            return T();
+        }
+        const uint8_t* endp;
+        return jsoncons::detail::from_little_endian<T>(buf,buf+sizeof(buf),&endp);
+    }
+};
+
+}}
+
+#endif
@@ -0,0 +1,25 @@
+// Copyright 2018 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_BSON_BSON_PULL_READER_HPP
+#define JSONCONS_BSON_BSON_PULL_READER_HPP
+
+#include <jsoncons/source.hpp>
+#include <jsoncons/binary_pull_reader.hpp>
+#include <jsoncons_ext/bson/bson_parser.hpp>
+
+namespace jsoncons { namespace bson {
+
+template <class Source>
+using basic_bson_pull_reader = basic_binary_pull_reader<basic_bson_parser<Source>>;
+
+typedef basic_bson_pull_reader<jsoncons::binary_stream_source> bson_pull_reader;
+
+typedef basic_bson_pull_reader<jsoncons::buffer_source> bson_buffer_pull_reader;
+
+}}
+
+#endif
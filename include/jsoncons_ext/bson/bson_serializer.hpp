@@ -248,22 +248,17 @@ private:
         if (tag == semantic_tag_type::timestamp)
         {
             before_value(bson_format::datetime_cd);
+            jsoncons::detail::to_little_endian(val,std::back_inserter(buffer_));
         }
-        else
-        {
-            before_value(bson_format::int64_cd);
-        }
-        if (val >= (std::numeric_limits<int32_t>::lowest)() && val <= (std::numeric_limits<int32_t>::max)())
+        else if (val >= (std::numeric_limits<int32_t>::lowest)() && val <= (std::numeric_limits<int32_t>::max)())
         {
-            jsoncons::detail::to_little_endian(static_cast<uint32_t>(val),std::back_inserter(buffer_));
-        }
-        else if (val >= (std::numeric_limits<int64_t>::lowest)() && val <= (std::numeric_limits<int64_t>::max)())
-        {
-            jsoncons::detail::to_little_endian(static_cast<int64_t>(val),std::back_inserter(buffer_));
+            before_value(bson_format::int32_cd);
+            jsoncons::detail::to_little_endian(static_cast<int32_t>(val),std::back_inserter(buffer_));
         }
         else
         {
-            // error
+            before_value(bson_format::int64_cd);
+            jsoncons::detail::to_little_endian(val,std::back_inserter(buffer_));
         }
 
         return true;
@@ -276,18 +271,17 @@ private:
         if (tag == semantic_tag_type::timestamp)
         {
             before_value(bson_format::datetime_cd);
+            jsoncons::detail::to_little_endian(static_cast<int64_t>(val),std::back_inserter(buffer_));
         }
-        else
-        {
-            before_value(bson_format::int64_cd);
-        }
-        if (val <= (std::numeric_limits<int32_t>::max)())
+        else if (val <= (std::numeric_limits<int32_t>::max)())
         {
-            jsoncons::detail::to_little_endian(static_cast<uint32_t>(val),std::back_inserter(buffer_));
+            before_value(bson_format::int32_cd);
+            jsoncons::detail::to_little_endian(static_cast<int32_t>(val),std::back_inserter(buffer_));
         }
         else if (val <= (uint64_t)(std::numeric_limits<int64_t>::max)())
         {
-            jsoncons::detail::to_little_endian(static_cast<uint64_t>(val),std::back_inserter(buffer_));
+            before_value(bson_format::int64_cd);
+            jsoncons::detail::to_little_endian(static_cast<int64_t>(val),std::back_inserter(buffer_));
         }
         else
         {
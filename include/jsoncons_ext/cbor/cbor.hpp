@@ -16,6 +16,7 @@
 #include <jsoncons/json_filter.hpp>
 #include <jsoncons/config/binary_detail.hpp>
 #include <jsoncons_ext/cbor/cbor_reader.hpp>
+#include <jsoncons_ext/cbor/cbor_pull_reader.hpp>
 #include <jsoncons_ext/cbor/cbor_serializer.hpp>
 
 #if !defined(JSONCONS_NO_DEPRECATED)
@@ -45,7 +46,7 @@ void encode_cbor(const Json& j, std::vector<uint8_t>& v)
 // decode_cbor
 
 template<class Json>
-typename std::enable_if<std::is_same<typename Json::char_type,char>::value,Json>::type 
+typename std::enable_if<jsoncons::detail::is_basic_json_class<Json>::value && std::is_same<typename Json::char_type,char>::value,Json>::type 
 decode_cbor(const std::vector<uint8_t>& v)
 {
     jsoncons::json_decoder<Json> decoder;
@@ -60,7 +61,7 @@ decode_cbor(const std::vector<uint8_t>& v)
 }
 
 template<class Json>
-typename std::enable_if<!std::is_same<typename Json::char_type,char>::value,Json>::type 
+typename std::enable_if<jsoncons::detail::is_basic_json_class<Json>::value && !std::is_same<typename Json::char_type,char>::value,Json>::type 
 decode_cbor(const std::vector<uint8_t>& v)
 {
     jsoncons::json_decoder<Json> decoder;
@@ -109,7 +110,7 @@ decode_cbor(const cbor_view& v)
 #endif
 
 template<class Json>
-typename std::enable_if<std::is_same<typename Json::char_type,char>::value,Json>::type 
+typename std::enable_if<jsoncons::detail::is_basic_json_class<Json>::value && std::is_same<typename Json::char_type,char>::value,Json>::type 
 decode_cbor(std::basic_istream<typename Json::char_type>& is)
 {
     //typedef typename Json::char_type char_type;
@@ -126,7 +127,7 @@ decode_cbor(std::basic_istream<typename Json::char_type>& is)
 }
 
 template<class Json>
-typename std::enable_if<!std::is_same<typename Json::char_type,char>::value,Json>::type 
+typename std::enable_if<jsoncons::detail::is_basic_json_class<Json>::value && !std::is_same<typename Json::char_type,char>::value,Json>::type 
 decode_cbor(std::basic_istream<typename Json::char_type>& is)
 {
     //typedef typename Json::char_type char_type;
@@ -143,6 +144,28 @@ decode_cbor(std::basic_istream<typename Json::char_type>& is)
     return decoder.get_result();
 }
   
+// decode_cbor<T> for T other than basic_json
+
+template<class T>
+typename std::enable_if<!jsoncons::detail::is_basic_json_class<T>::value,T>::type 
+decode_cbor(const std::vector<uint8_t>& v)
+{
+    cbor_buffer_pull_reader reader(v);
+    T val;
+    decode_stream(reader, val);
+    return val;
+}
+
+template<class T>
+typename std::enable_if<!jsoncons::detail::is_basic_json_class<T>::value,T>::type 
+decode_cbor(std::istream& is)
+{
+    cbor_pull_reader reader(is);
+    T val;
+    decode_stream(reader, val);
+    return val;
+}
+
 #if !defined(JSONCONS_NO_DEPRECATED)
 template<class Json>
 std::vector<uint8_t> encode_cbor(const Json& j)
@@ -612,6 +612,11 @@ uint64_t get_uint64_value(Source& source, std::error_code& ec)
         {
             uint8_t buf[sizeof(uint16_t)];
             source.read(buf, sizeof(uint16_t));
+            if (source.eof())
+            {
+                ec = cbor_errc::unexpected_eof;
+                return 0;
+            }
             val = jsoncons::detail::from_big_endian<uint16_t>(buf,buf+sizeof(buf),&endp);
             break;
         }
@@ -620,6 +625,11 @@ uint64_t get_uint64_value(Source& source, std::error_code& ec)
         {
             uint8_t buf[sizeof(uint32_t)];
             source.read(buf, sizeof(uint32_t));
+            if (source.eof())
+            {
+                ec = cbor_errc::unexpected_eof;
+                return 0;
+            }
             val = jsoncons::detail::from_big_endian<uint32_t>(buf,buf+sizeof(buf),&endp);
             break;
         }
@@ -628,6 +638,11 @@ uint64_t get_uint64_value(Source& source, std::error_code& ec)
         {
             uint8_t buf[sizeof(uint64_t)];
             source.read(buf, sizeof(uint64_t));
+            if (source.eof())
+            {
+                ec = cbor_errc::unexpected_eof;
+                return 0;
+            }
             val = jsoncons::detail::from_big_endian<uint64_t>(buf,buf+sizeof(buf),&endp);
             break;
         }
@@ -678,6 +693,7 @@ int64_t get_int64_value(Source& source, std::error_code& ec)
                         uint8_t buf[sizeof(uint16_t)];
                         if (source.read(buf, sizeof(uint16_t)) != sizeof(uint16_t))
                         {
+                            ec = cbor_errc::unexpected_eof;
                             return val;
                         }
                         auto x = jsoncons::detail::from_big_endian<uint16_t>(buf,buf+sizeof(buf),&endp);
@@ -690,6 +706,7 @@ int64_t get_int64_value(Source& source, std::error_code& ec)
                         uint8_t buf[sizeof(uint32_t)];
                         if (source.read(buf, sizeof(uint32_t)) != sizeof(uint32_t))
                         {
+                            ec = cbor_errc::unexpected_eof;
                             return val;
                         }
                         auto x = jsoncons::detail::from_big_endian<uint32_t>(buf,buf+sizeof(buf),&endp);
@@ -702,6 +719,7 @@ int64_t get_int64_value(Source& source, std::error_code& ec)
                         uint8_t buf[sizeof(uint64_t)];
                         if (source.read(buf, sizeof(uint64_t)) != sizeof(uint64_t))
                         {
+                            ec = cbor_errc::unexpected_eof;
                             return val;
                         }
                         auto x = jsoncons::detail::from_big_endian<uint64_t>(buf,buf+sizeof(buf),&endp);
@@ -980,7 +998,12 @@ std::string get_array_as_decimal_string(Source& source, std::error_code& ec)
         }
     }
 
-    switch (get_major_type((uint8_t)source.peek()))
+    if ((c=source.peek()) == Source::traits_type::eof())
+    {
+        ec = cbor_errc::unexpected_eof;
+        return s;
+    }
+    switch (get_major_type((uint8_t)c))
     {
         case cbor_major_type::unsigned_integer:
         {
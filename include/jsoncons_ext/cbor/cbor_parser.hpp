@@ -0,0 +1,648 @@
+// Copyright 2017 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_CBOR_CBOR_PARSER_HPP
+#define JSONCONS_CBOR_CBOR_PARSER_HPP
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <utility> // std::move
+#include <jsoncons/json.hpp>
+#include <jsoncons/source.hpp>
+#include <jsoncons/json_content_handler.hpp>
+#include <jsoncons/config/binary_detail.hpp>
+#include <jsoncons_ext/cbor/cbor_error.hpp>
+#include <jsoncons_ext/cbor/cbor_detail.hpp>
+
+namespace jsoncons { namespace cbor {
+
+enum class cbor_parse_mode {root,before_done,array,indefinite_array,map_key,map_value,indefinite_map_key,indefinite_map_value};
+
+struct cbor_parse_state
+{
+    cbor_parse_mode mode;
+    size_t length;
+    size_t index;
+
+    cbor_parse_state(cbor_parse_mode mode, size_t length)
+        : mode(mode), length(length), index(0)
+    {
+    }
+};
+
+// Reads one CBOR item from source, reporting its events to a handler. Containers are
+// tracked on an explicit stack, so nesting depth doesn't grow the call stack, and parsing
+// stops after any event for which the handler returns false, resuming there on the
+// next call to parse. With a partial_buffer_source, the input may be given a piece at a
+// time with update and parse_some.
+
+template <class Source>
+class basic_cbor_parser : public serializing_context
+{
+    Source source_;
+    bool continue_;
+    bool done_;
+    std::string buffer_;
+    std::vector<cbor_parse_state> state_stack_;
+public:
+    typedef Source source_type;
+
+    basic_cbor_parser(Source source)
+       : source_(std::move(source)),
+         continue_(true),
+         done_(false)
+    {
+        state_stack_.emplace_back(cbor_parse_mode::root,0);
+    }
+
+    // Prepares to read the next item from the source
+    void reset()
+    {
+        state_stack_.clear();
+        state_stack_.emplace_back(cbor_parse_mode::root,0);
+        continue_ = true;
+        done_ = false;
+    }
+
+    bool done() const
+    {
+        return done_;
+    }
+
+    bool stopped() const
+    {
+        return !continue_;
+    }
+
+    void restart()
+    {
+        continue_ = true;
+    }
+
+    void parse(json_content_handler& handler, std::error_code& ec)
+    {
+        try
+        {
+            while (!done_ && continue_)
+            {
+                parse_step(handler, ec);
+                if (ec)
+                {
+                    return;
+                }
+            }
+        }
+        catch (const serialization_error& e)
+        {
+            ec = e.code();
+        }
+    }
+
+    // Gives the parser the next piece of input, when Source is partial_buffer_source
+    void update(const uint8_t* data, size_t length)
+    {
+        source_.update(data, length);
+    }
+
+    bool source_exhausted() const
+    {
+        return source_.exhausted();
+    }
+
+    // Parses the input given to update so far. An item that runs past the end of it is
+    // put back, along with its parse state, and read again once more input arrives.
+    void parse_some(json_content_handler& handler, std::error_code& ec)
+    {
+        if (!source_.can_resume())
+        {
+            return;
+        }
+        try
+        {
+            while (!done_ && continue_)
+            {
+                cbor_parse_state state = state_stack_.back();
+                size_t depth = state_stack_.size();
+                source_.mark();
+                parse_step(handler, ec);
+                if (ec)
+                {
+                    if (ec == cbor_errc::unexpected_eof && source_.eof())
+                    {
+                        source_.rewind();
+                        if (state_stack_.size() > depth)
+                        {
+                            state_stack_.erase(state_stack_.begin() + depth, state_stack_.end());
+                        }
+                        state_stack_.back() = state;
+                        ec = std::error_code();
+                    }
+                    return;
+                }
+            }
+        }
+        catch (const serialization_error& e)
+        {
+            ec = e.code();
+        }
+    }
+
+    size_t line_number() const override
+    {
+        return 0;
+    }
+
+    size_t column_number() const override
+    {
+        return source_.position();
+    }
+private:
+    void parse_step(json_content_handler& handler, std::error_code& ec)
+    {
+        cbor_parse_state& state = state_stack_.back();
+        switch (state.mode)
+        {
+            case cbor_parse_mode::array:
+            {
+                if (state.index < state.length)
+                {
+                    ++state.index;
+                    read_item(handler, ec);
+                    if (ec)
+                    {
+                        return;
+                    }
+                }
+                else
+                {
+                    state_stack_.pop_back();
+                    continue_ = handler.end_array(*this);
+                }
+                break;
+            }
+            case cbor_parse_mode::indefinite_array:
+            {
+                bool at_break = peek_break(ec);
+                if (ec)
+                {
+                    return;
+                }
+                if (at_break)
+                {
+                    source_.ignore(1);
+                    state_stack_.pop_back();
+                    continue_ = handler.end_array(*this);
+                }
+                else
+                {
+                    read_item(handler, ec);
+                    if (ec)
+                    {
+                        return;
+                    }
+                }
+                break;
+            }
+            case cbor_parse_mode::map_key:
+            {
+                if (state.index < state.length)
+                {
+                    ++state.index;
+                    state.mode = cbor_parse_mode::map_value;
+                    read_name(handler, ec);
+                    if (ec)
+                    {
+                        return;
+                    }
+                }
+                else
+                {
+                    state_stack_.pop_back();
+                    continue_ = handler.end_object(*this);
+                }
+                break;
+            }
+            case cbor_parse_mode::map_value:
+            {
+                state.mode = cbor_parse_mode::map_key;
+                read_item(handler, ec);
+                if (ec)
+                {
+                    return;
+                }
+                break;
+            }
+            case cbor_parse_mode::indefinite_map_key:
+            {
+                bool at_break = peek_break(ec);
+                if (ec)
+                {
+                    return;
+                }
+                if (at_break)
+                {
+                    source_.ignore(1);
+                    state_stack_.pop_back();
+                    continue_ = handler.end_object(*this);
+                }
+                else
+                {
+                    state.mode = cbor_parse_mode::indefinite_map_value;
+                    read_name(handler, ec);
+                    if (ec)
+                    {
+                        return;
+                    }
+                }
+                break;
+            }
+            case cbor_parse_mode::indefinite_map_value:
+            {
+                state.mode = cbor_parse_mode::indefinite_map_key;
+                read_item(handler, ec);
+                if (ec)
+                {
+                    return;
+                }
+                break;
+            }
+            case cbor_parse_mode::root:
+            {
+                state.mode = cbor_parse_mode::before_done;
+                read_item(handler, ec);
+                if (ec)
+                {
+                    return;
+                }
+                break;
+            }
+            case cbor_parse_mode::before_done:
+            {
+                JSONCONS_ASSERT(state_stack_.size() == 1);
+                handler.flush();
+                done_ = true;
+                break;
+            }
+        }
+    }
+
+
+    void read_item(json_content_handler& handler, std::error_code& ec)
+    {
+        if (source_.is_error())
+        {
+            ec = cbor_errc::source_error;
+            return;
+        }
+
+        bool has_cbor_tag = false;
+        uint64_t cbor_tag = 0;
+
+        cbor_major_type major_type;
+        uint8_t info;
+        int c = source_.peek();
+        switch (c)
+        {
+            case Source::traits_type::eof():
+                ec = cbor_errc::unexpected_eof;
+                return;
+            default:
+                major_type = get_major_type((uint8_t)c);
+                info = get_additional_information_value((uint8_t)c);
+                break;
+        }
+
+        if (major_type == cbor_major_type::semantic_tag)
+        {
+            has_cbor_tag = true;
+            cbor_tag = jsoncons::cbor::detail::get_uint64_value(source_, ec);
+            if (ec)
+            {
+                return;
+            }
+            c = source_.peek();
+            switch (c)
+            {
+                case Source::traits_type::eof():
+                    ec = cbor_errc::unexpected_eof;
+                    return;
+                default:
+                    major_type = get_major_type((uint8_t)c);
+                    info = get_additional_information_value((uint8_t)c);
+                    break;
+            }
+        }
+
+        switch (major_type)
+        {
+            case cbor_major_type::unsigned_integer:
+            {
+                uint64_t val = jsoncons::cbor::detail::get_uint64_value(source_, ec);
+                if (ec)
+                {
+                    return;
+                }
+                continue_ = handler.uint64_value(val,
+                                                 has_cbor_tag && cbor_tag == 1 ? semantic_tag_type::timestamp : semantic_tag_type::none,
+                                                 *this);
+                break;
+            }
+            case cbor_major_type::negative_integer:
+            {
+                int64_t val = jsoncons::cbor::detail::get_int64_value(source_, ec);
+                if (ec)
+                {
+                    return;
+                }
+                continue_ = handler.int64_value(val,
+                                                has_cbor_tag && cbor_tag == 1 ? semantic_tag_type::timestamp : semantic_tag_type::none,
+                                                *this);
+                break;
+            }
+            case cbor_major_type::byte_string:
+            {
+                std::vector<uint8_t> v = jsoncons::cbor::detail::get_byte_string(source_, ec);
+                if (ec)
+                {
+                    return;
+                }
+
+                semantic_tag_type tag = semantic_tag_type::none;
+                if (has_cbor_tag)
+                {
+                    switch (cbor_tag)
+                    {
+                        case 0x2:
+                        {
+                            bignum n(1, v.data(), v.size());
+                            buffer_.clear();
+                            n.dump(buffer_);
+                            continue_ = handler.big_integer_value(buffer_, *this);
+                            return;
+                        }
+                        case 0x3:
+                        {
+                            bignum n(-1, v.data(), v.size());
+                            buffer_.clear();
+                            n.dump(buffer_);
+                            continue_ = handler.big_integer_value(buffer_, *this);
+                            return;
+                        }
+                        case 0x15:
+                            tag = semantic_tag_type::base64url;
+                            break;
+                        case 0x16:
+                            tag = semantic_tag_type::base64;
+                            break;
+                        case 0x17:
+                            tag = semantic_tag_type::base16;
+                            break;
+                        default:
+                            break;
+                    }
+                }
+                continue_ = handler.byte_string_value(byte_string_view(v.data(), v.size()), tag, *this);
+                break;
+            }
+            case cbor_major_type::text_string:
+            {
+                semantic_tag_type tag = semantic_tag_type::none;
+                if (has_cbor_tag)
+                {
+                    switch (cbor_tag)
+                    {
+                        case 0:
+                            tag = semantic_tag_type::date_time;
+                            break;
+                        case 32:
+                            tag = semantic_tag_type::uri;
+                            break;
+                        case 33:
+                            tag = semantic_tag_type::base64url;
+                            break;
+                        case 34:
+                            tag = semantic_tag_type::base64;
+                            break;
+                        default:
+                            break;
+                    }
+                }
+                read_text_string(ec);
+                if (ec)
+                {
+                    return;
+                }
+                continue_ = handler.string_value(basic_string_view<char>(buffer_.data(),buffer_.length()), tag, *this);
+                break;
+            }
+            case cbor_major_type::array:
+            {
+                semantic_tag_type tag = semantic_tag_type::none;
+                if (has_cbor_tag)
+                {
+                    switch (cbor_tag)
+                    {
+                        case 0x04:
+                            tag = semantic_tag_type::big_decimal;
+                            break;
+                        case 0x05:
+                            tag = semantic_tag_type::big_float;
+                            break;
+                        default:
+                            break;
+                    }
+                }
+                if (tag == semantic_tag_type::big_decimal)
+                {
+                    std::string s = jsoncons::cbor::detail::get_array_as_decimal_string(source_, ec);
+                    if (ec)
+                    {
+                        return;
+                    }
+                    continue_ = handler.string_value(s, semantic_tag_type::big_decimal, *this);
+                }
+                else if (info == additional_info::indefinite_length)
+                {
+                    source_.ignore(1);
+                    state_stack_.emplace_back(cbor_parse_mode::indefinite_array,0);
+                    continue_ = handler.begin_array(tag, *this);
+                }
+                else
+                {
+                    size_t len = jsoncons::cbor::detail::get_length(source_,ec);
+                    if (ec)
+                    {
+                        return;
+                    }
+                    state_stack_.emplace_back(cbor_parse_mode::array,len);
+                    continue_ = handler.begin_array(len, tag, *this);
+                }
+                break;
+            }
+            case cbor_major_type::map:
+            {
+                if (info == additional_info::indefinite_length)
+                {
+                    source_.ignore(1);
+                    state_stack_.emplace_back(cbor_parse_mode::indefinite_map_key,0);
+                    continue_ = handler.begin_object(semantic_tag_type::none, *this);
+                }
+                else
+                {
+                    size_t len = jsoncons::cbor::detail::get_length(source_, ec);
+                    if (ec)
+                    {
+                        return;
+                    }
+                    state_stack_.emplace_back(cbor_parse_mode::map_key,len);
+                    continue_ = handler.begin_object(len, semantic_tag_type::none, *this);
+                }
+                break;
+            }
+            case cbor_major_type::semantic_tag:
+            {
+                // a tag on a tag
+                ec = cbor_errc::unknown_type;
+                return;
+            }
+            case cbor_major_type::simple:
+            {
+                switch (info)
+                {
+                    case 0x14:
+                        source_.ignore(1);
+                        continue_ = handler.bool_value(false, semantic_tag_type::none, *this);
+                        break;
+                    case 0x15:
+                        source_.ignore(1);
+                        continue_ = handler.bool_value(true, semantic_tag_type::none, *this);
+                        break;
+                    case 0x16:
+                        source_.ignore(1);
+                        continue_ = handler.null_value(semantic_tag_type::none, *this);
+                        break;
+                    case 0x17:
+                        source_.ignore(1);
+                        continue_ = handler.null_value(semantic_tag_type::undefined, *this);
+                        break;
+                    case 0x19: // Half-Precision Float (two-byte IEEE 754)
+                    case 0x1a: // Single-Precision Float (four-byte IEEE 754)
+                    case 0x1b: // Double-Precision Float (eight-byte IEEE 754)
+                    {
+                        double val = jsoncons::cbor::detail::get_double(source_, ec);
+                        if (ec)
+                        {
+                            return;
+                        }
+                        continue_ = handler.double_value(val,
+                                                         has_cbor_tag && cbor_tag == 1 ? semantic_tag_type::timestamp : semantic_tag_type::none,
+                                                         *this);
+                        break;
+                    }
+                    default:
+                        ec = cbor_errc::unknown_type;
+                        return;
+                }
+                break;
+            }
+        }
+    }
+
+    void read_name(json_content_handler& handler, std::error_code& ec)
+    {
+        cbor_major_type major_type;
+        int c = source_.peek();
+        switch (c)
+        {
+            case Source::traits_type::eof():
+                ec = cbor_errc::unexpected_eof;
+                return;
+            default:
+                major_type = get_major_type((uint8_t)c);
+                break;
+        }
+        switch (major_type)
+        {
+            case cbor_major_type::text_string:
+            {
+                read_text_string(ec);
+                if (ec)
+                {
+                    return;
+                }
+                break;
+            }
+            case cbor_major_type::byte_string:
+            {
+                std::vector<uint8_t> v = jsoncons::cbor::detail::get_byte_string(source_,ec);
+                if (ec)
+                {
+                    return;
+                }
+                buffer_.clear();
+                encode_base64url(v.data(),v.size(),buffer_);
+                break;
+            }
+            default:
+            {
+                // Other keys are written as JSON text
+                buffer_.clear();
+                json_string_serializer serializer(buffer_);
+                basic_cbor_parser<Source> parser(std::move(source_));
+                parser.parse(serializer, ec);
+                source_ = std::move(parser.source_);
+                if (ec)
+                {
+                    return;
+                }
+                if (!parser.done())
+                {
+                    ec = cbor_errc::unexpected_eof;
+                    return;
+                }
+                auto result = unicons::validate(buffer_.begin(),buffer_.end());
+                if (result.ec != unicons::conv_errc())
+                {
+                    ec = cbor_errc::invalid_utf8_text_string;
+                    return;
+                }
+                break;
+            }
+        }
+        continue_ = handler.name(basic_string_view<char>(buffer_.data(),buffer_.length()), *this);
+    }
+
+    bool peek_break(std::error_code& ec)
+    {
+        int c = source_.peek();
+        if (c == Source::traits_type::eof())
+        {
+            ec = cbor_errc::unexpected_eof;
+            return false;
+        }
+        return c == 0xff;
+    }
+
+    void read_text_string(std::error_code& ec)
+    {
+        buffer_ = jsoncons::cbor::detail::get_text_string(source_, ec);
+        if (ec)
+        {
+            return;
+        }
+        auto result = unicons::validate(buffer_.begin(),buffer_.end());
+        if (result.ec != unicons::conv_errc())
+        {
+            ec = cbor_errc::invalid_utf8_text_string;
+            return;
+        }
+    }
+};
+
+}}
+
+#endif
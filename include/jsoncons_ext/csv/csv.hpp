@@ -8,6 +8,7 @@
 #define JSONCONS_CSV_CSV_HPP
 
 #include <jsoncons_ext/csv/csv_options.hpp>
+#include <jsoncons_ext/csv/csv_table.hpp>
 #include <jsoncons_ext/csv/csv_reader.hpp>
 #include <jsoncons_ext/csv/csv_serializer.hpp>
 
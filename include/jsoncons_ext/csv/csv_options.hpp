@@ -89,11 +89,14 @@ class basic_csv_options
     size_t header_lines_;
     string_type line_delimiter_;
     bool infer_types_;
+    size_t type_inference_rows_;
     bool lossless_number_;
 
     std::vector<string_type> column_names_;
     std::vector<csv_type_info> column_types_;
     std::vector<string_type> column_defaults_;
+    std::vector<string_type> selected_columns_;
+    std::vector<size_t> selected_column_indexes_;
 public:
     static const size_t default_indent = 4;
 
@@ -122,6 +125,7 @@ public:
         max_lines_((std::numeric_limits<unsigned long>::max)()),
         header_lines_(0),
         infer_types_(true),
+        type_inference_rows_(0),
         lossless_number_(false)
     {
         line_delimiter_.push_back('\n');
@@ -348,6 +352,28 @@ public:
         return *this;
     }
 
+    std::vector<string_type> selected_columns() const
+    {
+        return selected_columns_;
+    }
+
+    basic_csv_options& selected_columns(const string_type& names)
+    {
+        selected_columns_ = parse_column_names(names);
+        return *this;
+    }
+
+    std::vector<size_t> selected_column_indexes() const
+    {
+        return selected_column_indexes_;
+    }
+
+    basic_csv_options& selected_column_indexes(const std::vector<size_t>& indexes)
+    {
+        selected_column_indexes_ = indexes;
+        return *this;
+    }
+
     CharT field_delimiter() const
     {
         return field_delimiter_;
@@ -404,6 +430,17 @@ public:
         return *this;
     }
 
+    size_t type_inference_rows() const
+    {
+        return type_inference_rows_;
+    }
+
+    basic_csv_options& type_inference_rows(size_t value)
+    {
+        type_inference_rows_ = value;
+        return *this;
+    }
+
     bool lossless_number() const
     {
         return lossless_number_;
@@ -14,6 +14,8 @@
 #include <stdexcept>
 #include <system_error>
 #include <cctype>
+#include <algorithm> // std::find_if, std::sort, std::unique
+#include <limits> // std::numeric_limits
 #include <jsoncons/json_exception.hpp>
 #include <jsoncons/json_content_handler.hpp>
 #include <jsoncons/parse_error_handler.hpp>
@@ -21,8 +23,10 @@
 #include <jsoncons/json_filter.hpp>
 #include <jsoncons/json.hpp>
 #include <jsoncons/detail/parse_number.hpp>
+#include <jsoncons/detail/char_scanner.hpp>
 #include <jsoncons_ext/csv/csv_error.hpp>
 #include <jsoncons_ext/csv/csv_options.hpp>
+#include <jsoncons_ext/csv/csv_table.hpp>
 
 namespace jsoncons { namespace csv {
 
@@ -53,6 +57,16 @@ enum class csv_state_type
     done
 };
 
+// The type of a column's values seen so far, when inferring column types from the first records
+enum class csv_inferred_type : uint8_t
+{
+    unknown,
+    integer,
+    floating,
+    text,
+    mixed
+};
+
 template<class CharT,class Allocator=std::allocator<CharT>>
 class basic_csv_parser : private serializing_context
 {
@@ -70,6 +84,7 @@ class basic_csv_parser : private serializing_context
     static const int default_depth = 3;
 
     default_parse_error_handler default_err_handler_;
+    basic_null_json_content_handler<CharT> null_handler_;
     csv_state_type state_;
     int top_;
     std::vector<csv_mode_type,csv_mode_allocator_type> stack_;
@@ -86,15 +101,26 @@ class basic_csv_parser : private serializing_context
     std::vector<csv_type_info,csv_type_info_allocator_type> column_types_;
     std::vector<string_type,string_allocator_type> column_defaults_;
     size_t column_index_;
-    basic_json_fragment_filter<CharT> filter_;
     size_t level_;
     size_t offset_;
     jsoncons::detail::string_to_double to_double_; 
     std::vector<json_decoder<json_type>> decoders_;
+    basic_csv_table<CharT>* table_;
+    detail::csv_table_builder<CharT> table_builder_;
+    bool has_selection_;
+    std::vector<size_t> column_positions_;
+    bool skip_field_;
+    bool skipped_chars_;
+    std::vector<csv_inferred_type> inferred_types_;
+    size_t inferred_rows_;
+    std::string number_buffer_;
     const CharT* begin_input_;
     const CharT* input_end_;
     const CharT* input_ptr_;
     bool continue_;
+    jsoncons::detail::char_scanner<CharT> unquoted_scanner_;
+    jsoncons::detail::char_scanner<CharT> quoted_scanner_;
+    jsoncons::detail::char_scanner<CharT> comment_scanner_;
 
 public:
     basic_csv_parser(basic_json_content_handler<CharT>& handler)
@@ -122,9 +148,13 @@ public:
          handler_(handler),
          err_handler_(err_handler),
          options_(options),
-         filter_(handler),
          level_(0),
          offset_(0),
+         table_(nullptr),
+         has_selection_(false),
+         skip_field_(false),
+         skipped_chars_(false),
+         inferred_rows_(0),
          begin_input_(nullptr),
          input_end_(nullptr),
          input_ptr_(nullptr),
@@ -136,6 +166,36 @@ public:
         line_ = 1;
         column_ = 0;
         column_index_ = 0;
+
+        // Characters that end a run of field text that can be copied as is
+        unquoted_scanner_.add(options_.field_delimiter());
+        if (options_.subfield_delimiter().second)
+        {
+            unquoted_scanner_.add(options_.subfield_delimiter().first);
+        }
+        unquoted_scanner_.add(options_.quote_char());
+        unquoted_scanner_.add('\r');
+        unquoted_scanner_.add('\n');
+
+        quoted_scanner_.add(options_.quote_char());
+        quoted_scanner_.add(options_.quote_escape_char());
+        quoted_scanner_.add('\r');
+        quoted_scanner_.add('\n');
+
+        comment_scanner_.add('\r');
+        comment_scanner_.add('\n');
+    }
+
+    // Decodes the columns into table instead of sending events to a handler.
+    // Columns without a type in column_types are string columns.
+    basic_csv_parser(basic_csv_table<CharT>& table,
+                     const basic_csv_options<CharT>& options)
+        : basic_csv_parser(null_handler_, options, default_err_handler_)
+    {
+        options_.mapping(mapping_type::m_columns)
+                .lossless_number(false);
+        table_ = std::addressof(table);
+        table_builder_.table(table_);
     }
 
     ~basic_csv_parser()
@@ -177,7 +237,7 @@ public:
             switch (options_.mapping())
             {
             case mapping_type::n_objects:
-                if (!(options_.ignore_empty_values() && value_buffer_.size() == 0))
+                if (!(options_.ignore_empty_values() && value_buffer_.size() == 0) && is_selected(column_index_))
                 {
                     if (column_index_ < column_names_.size() + offset_)
                     {
@@ -197,6 +257,10 @@ public:
     void before_multi_valued_field()
     {
         push_mode(csv_mode_type::subfields);
+        if (!is_selected(column_index_))
+        {
+            return;
+        }
         switch (options_.mapping())
         {
         case mapping_type::n_rows:
@@ -204,7 +268,10 @@ public:
             continue_ = handler_.begin_array(semantic_tag_type::none, *this);
             break;
         case mapping_type::m_columns:
-            decoders_[column_index_].begin_array(semantic_tag_type::none, *this);
+            if (has_column(column_index_))
+            {
+                column_handler(column_index_).begin_array(semantic_tag_type::none, *this);
+            }
             break;
         default:
             break;
@@ -216,20 +283,27 @@ public:
         if (stack_[top_] == csv_mode_type::subfields)
         {
             pop_mode(csv_mode_type::subfields);
-            switch (options_.mapping())
+            if (is_selected(column_index_))
             {
-            case mapping_type::n_rows:
-            case mapping_type::n_objects:
-                continue_ = handler_.end_array(*this);
-                break;
-            case mapping_type::m_columns:
-                decoders_[column_index_].end_array(*this);
-                break;
-            default:
-                break;
+                switch (options_.mapping())
+                {
+                case mapping_type::n_rows:
+                case mapping_type::n_objects:
+                    continue_ = handler_.end_array(*this);
+                    break;
+                case mapping_type::m_columns:
+                    if (has_column(column_index_))
+                    {
+                        column_handler(column_index_).end_array(*this);
+                    }
+                    break;
+                default:
+                    break;
+                }
             }
         }
         ++column_index_;
+        update_skip_field();
     }
 
     void before_record()
@@ -268,6 +342,7 @@ public:
             if (line_ >= options_.header_lines())
             {
                 flip(csv_mode_type::header, csv_mode_type::data);
+                select_columns();
             }
             column_values_.resize(column_names_.size());
             switch (options_.mapping())
@@ -276,18 +351,24 @@ public:
                 if (column_names_.size() > 0)
                 {
                     continue_ = handler_.begin_array(semantic_tag_type::none, *this);
-                    for (const auto& name : column_names_)
+                    for (size_t i = 0; i < column_names_.size(); ++i)
                     {
-                        continue_ = handler_.string_value(name, semantic_tag_type::none, *this);
+                        if (is_selected(i))
+                        {
+                            continue_ = handler_.string_value(column_names_[i], semantic_tag_type::none, *this);
+                        }
                     }
                     continue_ = handler_.end_array(*this);
                 }
                 break;
             case mapping_type::m_columns:
-                for (size_t i = 0; i < column_names_.size(); ++i)
+                if (table_ == nullptr)
                 {
-                    decoders_.push_back(json_decoder<json_type>());
-                    decoders_.back().begin_array(semantic_tag_type::none, *this);
+                    for (size_t i = 0; i < column_names_.size(); ++i)
+                    {
+                        decoders_.push_back(json_decoder<json_type>());
+                        decoders_.back().begin_array(semantic_tag_type::none, *this);
+                    }
                 }
                 break;
             default:
@@ -296,6 +377,10 @@ public:
         }
         else if (stack_[top_] == csv_mode_type::data || stack_[top_] == csv_mode_type::subfields)
         {
+            if (inferred_rows_ < options_.type_inference_rows())
+            {
+                ++inferred_rows_;
+            }
             switch (options_.mapping())
             {
             case mapping_type::n_rows:
@@ -304,11 +389,19 @@ public:
             case mapping_type::n_objects:
                 continue_ = handler_.end_object(*this);
                 break;
+            case mapping_type::m_columns:
+                if (table_ != nullptr)
+                {
+                    table_->end_row();
+                    table_builder_.reset();
+                }
+                break;
             default:
                 break;
             }
         }
         column_index_ = 0;
+        update_skip_field();
     }
 
     void reset()
@@ -319,31 +412,21 @@ public:
         {
             column_names_.emplace_back(name.data(),name.size());
         }
-        for (auto name : options_.column_types())
-        {
-            column_types_.push_back(name);
-        }
-        for (auto name : options_.column_defaults())
-        {
-            column_defaults_.emplace_back(name.data(), name.size());
-        }
-        if (options_.header_lines() > 0)
-        {
-            push_mode(csv_mode_type::header);
-        }
-        else
-        {
-            push_mode(csv_mode_type::data);
-        }
-        if (options_.mapping() != mapping_type::m_columns)
+        start(options_.header_lines() > 0 ? csv_mode_type::header : csv_mode_type::data);
+    }
+
+    // Starts with the data records, for input that begins after the header lines.
+    // column_labels are the labels another parser read from the header.
+    void reset_after_header(const std::vector<std::basic_string<CharT>>& column_labels)
+    {
+        push_mode(csv_mode_type::initial);
+
+        for (const auto& label : column_labels)
         {
-            continue_ = handler_.begin_array(semantic_tag_type::none, *this);
+            column_names_.emplace_back(label.data(),label.size());
         }
-        state_ = csv_state_type::expect_value;
-        column_index_ = 0;
-        prev_char_ = 0;
-        column_ = 1;
-        level_ = 0;
+        column_values_.resize(column_names_.size());
+        start(csv_mode_type::data);
     }
 
     void parse_some()
@@ -369,7 +452,7 @@ public:
                 {
                     trim_string_buffer(options_.trim_leading(),options_.trim_trailing());
                 }
-                if (!options_.ignore_empty_lines() || (column_index_ > 0 || value_buffer_.length() > 0))
+                if (!options_.ignore_empty_lines() || (column_index_ > 0 || value_buffer_.length() > 0 || skipped_chars_))
                 {
                     if (column_index_ == 0)
                     {
@@ -417,16 +500,31 @@ public:
             default:
                 break;
             }
-            if (options_.mapping() == mapping_type::m_columns)
+            if (table_ != nullptr)
+            {
+                // Add the named, typed or selected columns that didn't receive a value
+                size_t count = (std::max)((std::max)(column_names_.size(), column_types_.size()), column_positions_.size());
+                for (size_t i = 0; i < count; ++i)
+                {
+                    if (is_selected(i))
+                    {
+                        column_handler(i);
+                    }
+                }
+            }
+            else if (options_.mapping() == mapping_type::m_columns)
             {
                 basic_json_fragment_filter<CharT> fragment_filter(handler_);
                 continue_ = handler_.begin_object(semantic_tag_type::none, *this);
                 for (size_t i = 0; i < column_names_.size(); ++i)
                 {
-                    continue_ = handler_.name(column_names_[i],*this);
-                    decoders_[i].end_array(*this);
-                    decoders_[i].flush();
-                    decoders_[i].get_result().dump(fragment_filter);
+                    if (is_selected(i))
+                    {
+                        continue_ = handler_.name(column_names_[i],*this);
+                        decoders_[i].end_array(*this);
+                        decoders_[i].flush();
+                        decoders_[i].get_result().dump(fragment_filter);
+                    }
                 }
                 continue_ = handler_.end_object(*this);
             }
@@ -447,6 +545,27 @@ public:
 
         for (; (input_ptr_ < local_input_end) && continue_; ++input_ptr_)
         {
+            switch (state_)
+            {
+            case csv_state_type::unquoted_string:
+                skip_run(unquoted_scanner_, local_input_end, true);
+                break;
+            case csv_state_type::quoted_string:
+                skip_run(quoted_scanner_, local_input_end, true);
+                break;
+            case csv_state_type::comment:
+                if (prev_char_ != '\r')
+                {
+                    skip_run(comment_scanner_, local_input_end, false);
+                }
+                break;
+            default:
+                break;
+            }
+            if (input_ptr_ == local_input_end)
+            {
+                break;
+            }
             CharT curr_char = *input_ptr_;
 all_csv_states:
             switch (state_)
@@ -477,7 +596,7 @@ all_csv_states:
                 {
                     if (curr_char == options_.quote_char())
                     {
-                        value_buffer_.push_back(static_cast<CharT>(curr_char));
+                        append_char(static_cast<CharT>(curr_char));
                         state_ = csv_state_type::quoted_string;
                     }
                     else if (options_.quote_escape_char() == options_.quote_char())
@@ -499,7 +618,7 @@ all_csv_states:
                     }
                     else
                     {
-                        value_buffer_.push_back(static_cast<CharT>(curr_char));
+                        append_char(static_cast<CharT>(curr_char));
                     }
                 }
                 break;
@@ -513,7 +632,7 @@ all_csv_states:
                     {
                         trim_string_buffer(options_.trim_leading(),options_.trim_trailing());
                     }
-                    if (!options_.ignore_empty_lines() || (column_index_ > 0 || value_buffer_.length() > 0))
+                    if (!options_.ignore_empty_lines() || (column_index_ > 0 || value_buffer_.length() > 0 || skipped_chars_))
                     {
                         if (column_index_ == 0)
                         {
@@ -561,6 +680,7 @@ all_csv_states:
                 {
                     if (prev_char_ == '\r' && curr_char == '\n')
                     {
+                        state_ = csv_state_type::expect_value;
                     }
                     else if (curr_char == '\r' || curr_char == '\n')
                     {
@@ -568,7 +688,7 @@ all_csv_states:
                         {
                             trim_string_buffer(options_.trim_leading(),options_.trim_trailing());
                         }
-                        if (!options_.ignore_empty_lines() || (column_index_ > 0 || value_buffer_.length() > 0))
+                        if (!options_.ignore_empty_lines() || (column_index_ > 0 || value_buffer_.length() > 0 || skipped_chars_))
                         {
                             if (column_index_ == 0)
                             {
@@ -612,11 +732,12 @@ all_csv_states:
                     else if (curr_char == options_.quote_char())
                     {
                         value_buffer_.clear();
+                        skipped_chars_ = false;
                         state_ = csv_state_type::quoted_string;
                     }
                     else
                     {
-                        value_buffer_.push_back(static_cast<CharT>(curr_char));
+                        append_char(static_cast<CharT>(curr_char));
                     }
                 }
                 break;
@@ -698,6 +819,164 @@ all_csv_states:
     }
 private:
 
+    void start(csv_mode_type mode)
+    {
+        for (auto name : options_.column_types())
+        {
+            column_types_.push_back(name);
+        }
+        for (auto name : options_.column_defaults())
+        {
+            column_defaults_.emplace_back(name.data(), name.size());
+        }
+        push_mode(mode);
+        if (options_.mapping() != mapping_type::m_columns)
+        {
+            continue_ = handler_.begin_array(semantic_tag_type::none, *this);
+        }
+        state_ = csv_state_type::expect_value;
+        column_index_ = 0;
+        prev_char_ = 0;
+        column_ = 1;
+        level_ = 0;
+        inferred_types_.clear();
+        inferred_rows_ = 0;
+        if (mode == csv_mode_type::data)
+        {
+            select_columns();
+        }
+        update_skip_field();
+    }
+
+    void append_char(CharT c)
+    {
+        if (skip_field_)
+        {
+            skipped_chars_ = true;
+        }
+        else
+        {
+            value_buffer_.push_back(c);
+        }
+    }
+
+    // Works out the columns picked by the selected_columns and selected_column_indexes
+    // options, once the column names are known. A selection isn't applied with repeated
+    // column types, whose fields aren't aligned with the columns.
+    void select_columns()
+    {
+        std::vector<size_t> indexes = options_.selected_column_indexes();
+        for (const auto& name : options_.selected_columns())
+        {
+            auto it = std::find_if(column_names_.begin(), column_names_.end(),
+                                   [&](const string_type& s){return string_view_type(s) == string_view_type(name);});
+            if (it != column_names_.end())
+            {
+                indexes.push_back(static_cast<size_t>(it - column_names_.begin()));
+            }
+        }
+        has_selection_ = options_.selected_column_indexes().size() > 0 || options_.selected_columns().size() > 0;
+        for (const auto& info : column_types_)
+        {
+            if (info.col_type == csv_column_type::repeat_t)
+            {
+                has_selection_ = false;
+            }
+        }
+        column_positions_.clear();
+        if (has_selection_ && indexes.size() > 0)
+        {
+            std::sort(indexes.begin(), indexes.end());
+            indexes.erase(std::unique(indexes.begin(), indexes.end()), indexes.end());
+            column_positions_.resize(indexes.back() + 1, (std::numeric_limits<size_t>::max)());
+            for (size_t i = 0; i < indexes.size(); ++i)
+            {
+                column_positions_[indexes[i]] = i;
+            }
+        }
+    }
+
+    bool is_selected(size_t index) const
+    {
+        return !has_selection_ || (index < column_positions_.size() && column_positions_[index] != (std::numeric_limits<size_t>::max)());
+    }
+
+    // The characters of an unselected field are passed over without being copied,
+    // except for the first field when trimming, which may turn out to be an empty line
+    void update_skip_field()
+    {
+        skipped_chars_ = false;
+        skip_field_ = has_selection_ && top_ >= 0 && 
+                      (stack_[top_] == csv_mode_type::data || stack_[top_] == csv_mode_type::subfields) &&
+                      !is_selected(column_index_) &&
+                      !(column_index_ == 0 && (options_.trim_leading() || options_.trim_trailing()));
+    }
+
+    bool has_column(size_t index) const
+    {
+        return table_ != nullptr || index < decoders_.size();
+    }
+
+    // The handler for the values in a column, in table mode a builder that appends
+    // to the column, which is added on first use
+    basic_json_content_handler<CharT>& column_handler(size_t index)
+    {
+        if (table_ == nullptr)
+        {
+            return decoders_[index];
+        }
+        size_t position = has_selection_ ? column_positions_[index] : index;
+        while (table_->column_count() <= position)
+        {
+            size_t i = has_selection_ ? selected_index(table_->column_count()) : table_->column_count();
+            csv_column_type type = csv_column_type::string_t;
+            if (i < column_types_.size() && column_types_[i].col_type != csv_column_type::repeat_t)
+            {
+                type = column_types_[i].col_type;
+            }
+            table_->add_column(i < column_names_.size() ? std::basic_string<CharT>(column_names_[i].data(), column_names_[i].size()) : std::basic_string<CharT>(), 
+                               type);
+        }
+        table_builder_.select(position);
+        return table_builder_;
+    }
+
+    // The index of the column at position in the selection
+    size_t selected_index(size_t position) const
+    {
+        size_t i = 0;
+        while (column_positions_[i] != position)
+        {
+            ++i;
+        }
+        return i;
+    }
+
+    // Moves past the characters that can't change the state, up to the next one the
+    // scanner stops at, and appends them to the value buffer if keep is true and the
+    // field isn't skipped. None of them are line breaks, so only the column advances.
+    void skip_run(const jsoncons::detail::char_scanner<CharT>& scanner, const CharT* last, bool keep)
+    {
+        const CharT* p = scanner.find_first(input_ptr_, last);
+        if (p != input_ptr_)
+        {
+            if (keep)
+            {
+                if (skip_field_)
+                {
+                    skipped_chars_ = true;
+                }
+                else
+                {
+                    value_buffer_.append(input_ptr_, p);
+                }
+            }
+            column_ += static_cast<unsigned long>(p - input_ptr_);
+            prev_char_ = *(p - 1);
+            input_ptr_ = p;
+        }
+    }
+
     void trim_string_buffer(bool trim_leading, bool trim_trailing)
     {
         size_t start = 0;
@@ -744,6 +1023,10 @@ private:
         {
         case csv_mode_type::data:
         case csv_mode_type::subfields:
+            if (!is_selected(column_index_))
+            {
+                break;
+            }
             switch (options_.mapping())
             {
             case mapping_type::n_rows:
@@ -784,11 +1067,11 @@ private:
                 }
                 break;
             case mapping_type::m_columns:
-                if (column_index_ < decoders_.size())
+                if (has_column(column_index_))
                 {
                     if (!(options_.ignore_empty_values() && value_buffer_.size() == 0))
                     {
-                        end_value(value_buffer_,column_index_,options_.infer_types(),decoders_[column_index_]);
+                        end_value(value_buffer_,column_index_,options_.infer_types() && table_ == nullptr,column_handler(column_index_));
                     }
                 }
                 break;
@@ -813,6 +1096,10 @@ private:
             break;
         case csv_mode_type::data:
         case csv_mode_type::subfields:
+            if (!is_selected(column_index_))
+            {
+                break;
+            }
             switch (options_.mapping())
             {
             case mapping_type::n_rows:
@@ -846,9 +1133,9 @@ private:
                 }
                 break;
             case mapping_type::m_columns:
-                if (column_index_ < decoders_.size())
+                if (has_column(column_index_))
                 {
-                    end_value(value_buffer_,column_index_,options_.infer_types(),decoders_[column_index_]);
+                    end_value(value_buffer_,column_index_,options_.infer_types() && table_ == nullptr,column_handler(column_index_));
                 }
                 break;
             }
@@ -896,10 +1183,8 @@ private:
             {
             case csv_column_type::integer_t:
                 {
-                    std::istringstream iss{ std::string(value) };
                     int64_t val;
-                    iss >> val;
-                    if (!iss.fail())
+                    if (parse_int64(value, val))
                     {
                         handler.int64_value(val, semantic_tag_type::none, *this);
                     }
@@ -907,10 +1192,7 @@ private:
                     {
                         if (column_index - offset_ < column_defaults_.size() && column_defaults_[column_index - offset_].length() > 0)
                         {
-                            basic_json_parser<CharT> parser(err_handler_);
-                            parser.update(column_defaults_[column_index - offset_].data(),column_defaults_[column_index - offset_].length());
-                            parser.parse_some(filter_);
-                            parser.finish_parse(filter_);
+                            end_default_value(column_index - offset_, handler);
                         }
                         else
                         {
@@ -927,10 +1209,8 @@ private:
                     }
                     else
                     {
-                        std::istringstream iss{ std::string(value) };
                         double val;
-                        iss >> val;
-                        if (!iss.fail())
+                        if (parse_double(value, val))
                         {
                             handler.double_value(val, semantic_tag_type::none, *this);
                         }
@@ -938,10 +1218,7 @@ private:
                         {
                             if (column_index - offset_ < column_defaults_.size() && column_defaults_[column_index - offset_].length() > 0)
                             {
-                                basic_json_parser<CharT> parser(err_handler_);
-                                parser.update(column_defaults_[column_index - offset_].data(),column_defaults_[column_index - offset_].length());
-                                parser.parse_some(filter_);
-                                parser.finish_parse(filter_);
+                                end_default_value(column_index - offset_, handler);
                             }
                             else
                             {
@@ -973,10 +1250,7 @@ private:
                     {
                         if (column_index - offset_ < column_defaults_.size() && column_defaults_[column_index - offset_].length() > 0)
                         {
-                            basic_json_parser<CharT> parser(err_handler_);
-                            parser.update(column_defaults_[column_index - offset_].data(),column_defaults_[column_index - offset_].length());
-                            parser.parse_some(filter_);
-                            parser.finish_parse(filter_);
+                            end_default_value(column_index - offset_, handler);
                         }
                         else
                         {
@@ -994,10 +1268,7 @@ private:
                 {
                     if (column_index < column_defaults_.size() + offset_ && column_defaults_[column_index - offset_].length() > 0)
                     {
-                        basic_json_parser<CharT> parser(err_handler_);
-                        parser.update(column_defaults_[column_index - offset_].data(),column_defaults_[column_index - offset_].length());
-                        parser.parse_some(filter_);
-                        parser.finish_parse(filter_);
+                        end_default_value(column_index - offset_, handler);
                     }
                     else
                     {
@@ -1011,7 +1282,14 @@ private:
         {
             if (infer_types)
             {
-                end_value_with_numeric_check(value, handler);
+                if (options_.type_inference_rows() > 0)
+                {
+                    end_inferred_value(value, column_index, handler);
+                }
+                else
+                {
+                    end_value_with_numeric_check(value, handler);
+                }
             }
             else
             {
@@ -1020,6 +1298,16 @@ private:
         }
     }
 
+    // Sends the events of a column default, which is JSON text, to the column's handler
+    void end_default_value(size_t index, basic_json_content_handler<CharT>& handler)
+    {
+        basic_json_fragment_filter<CharT> filter(handler);
+        basic_json_parser<CharT> parser(err_handler_);
+        parser.update(column_defaults_[index].data(),column_defaults_[index].length());
+        parser.parse_some(filter);
+        parser.finish_parse(filter);
+    }
+
     enum class numeric_check_state 
     {
         initial,
@@ -1036,7 +1324,295 @@ private:
         done
     };
 
-    void end_value_with_numeric_check(const string_view_type& value, basic_json_content_handler<CharT>& handler)
+    // Samples the type of the column's values over the first type_inference_rows records,
+    // and then converts them as that type. A value that doesn't have the column's type 
+    // has its type inferred on its own.
+    void end_inferred_value(const string_view_type& value, 
+                            size_t column_index,
+                            basic_json_content_handler<CharT>& handler)
+    {
+        if (column_index >= inferred_types_.size())
+        {
+            inferred_types_.resize(column_index+1, csv_inferred_type::unknown);
+        }
+        csv_inferred_type& type = inferred_types_[column_index];
+
+        if (inferred_rows_ < options_.type_inference_rows())
+        {
+            csv_inferred_type seen;
+            switch (end_value_with_numeric_check(value, handler))
+            {
+            case numeric_check_state::zero:
+            case numeric_check_state::integer:
+                seen = csv_inferred_type::integer;
+                break;
+            case numeric_check_state::fraction:
+            case numeric_check_state::exp:
+                seen = csv_inferred_type::floating;
+                break;
+            case numeric_check_state::null:
+            case numeric_check_state::boolean_true:
+            case numeric_check_state::boolean_false:
+                seen = csv_inferred_type::unknown;
+                break;
+            default:
+                seen = value.length() > 0 ? csv_inferred_type::text : csv_inferred_type::unknown;
+                break;
+            }
+            if (type == csv_inferred_type::unknown)
+            {
+                type = seen;
+            }
+            else if (seen != csv_inferred_type::unknown && seen != type)
+            {
+                type = (type != csv_inferred_type::text && seen != csv_inferred_type::text && type != csv_inferred_type::mixed) 
+                    ? csv_inferred_type::floating : csv_inferred_type::mixed;
+            }
+            return;
+        }
+
+        switch (type)
+        {
+        case csv_inferred_type::integer:
+            if (!end_integer_value(value, handler))
+            {
+                end_value_with_numeric_check(value, handler);
+            }
+            break;
+        case csv_inferred_type::floating:
+            if (!end_floating_value(value, handler))
+            {
+                end_value_with_numeric_check(value, handler);
+            }
+            break;
+        case csv_inferred_type::text:
+            // Only a value that starts like a number, true, false or null is checked
+            if (value.length() > 0 && could_be_non_text(value[0]))
+            {
+                end_value_with_numeric_check(value, handler);
+            }
+            else
+            {
+                handler.string_value(value, semantic_tag_type::none, *this);
+            }
+            break;
+        default:
+            end_value_with_numeric_check(value, handler);
+            break;
+        }
+    }
+
+    static bool could_be_non_text(CharT c)
+    {
+        switch (c)
+        {
+            case '-':case '0':case '1':case '2':case '3':case '4':case '5':case '6':case '7':case '8':case '9':
+            case 'n':case 'N':case 't':case 'T':case 'f':case 'F':
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    // Reports an integer value, returning false if value isn't one
+    bool end_integer_value(const string_view_type& value, basic_json_content_handler<CharT>& handler)
+    {
+        const CharT* p = value.data();
+        const CharT* last = p + value.length();
+        bool is_negative = p != last && *p == '-';
+        if (is_negative)
+        {
+            ++p;
+        }
+        if (p == last || (*p == '0' && last - p > 1))
+        {
+            return false;
+        }
+        for (const CharT* q = p; q != last; ++q)
+        {
+            if (!(*q >= '0' && *q <= '9'))
+            {
+                return false;
+            }
+        }
+        if (is_negative)
+        {
+            auto result = jsoncons::detail::to_integer<int64_t>(value.data(), value.length());
+            if (!result.overflow)
+            {
+                handler.int64_value(result.value, semantic_tag_type::none, *this);
+            }
+            else
+            {
+                handler.string_value(value, semantic_tag_type::big_integer, *this);
+            }
+        }
+        else
+        {
+            auto result = jsoncons::detail::to_integer<uint64_t>(value.data(), value.length());
+            if (!result.overflow)
+            {
+                handler.uint64_value(result.value, semantic_tag_type::none, *this);
+            }
+            else
+            {
+                handler.string_value(value, semantic_tag_type::big_integer, *this);
+            }
+        }
+        return true;
+    }
+
+    // Reports a fraction or exponent number as a double, and an integer as an integer, returning 
+    // false if value isn't a number.
+    bool end_floating_value(const string_view_type& value, basic_json_content_handler<CharT>& handler)
+    {
+        decimal_number number;
+        if (!scan_number(value, number))
+        {
+            return false;
+        }
+        if (number.is_integer)
+        {
+            return end_integer_value(value, handler);
+        }
+
+        if (options_.lossless_number())
+        {
+            handler.string_value(value, semantic_tag_type::big_decimal, *this);
+        }
+        else
+        {
+            handler.double_value(to_double(value, number), semantic_tag_type::none, *this);
+        }
+        return true;
+    }
+
+    // The value of an integer_t column. A value of optional minus and digits is converted 
+    // in place, others, such as with leading spaces or a plus sign, go through a stream.
+    bool parse_int64(const string_view_type& value, int64_t& val)
+    {
+        if (jsoncons::detail::is_integer(value.data(), value.length()))
+        {
+            auto result = jsoncons::detail::to_integer<int64_t>(value.data(), value.length());
+            val = result.value;
+            return !result.overflow;
+        }
+        std::istringstream iss{ std::string(value) };
+        iss >> val;
+        return !iss.fail();
+    }
+
+    // The value of a float_t column. A number in JSON syntax is converted in place, others 
+    // go through a stream.
+    bool parse_double(const string_view_type& value, double& val)
+    {
+        decimal_number number;
+        if (scan_number(value, number))
+        {
+            val = to_double(value, number);
+            return true;
+        }
+        std::istringstream iss{ std::string(value) };
+        iss >> val;
+        return !iss.fail();
+    }
+
+    struct decimal_number
+    {
+        bool is_negative;
+        bool is_integer;
+        uint64_t mantissa;
+        int digits;
+        int exponent;
+    };
+
+    // Scans a number in JSON syntax into its digits and power of ten, returning false if 
+    // value isn't one
+    static bool scan_number(const string_view_type& value, decimal_number& number)
+    {
+        const CharT* p = value.data();
+        const CharT* last = p + value.length();
+
+        number.is_negative = p != last && *p == '-';
+        if (number.is_negative)
+        {
+            ++p;
+        }
+        if (p == last || !(*p >= '0' && *p <= '9') || (*p == '0' && p + 1 != last && p[1] >= '0' && p[1] <= '9'))
+        {
+            return false;
+        }
+        number.mantissa = 0;
+        number.digits = 0;
+        number.exponent = 0;
+        for (; p != last && *p >= '0' && *p <= '9'; ++p)
+        {
+            number.mantissa = number.mantissa*10 + static_cast<uint64_t>(*p - '0');
+            ++number.digits;
+        }
+        number.is_integer = p == last;
+        if (p != last && *p == '.')
+        {
+            ++p;
+            if (p == last || !(*p >= '0' && *p <= '9'))
+            {
+                return false;
+            }
+            for (; p != last && *p >= '0' && *p <= '9'; ++p)
+            {
+                number.mantissa = number.mantissa*10 + static_cast<uint64_t>(*p - '0');
+                ++number.digits;
+                --number.exponent;
+            }
+        }
+        if (p != last && (*p == 'e' || *p == 'E'))
+        {
+            ++p;
+            bool is_negative_exponent = p != last && *p == '-';
+            if (p != last && (*p == '-' || *p == '+'))
+            {
+                ++p;
+            }
+            if (p == last || !(*p >= '0' && *p <= '9'))
+            {
+                return false;
+            }
+            int e = 0;
+            for (; p != last && *p >= '0' && *p <= '9'; ++p)
+            {
+                if (e < 10000)
+                {
+                    e = e*10 + (*p - '0');
+                }
+            }
+            number.exponent += is_negative_exponent ? -e : e;
+        }
+        return p == last;
+    }
+
+    // A number with at most 2^53 as its digits and a power of ten up to 22 is exactly one 
+    // multiplication or division of two exact doubles, which is correctly rounded, others 
+    // go through string_to_double.
+    double to_double(const string_view_type& value, const decimal_number& number)
+    {
+        static const double pow10[] = {1e0,1e1,1e2,1e3,1e4,1e5,1e6,1e7,1e8,1e9,1e10,1e11,
+                                       1e12,1e13,1e14,1e15,1e16,1e17,1e18,1e19,1e20,1e21,1e22};
+
+        if (number.digits <= 19 && number.mantissa <= (uint64_t(1) << 53) && number.exponent >= -22 && number.exponent <= 22)
+        {
+            double d = static_cast<double>(number.mantissa);
+            d = number.exponent < 0 ? d / pow10[-number.exponent] : d * pow10[number.exponent];
+            return number.is_negative ? -d : d;
+        }
+        number_buffer_.clear();
+        for (auto c : value)
+        {
+            number_buffer_.push_back(c == '.' ? to_double_.get_decimal_point() : static_cast<char>(c));
+        }
+        return to_double_(number_buffer_.c_str(), number_buffer_.length());
+    }
+
+    numeric_check_state end_value_with_numeric_check(const string_view_type& value, basic_json_content_handler<CharT>& handler)
     {
         numeric_check_state state = numeric_check_state::initial;
         bool is_negative = false;
@@ -1303,6 +1879,7 @@ private:
         default:
             handler.string_value(value, semantic_tag_type::none, *this);
         }
+        return state;
     }
 
     void push_mode(csv_mode_type mode)
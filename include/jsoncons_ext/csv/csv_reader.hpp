@@ -13,6 +13,8 @@
 #include <memory> // std::allocator
 #include <utility> // std::move
 #include <istream> // std::basic_istream
+#include <algorithm> // std::unique
+#include <limits> // std::numeric_limits
 #include <jsoncons/source.hpp>
 #include <jsoncons/json_exception.hpp>
 #include <jsoncons/json_content_handler.hpp>
@@ -22,7 +24,12 @@
 #include <jsoncons/json.hpp>
 #include <jsoncons/json_reader.hpp>
 #include <jsoncons/json_decoder.hpp>
+#include <jsoncons/json_filter.hpp>
+#include <jsoncons/json_event_tape.hpp>
+#include <jsoncons/parallel_policy.hpp>
+#include <jsoncons/detail/thread_pool.hpp>
 #include <jsoncons_ext/csv/csv_options.hpp>
+#include <jsoncons_ext/csv/csv_table.hpp>
 
 namespace jsoncons { namespace csv {
 
@@ -106,6 +113,20 @@ public:
         buffer_.reserve(buffer_length_);
     }
 
+    // Reads the columns into table, see basic_csv_table
+    basic_csv_reader(Source source,
+                     basic_csv_table<CharT>& table,
+                     const basic_csv_options<CharT>& options)
+       :
+         parser_(table, options),
+         source_(std::move(source)),
+         buffer_length_(default_max_buffer_length),
+         buffer_position_(0),
+         eof_(false)
+    {
+        buffer_.reserve(buffer_length_);
+    }
+
     ~basic_csv_reader()
     {
     }
@@ -204,6 +225,392 @@ private:
 
 };
 
+namespace detail {
+
+// Offset just past the first newline at or after first that is outside quotes, given 
+// whether first is inside quotes. Quotes are counted without regard to escapes, the
+// chunk parsers check that each split falls on a record boundary.
+
+template <class CharT>
+size_t next_record_boundary(const CharT* data, size_t first, size_t length, CharT quote_char, bool quoted)
+{
+    for (size_t i = first; i < length; ++i)
+    {
+        if (data[i] == quote_char)
+        {
+            quoted = !quoted;
+        }
+        else if (data[i] == '\n' && !quoted)
+        {
+            return i + 1;
+        }
+    }
+    return length;
+}
+
+// Offset just past the record that ends the header lines
+
+template <class CharT>
+size_t end_of_header(const CharT* data, size_t length, const basic_csv_options<CharT>& options)
+{
+    size_t header_lines = options.header_lines();
+    if (header_lines == 0)
+    {
+        return 0;
+    }
+    size_t line_count = 0;
+    CharT prev_char = 0;
+    for (size_t i = 0; i < length; ++i)
+    {
+        if (data[i] == '\r' || (data[i] == '\n' && prev_char != '\r'))
+        {
+            ++line_count;
+        }
+        if (line_count >= header_lines && data[i] == '\n')
+        {
+            return i + 1;
+        }
+        prev_char = data[i];
+    }
+    return length;
+}
+
+// Records the events of the records of one chunk on a tape, leaving out the array 
+// that encloses them and flush, and checks that the chunk is one array of records
+
+template <class CharT>
+class csv_chunk_recorder : public basic_json_filter<CharT>
+{
+    size_t depth_;
+    bool started_;
+    bool valid_;
+public:
+    csv_chunk_recorder(basic_json_content_handler<CharT>& tape)
+        : basic_json_filter<CharT>(tape), depth_(0), started_(false), valid_(true)
+    {
+    }
+
+    bool is_valid() const
+    {
+        return valid_ && started_ && depth_ == 0;
+    }
+private:
+    void do_flush() override
+    {
+    }
+
+    bool do_begin_object(semantic_tag_type tag, const serializing_context& context) override
+    {
+        valid_ = valid_ && depth_ > 0;
+        ++depth_;
+        return this->destination_handler().begin_object(tag, context);
+    }
+
+    bool do_begin_object(size_t length, semantic_tag_type tag, const serializing_context& context) override
+    {
+        valid_ = valid_ && depth_ > 0;
+        ++depth_;
+        return this->destination_handler().begin_object(length, tag, context);
+    }
+
+    bool do_end_object(const serializing_context& context) override
+    {
+        --depth_;
+        return this->destination_handler().end_object(context);
+    }
+
+    bool do_begin_array(semantic_tag_type tag, const serializing_context& context) override
+    {
+        if (depth_++ == 0)
+        {
+            valid_ = valid_ && !started_;
+            started_ = true;
+            return true;
+        }
+        return this->destination_handler().begin_array(tag, context);
+    }
+
+    bool do_begin_array(size_t length, semantic_tag_type tag, const serializing_context& context) override
+    {
+        if (depth_++ == 0)
+        {
+            valid_ = valid_ && !started_;
+            started_ = true;
+            return true;
+        }
+        return this->destination_handler().begin_array(length, tag, context);
+    }
+
+    bool do_end_array(const serializing_context& context) override
+    {
+        if (--depth_ == 0)
+        {
+            return true;
+        }
+        return this->destination_handler().end_array(context);
+    }
+};
+
+// Records CSV text as the events of the records of each chunk, the chunks split at 
+// newlines outside quotes and parsed concurrently. A chunk after the first starts 
+// with the column labels read from the header. If a split turns out not to be a record 
+// boundary, the text from the start of that chunk is parsed again serially.
+// Returns false if the text should be read serially instead: mappings that need all
+// records at once, a line limit, text too short to split, or a parse error.
+
+template <class CharT>
+bool record_csv_chunks(const CharT* data, 
+                       size_t length, 
+                       const basic_csv_options<CharT>& options, 
+                       const parallel_policy& policy,
+                       std::vector<std::unique_ptr<basic_json_event_tape<CharT>>>& chunks)
+{
+    typedef CharT char_type;
+
+    if (options.mapping() == mapping_type::m_columns || options.max_lines() != (std::numeric_limits<unsigned long>::max)())
+    {
+        return false;
+    }
+    size_t count = jsoncons::detail::chunk_count(length, policy.max_threads(), policy.min_chunk_size());
+    if (count <= 1)
+    {
+        return false;
+    }
+
+    // The quote_char parity of each evenly sized segment, computed in parallel, gives 
+    // the quote state at the start of each segment
+    jsoncons::detail::thread_pool pool(count);
+    std::vector<size_t> nominal(count + 1);
+    for (size_t i = 0; i <= count; ++i)
+    {
+        nominal[i] = static_cast<size_t>((static_cast<unsigned long long>(length) * i) / count);
+    }
+    std::vector<char> odd(count, 0);
+    const char_type quote_char = options.quote_char();
+    jsoncons::detail::parallel_for(pool, count, count, 
+        [&](size_t i, size_t, size_t)
+        {
+            size_t n = 0;
+            for (size_t j = nominal[i]; j < nominal[i+1]; ++j)
+            {
+                n += data[j] == quote_char ? 1 : 0;
+            }
+            odd[i] = static_cast<char>(n & 1);
+        });
+
+    size_t header_end = end_of_header(data, length, options);
+    if (header_end > 0)
+    {
+        // Extend to the end of a header record that continues inside quotes
+        size_t n = 0;
+        for (size_t j = 0; j < header_end; ++j)
+        {
+            n += data[j] == quote_char ? 1 : 0;
+        }
+        header_end = next_record_boundary(data, header_end, length, quote_char, (n & 1) != 0);
+    }
+
+    std::vector<size_t> splits(count + 1);
+    splits[0] = 0;
+    splits[count] = length;
+    bool quoted = false;
+    std::vector<char> quoted_at(count, 0);
+    for (size_t i = 0; i < count; ++i)
+    {
+        quoted_at[i] = quoted;
+        quoted = quoted != (odd[i] != 0);
+    }
+    jsoncons::detail::parallel_for(pool, count - 1, count - 1, 
+        [&](size_t i, size_t, size_t)
+        {
+            splits[i+1] = next_record_boundary(data, nominal[i+1], length, quote_char, quoted_at[i+1] != 0);
+        });
+    for (size_t i = 1; i < count; ++i)
+    {
+        if (splits[i] < header_end)
+        {
+            splits[i] = header_end;
+        }
+        if (splits[i] < splits[i-1])
+        {
+            splits[i] = splits[i-1];
+        }
+    }
+    splits.erase(std::unique(splits.begin(), splits.end()), splits.end());
+    if (splits.size() <= 2)
+    {
+        return false;
+    }
+    count = splits.size() - 1;
+
+    std::vector<std::basic_string<char_type>> column_labels;
+    {
+        basic_null_json_content_handler<char_type> handler;
+        basic_csv_parser<char_type> parser(handler, options);
+        parser.reset();
+        parser.update(data, header_end);
+        std::error_code ec;
+        parser.parse_some(ec);
+        if (ec)
+        {
+            return false;
+        }
+        column_labels = parser.column_labels();
+    }
+
+    // Parses [first,last), and returns whether it ended on a record boundary
+    auto parse_chunk = [&](size_t index, size_t first, size_t last, basic_json_event_tape<char_type>& tape, std::error_code& ec) -> bool
+    {
+        tape.clear();
+        csv_chunk_recorder<char_type> recorder(tape);
+        basic_csv_parser<char_type> parser(recorder, options);
+        if (index == 0)
+        {
+            parser.reset();
+        }
+        else
+        {
+            parser.reset_after_header(column_labels);
+        }
+        parser.update(data + first, last - first);
+        parser.parse_some(ec);
+        if (ec)
+        {
+            return false;
+        }
+        bool boundary = parser.source_exhausted() && parser.state() == csv_state_type::expect_value;
+        parser.finish_parse(ec);
+        if (ec)
+        {
+            return false;
+        }
+        if (!recorder.is_valid())
+        {
+            // Events the decoder couldn't assemble into records, leave them to a serial read
+            ec = csv_errc::invalid_csv_text;
+            return false;
+        }
+        return boundary;
+    };
+
+    chunks.clear();
+    for (size_t i = 0; i < count; ++i)
+    {
+        chunks.emplace_back(new basic_json_event_tape<char_type>());
+    }
+    std::vector<char> boundaries(count, 0);
+    std::vector<std::error_code> errors(count);
+    jsoncons::detail::parallel_for(pool, count, count, 
+        [&](size_t i, size_t, size_t)
+        {
+            try
+            {
+                boundaries[i] = parse_chunk(i, splits[i], splits[i+1], *chunks[i], errors[i]) ? 1 : 0;
+            }
+            catch (const std::exception&)
+            {
+                // Left to a serial read, which reports it with the right position
+                errors[i] = csv_errc::invalid_csv_text;
+            }
+        });
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (errors[i])
+        {
+            return false;
+        }
+        if (!boundaries[i] && i + 1 < count)
+        {
+            // Chunk i starts on a record boundary but the split after it doesn't,
+            // parse the rest of the text serially
+            chunks.resize(i + 1);
+            std::error_code ec;
+            try
+            {
+                parse_chunk(i, splits[i], length, *chunks[i], ec);
+            }
+            catch (const std::exception&)
+            {
+                return false;
+            }
+            if (ec)
+            {
+                return false;
+            }
+            break;
+        }
+    }
+    return true;
+}
+
+}
+
+// Reads CSV text held in memory, such as a string or a memory mapped file, splitting it
+// into chunks that are parsed on a thread pool. The events of each chunk are recorded on a 
+// json_event_tape, and the tapes are replayed to the handler in their original order, after 
+// all chunks have been parsed.
+
+template<class CharT,class Allocator=std::allocator<char>>
+class basic_csv_parallel_reader 
+{
+    typedef basic_string_view<CharT> string_view_type;
+
+    basic_csv_parallel_reader(const basic_csv_parallel_reader&) = delete; 
+    basic_csv_parallel_reader& operator = (const basic_csv_parallel_reader&) = delete; 
+
+    string_view_type s_;
+    basic_json_content_handler<CharT>& handler_;
+    basic_csv_options<CharT> options_;
+    parallel_policy policy_;
+public:
+    basic_csv_parallel_reader(const string_view_type& s,
+                              basic_json_content_handler<CharT>& handler,
+                              const basic_csv_options<CharT>& options,
+                              const parallel_policy& policy)
+       : s_(s), 
+         handler_(handler), 
+         options_(options), 
+         policy_(policy)
+    {
+    }
+
+    void read()
+    {
+        if (!read_chunks())
+        {
+            basic_csv_reader<CharT,jsoncons::string_source<CharT>,Allocator> reader(s_,handler_,options_);
+            reader.read();
+        }
+    }
+
+    void read(std::error_code& ec)
+    {
+        if (!read_chunks())
+        {
+            basic_csv_reader<CharT,jsoncons::string_source<CharT>,Allocator> reader(s_,handler_,options_);
+            reader.read(ec);
+        }
+    }
+private:
+    bool read_chunks()
+    {
+        std::vector<std::unique_ptr<basic_json_event_tape<CharT>>> chunks;
+        if (!detail::record_csv_chunks(s_.data(), s_.length(), options_, policy_, chunks))
+        {
+            return false;
+        }
+        handler_.begin_array();
+        for (const auto& chunk : chunks)
+        {
+            chunk->replay(handler_);
+        }
+        handler_.end_array();
+        handler_.flush();
+        return true;
+    }
+};
+
 template <class Json>
 Json decode_csv(typename Json::string_view_type s)
 {
@@ -228,6 +635,50 @@ Json decode_csv(typename Json::string_view_type s, const basic_csv_options<typen
     return decoder.get_result();
 }
 
+template <class Json>
+Json decode_csv(typename Json::string_view_type s, 
+                const basic_csv_options<typename Json::char_type>& options,
+                const parallel_policy& policy)
+{
+    typedef typename Json::char_type char_type;
+
+    std::vector<std::unique_ptr<basic_json_event_tape<char_type>>> tapes;
+    if (!detail::record_csv_chunks(s.data(), s.length(), options, policy, tapes))
+    {
+        return decode_csv<Json>(s, options);
+    }
+
+    // Each tape is decoded into an array of its own, concurrently, and the arrays spliced
+    std::vector<Json> chunks(tapes.size());
+    jsoncons::detail::thread_pool pool(tapes.size());
+    jsoncons::detail::parallel_for(pool, tapes.size(), tapes.size(), 
+        [&](size_t i, size_t, size_t)
+        {
+            json_decoder<Json> decoder;
+            decoder.begin_array();
+            tapes[i]->replay(decoder);
+            decoder.end_array();
+            chunks[i] = decoder.get_result();
+            tapes[i].reset();
+        });
+
+    size_t size = 0;
+    for (const auto& chunk : chunks)
+    {
+        size += chunk.size();
+    }
+    Json result = std::move(chunks[0]);
+    result.reserve(size);
+    for (size_t i = 1; i < chunks.size(); ++i)
+    {
+        for (auto& record : chunks[i].array_range())
+        {
+            result.push_back(std::move(record));
+        }
+    }
+    return result;
+}
+
 template <class Json>
 Json decode_csv(std::basic_istream<typename Json::char_type>& is)
 {
@@ -252,10 +703,45 @@ Json decode_csv(std::basic_istream<typename Json::char_type>& is, const basic_cs
     return decoder.get_result();
 }
 
+template <class Table>
+Table decode_csv_table(typename Table::string_view_type s)
+{
+    typedef typename Table::char_type char_type;
+
+    Table table;
+    basic_csv_reader<char_type,jsoncons::string_source<char_type>> reader(s,table,basic_csv_options<char_type>());
+    reader.read();
+    return table;
+}
+
+template <class Table>
+Table decode_csv_table(typename Table::string_view_type s, const basic_csv_options<typename Table::char_type>& options)
+{
+    typedef typename Table::char_type char_type;
+
+    Table table;
+    basic_csv_reader<char_type,jsoncons::string_source<char_type>> reader(s,table,options);
+    reader.read();
+    return table;
+}
+
+template <class Table>
+Table decode_csv_table(std::basic_istream<typename Table::char_type>& is, const basic_csv_options<typename Table::char_type>& options)
+{
+    typedef typename Table::char_type char_type;
+
+    Table table;
+    basic_csv_reader<char_type,jsoncons::text_stream_source<char_type>> reader(is,table,options);
+    reader.read();
+    return table;
+}
+
 typedef basic_csv_reader<char,jsoncons::text_stream_source<char>> csv_reader;
 typedef basic_csv_reader<char,jsoncons::string_source<char>> csv_string_reader;
 typedef basic_csv_reader<wchar_t,jsoncons::text_stream_source<wchar_t>> wcsv_reader;
 typedef basic_csv_reader<wchar_t,jsoncons::string_source<wchar_t>> wcsv_string_reader;
+typedef basic_csv_parallel_reader<char> csv_parallel_reader;
+typedef basic_csv_parallel_reader<wchar_t> wcsv_parallel_reader;
 
 }}
 
@@ -50,7 +50,6 @@ private:
 
         bool is_object_;
         size_t count_;
-        string_type name_;
     };
     Result result_;
     basic_csv_options<CharT> parameters_;
@@ -58,8 +57,14 @@ private:
     jsoncons::detail::print_double fp_;
     std::vector<string_type,string_allocator_type> column_names_;
 
-    typedef typename std::allocator_traits<allocator_type>:: template rebind_alloc<std::pair<const string_type,string_type>> string_string_allocator_type;
-    std::unordered_map<string_type,string_type, std::hash<string_type>,std::equal_to<string_type>,string_string_allocator_type> buffered_line_;
+    // The fields of an object row are buffered by column index until the row ends. 
+    // Member names are matched against the column expected next, and looked up in 
+    // column_indexes_ only when they come in a different order.
+    typedef typename std::allocator_traits<allocator_type>:: template rebind_alloc<std::pair<const string_type,size_t>> string_size_allocator_type;
+    std::unordered_map<string_type,size_t, std::hash<string_type>,std::equal_to<string_type>,string_size_allocator_type> column_indexes_;
+    std::vector<string_type,string_allocator_type> row_;
+    size_t column_index_;
+    size_t next_column_;
 
     // Noncopyable and nonmoveable
     basic_csv_serializer(const basic_csv_serializer&) = delete;
@@ -79,7 +84,9 @@ public:
        fp_(floating_point_options(options.floating_point_format(), 
                                   options.precision(),
                                   0)),
-       column_names_(parameters_.column_names())
+       column_names_(parameters_.column_names()),
+       column_index_((std::numeric_limits<size_t>::max)()),
+       next_column_(0)
     {
     }
 
@@ -127,6 +134,11 @@ private:
     bool do_begin_object(semantic_tag_type, const serializing_context&) override
     {
         stack_.push_back(stack_item(true));
+        if (stack_.size() == 2)
+        {
+            column_index_ = (std::numeric_limits<size_t>::max)();
+            next_column_ = 0;
+        }
         return true;
     }
 
@@ -154,11 +166,10 @@ private:
                 {
                     result_.push_back(parameters_.field_delimiter());
                 }
-                auto it = buffered_line_.find(column_names_[i]);
-                if (it != buffered_line_.end())
+                if (i < row_.size())
                 {
-                    result_.insert(it->second.data(),it->second.length());
-                    it->second.clear();
+                    result_.insert(row_[i].data(),row_[i].length());
+                    row_[i].clear();
                 }
             }
             result_.insert(parameters_.line_delimiter().data(), parameters_.line_delimiter().length());
@@ -211,16 +222,56 @@ private:
     {
         if (stack_.size() == 2)
         {
-            stack_.back().name_ = string_type(name);
-            buffered_line_[string_type(name)] = std::basic_string<CharT>();
             if (stack_[0].count_ == 0 && parameters_.column_names().size() == 0)
             {
                 column_names_.push_back(string_type(name));
+                column_index_ = column_names_.size() - 1;
+            }
+            else
+            {
+                column_index_ = find_column(name);
+            }
+            if (column_index_ < column_names_.size())
+            {
+                if (row_.size() < column_names_.size())
+                {
+                    row_.resize(column_names_.size());
+                }
+                row_[column_index_].clear();
+                next_column_ = column_index_ + 1;
             }
         }
         return true;
     }
 
+    size_t find_column(const string_view_type& name)
+    {
+        if (next_column_ < column_names_.size() && name == string_view_type(column_names_[next_column_]))
+        {
+            return next_column_;
+        }
+        if (column_indexes_.empty())
+        {
+            for (size_t i = column_names_.size(); i-- > 0;)
+            {
+                column_indexes_[column_names_[i]] = i;
+            }
+        }
+        auto it = column_indexes_.find(string_type(name));
+        return it != column_indexes_.end() ? it->second : (std::numeric_limits<size_t>::max)();
+    }
+
+    // The buffer for the current field of an object row, or nullptr if it isn't a column
+    string_type* field_buffer()
+    {
+        if (column_index_ < row_.size())
+        {
+            row_[column_index_].clear();
+            return &row_[column_index_];
+        }
+        return nullptr;
+    }
+
     template <class AnyWriter>
     bool string_value(const CharT* s, size_t length, AnyWriter& result)
     {
@@ -247,14 +298,11 @@ private:
         {
             if (stack_.back().is_object())
             {
-                auto it = buffered_line_.find(stack_.back().name_);
-                if (it != buffered_line_.end())
+                string_type* field = field_buffer();
+                if (field != nullptr)
                 {
-                    std::basic_string<CharT> s;
-                    jsoncons::string_result<std::basic_string<CharT>> bo(s);
+                    jsoncons::string_result<string_type> bo(*field);
                     accept_null_value(bo);
-                    bo.flush();
-                    it->second = s;
                 }
             }
             else
@@ -271,14 +319,11 @@ private:
         {
             if (stack_.back().is_object())
             {
-                auto it = buffered_line_.find(stack_.back().name_);
-                if (it != buffered_line_.end())
+                string_type* field = field_buffer();
+                if (field != nullptr)
                 {
-                    std::basic_string<CharT> s;
-                    jsoncons::string_result<std::basic_string<CharT>> bo(s);
+                    jsoncons::string_result<string_type> bo(*field);
                     value(sv,bo);
-                    bo.flush();
-                    it->second = s;
                 }
             }
             else
@@ -349,14 +394,11 @@ private:
         {
             if (stack_.back().is_object())
             {
-                auto it = buffered_line_.find(stack_.back().name_);
-                if (it != buffered_line_.end())
+                string_type* field = field_buffer();
+                if (field != nullptr)
                 {
-                    std::basic_string<CharT> s;
-                    jsoncons::string_result<std::basic_string<CharT>> bo(s);
+                    jsoncons::string_result<string_type> bo(*field);
                     value(val, bo);
-                    bo.flush();
-                    it->second = s;
                 }
             }
             else
@@ -375,14 +417,11 @@ private:
         {
             if (stack_.back().is_object())
             {
-                auto it = buffered_line_.find(stack_.back().name_);
-                if (it != buffered_line_.end())
+                string_type* field = field_buffer();
+                if (field != nullptr)
                 {
-                    std::basic_string<CharT> s;
-                    jsoncons::string_result<std::basic_string<CharT>> bo(s);
+                    jsoncons::string_result<string_type> bo(*field);
                     value(val,bo);
-                    bo.flush();
-                    it->second = s;
                 }
             }
             else
@@ -401,14 +440,11 @@ private:
         {
             if (stack_.back().is_object())
             {
-                auto it = buffered_line_.find(stack_.back().name_);
-                if (it != buffered_line_.end())
+                string_type* field = field_buffer();
+                if (field != nullptr)
                 {
-                    std::basic_string<CharT> s;
-                    jsoncons::string_result<std::basic_string<CharT>> bo(s);
+                    jsoncons::string_result<string_type> bo(*field);
                     value(val,bo);
-                    bo.flush();
-                    it->second = s;
                 }
             }
             else
@@ -425,14 +461,11 @@ private:
         {
             if (stack_.back().is_object())
             {
-                auto it = buffered_line_.find(stack_.back().name_);
-                if (it != buffered_line_.end())
+                string_type* field = field_buffer();
+                if (field != nullptr)
                 {
-                    std::basic_string<CharT> s;
-                    jsoncons::string_result<std::basic_string<CharT>> bo(s);
+                    jsoncons::string_result<string_type> bo(*field);
                     value(val,bo);
-                    bo.flush();
-                    it->second = s;
                 }
             }
             else
@@ -482,9 +515,7 @@ private:
     {
         begin_value(result);
 
-        std::basic_ostringstream<CharT> ss;
-        ss << val;
-        result.insert(ss.str().data(),ss.str().length());
+        jsoncons::detail::print_integer(val, result);
 
         end_value();
     }
@@ -494,9 +525,7 @@ private:
     {
         begin_value(result);
 
-        std::basic_ostringstream<CharT> ss;
-        ss << val;
-        result.insert(ss.str().data(),ss.str().length());
+        jsoncons::detail::print_uinteger(val, result);
 
         end_value();
     }
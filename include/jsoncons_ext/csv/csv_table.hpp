@@ -0,0 +1,541 @@
+// Copyright 2013 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_CSV_CSV_TABLE_HPP
+#define JSONCONS_CSV_CSV_TABLE_HPP
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <limits> // std::numeric_limits
+#include <jsoncons/json_exception.hpp>
+#include <jsoncons/json_content_handler.hpp>
+#include <jsoncons/json_options.hpp>
+#include <jsoncons/detail/print_number.hpp>
+#include <jsoncons_ext/csv/csv_options.hpp>
+
+namespace jsoncons { namespace csv {
+
+// A column of CSV values in contiguous storage. Integer, float and boolean columns hold
+// one int64_t, double or uint8_t per row. String columns hold the characters of all rows
+// in one buffer, with the offset of each row's value in offsets() and one more offset
+// for the end. A bit per row in validity() is clear for rows that hold a null, whose
+// slots contain zero or an empty string.
+
+template <class CharT>
+class basic_csv_column
+{
+public:
+    typedef CharT char_type;
+    typedef basic_string_view<CharT> string_view_type;
+    typedef std::basic_string<CharT> string_type;
+private:
+    string_type name_;
+    csv_column_type type_;
+    size_t size_;
+    size_t null_count_;
+    std::vector<uint8_t> validity_;
+    std::vector<int64_t> integers_;
+    std::vector<double> floats_;
+    std::vector<uint8_t> booleans_;
+    std::vector<CharT> chars_;
+    std::vector<size_t> offsets_;
+public:
+    basic_csv_column(const string_type& name, csv_column_type type)
+        : name_(name), type_(type), size_(0), null_count_(0), offsets_(1, 0)
+    {
+    }
+
+    const string_type& name() const
+    {
+        return name_;
+    }
+
+    csv_column_type type() const
+    {
+        return type_;
+    }
+
+    size_t size() const
+    {
+        return size_;
+    }
+
+    size_t null_count() const
+    {
+        return null_count_;
+    }
+
+    bool is_null(size_t i) const
+    {
+        return (validity_[i/8] & (1u << (i%8))) == 0;
+    }
+
+    int64_t integer_value(size_t i) const
+    {
+        return integers_[i];
+    }
+
+    double float_value(size_t i) const
+    {
+        return floats_[i];
+    }
+
+    bool boolean_value(size_t i) const
+    {
+        return booleans_[i] != 0;
+    }
+
+    string_view_type string_value(size_t i) const
+    {
+        return string_view_type(chars_.data() + offsets_[i], offsets_[i+1] - offsets_[i]);
+    }
+
+    const std::vector<uint8_t>& validity() const
+    {
+        return validity_;
+    }
+
+    const std::vector<int64_t>& integers() const
+    {
+        return integers_;
+    }
+
+    const std::vector<double>& floats() const
+    {
+        return floats_;
+    }
+
+    const std::vector<uint8_t>& booleans() const
+    {
+        return booleans_;
+    }
+
+    const std::vector<CharT>& chars() const
+    {
+        return chars_;
+    }
+
+    const std::vector<size_t>& offsets() const
+    {
+        return offsets_;
+    }
+
+    void reserve(size_t n)
+    {
+        validity_.reserve((n + 7)/8);
+        switch (type_)
+        {
+            case csv_column_type::integer_t:
+                integers_.reserve(n);
+                break;
+            case csv_column_type::float_t:
+                floats_.reserve(n);
+                break;
+            case csv_column_type::boolean_t:
+                booleans_.reserve(n);
+                break;
+            default:
+                offsets_.reserve(n + 1);
+                break;
+        }
+    }
+
+    void append_null()
+    {
+        switch (type_)
+        {
+            case csv_column_type::integer_t:
+                integers_.push_back(0);
+                break;
+            case csv_column_type::float_t:
+                floats_.push_back(0.0);
+                break;
+            case csv_column_type::boolean_t:
+                booleans_.push_back(0);
+                break;
+            default:
+                offsets_.push_back(chars_.size());
+                break;
+        }
+        append_validity(false);
+    }
+
+    void append_integer(int64_t value)
+    {
+        JSONCONS_ASSERT(type_ == csv_column_type::integer_t);
+        integers_.push_back(value);
+        append_validity(true);
+    }
+
+    void append_float(double value)
+    {
+        JSONCONS_ASSERT(type_ == csv_column_type::float_t);
+        floats_.push_back(value);
+        append_validity(true);
+    }
+
+    void append_boolean(bool value)
+    {
+        JSONCONS_ASSERT(type_ == csv_column_type::boolean_t);
+        booleans_.push_back(value ? 1 : 0);
+        append_validity(true);
+    }
+
+    void append_string(const string_view_type& value)
+    {
+        JSONCONS_ASSERT(type_ == csv_column_type::string_t);
+        chars_.insert(chars_.end(), value.begin(), value.end());
+        offsets_.push_back(chars_.size());
+        append_validity(true);
+    }
+private:
+    void append_validity(bool valid)
+    {
+        if (size_ % 8 == 0)
+        {
+            validity_.push_back(0);
+        }
+        if (valid)
+        {
+            validity_.back() |= static_cast<uint8_t>(1u << (size_ % 8));
+        }
+        else
+        {
+            ++null_count_;
+        }
+        ++size_;
+    }
+};
+
+// The columns of a CSV text, each holding a value or null for every row
+
+template <class CharT>
+class basic_csv_table
+{
+public:
+    typedef CharT char_type;
+    typedef basic_string_view<CharT> string_view_type;
+    typedef std::basic_string<CharT> string_type;
+    typedef basic_csv_column<CharT> column_type;
+private:
+    std::vector<column_type> columns_;
+    size_t row_count_;
+public:
+    basic_csv_table()
+        : row_count_(0)
+    {
+    }
+
+    size_t row_count() const
+    {
+        return row_count_;
+    }
+
+    size_t column_count() const
+    {
+        return columns_.size();
+    }
+
+    const column_type& operator[](size_t i) const
+    {
+        return columns_[i];
+    }
+
+    // Returns the first column with the given name, or nullptr
+    const column_type* find(const string_view_type& name) const
+    {
+        for (const auto& column : columns_)
+        {
+            if (name == string_view_type(column.name()))
+            {
+                return &column;
+            }
+        }
+        return nullptr;
+    }
+
+    column_type& add_column(const string_type& name, csv_column_type type)
+    {
+        columns_.emplace_back(name, type);
+        column_type& column = columns_.back();
+        column.reserve(row_count_);
+        for (size_t i = 0; i < row_count_; ++i)
+        {
+            column.append_null();
+        }
+        return column;
+    }
+
+    column_type& column(size_t i)
+    {
+        return columns_[i];
+    }
+
+    // Completes a row, with nulls in the columns that didn't receive a value
+    void end_row()
+    {
+        ++row_count_;
+        for (auto& column : columns_)
+        {
+            while (column.size() < row_count_)
+            {
+                column.append_null();
+            }
+        }
+    }
+};
+
+typedef basic_csv_column<char> csv_column;
+typedef basic_csv_column<wchar_t> wcsv_column;
+typedef basic_csv_table<char> csv_table;
+typedef basic_csv_table<wchar_t> wcsv_table;
+
+namespace detail {
+
+// Appends the value events for one column of a table at a time, converting them to the
+// column's type. A value inside an array, from a multi-valued field or a repeated column
+// type, makes the field null.
+
+template <class CharT>
+class csv_table_builder final : public basic_json_content_handler<CharT>
+{
+public:
+    using typename basic_json_content_handler<CharT>::string_view_type;
+    typedef std::basic_string<CharT> string_type;
+private:
+    basic_csv_table<CharT>* table_;
+    size_t index_;
+    size_t depth_;
+    string_type buffer_;
+public:
+    csv_table_builder()
+        : table_(nullptr), index_(0), depth_(0)
+    {
+    }
+
+    void table(basic_csv_table<CharT>* table)
+    {
+        table_ = table;
+    }
+
+    void select(size_t index)
+    {
+        if (index != index_)
+        {
+            index_ = index;
+            depth_ = 0;
+        }
+    }
+
+    void reset()
+    {
+        index_ = 0;
+        depth_ = 0;
+    }
+private:
+    basic_csv_column<CharT>& column()
+    {
+        return table_->column(index_);
+    }
+
+    // A column takes one value per row
+    bool accepts_value()
+    {
+        return depth_ == 0 && column().size() == table_->row_count();
+    }
+
+    void do_flush() override
+    {
+    }
+
+    bool do_begin_object(semantic_tag_type, const serializing_context&) override
+    {
+        ++depth_;
+        return true;
+    }
+
+    bool do_end_object(const serializing_context&) override
+    {
+        return end_structure();
+    }
+
+    bool do_begin_array(semantic_tag_type, const serializing_context&) override
+    {
+        ++depth_;
+        return true;
+    }
+
+    bool do_end_array(const serializing_context&) override
+    {
+        return end_structure();
+    }
+
+    bool do_name(const string_view_type&, const serializing_context&) override
+    {
+        return true;
+    }
+
+    bool do_null_value(semantic_tag_type, const serializing_context&) override
+    {
+        if (accepts_value())
+        {
+            column().append_null();
+        }
+        return true;
+    }
+
+    bool do_string_value(const string_view_type& value, semantic_tag_type, const serializing_context&) override
+    {
+        if (accepts_value())
+        {
+            if (column().type() == csv_column_type::string_t)
+            {
+                column().append_string(value);
+            }
+            else
+            {
+                column().append_null();
+            }
+        }
+        return true;
+    }
+
+    bool do_byte_string_value(const byte_string_view&,
+                              semantic_tag_type,
+                              const serializing_context&) override
+    {
+        if (accepts_value())
+        {
+            column().append_null();
+        }
+        return true;
+    }
+
+    bool do_int64_value(int64_t value,
+                        semantic_tag_type,
+                        const serializing_context&) override
+    {
+        if (accepts_value())
+        {
+            switch (column().type())
+            {
+                case csv_column_type::integer_t:
+                    column().append_integer(value);
+                    break;
+                case csv_column_type::float_t:
+                    column().append_float(static_cast<double>(value));
+                    break;
+                case csv_column_type::boolean_t:
+                    column().append_boolean(value != 0);
+                    break;
+                default:
+                    buffer_.clear();
+                    jsoncons::detail::print_integer(value, buffer_);
+                    column().append_string(buffer_);
+                    break;
+            }
+        }
+        return true;
+    }
+
+    bool do_uint64_value(uint64_t value,
+                         semantic_tag_type,
+                         const serializing_context&) override
+    {
+        if (accepts_value())
+        {
+            switch (column().type())
+            {
+                case csv_column_type::integer_t:
+                    if (value <= static_cast<uint64_t>((std::numeric_limits<int64_t>::max)()))
+                    {
+                        column().append_integer(static_cast<int64_t>(value));
+                    }
+                    else
+                    {
+                        column().append_null();
+                    }
+                    break;
+                case csv_column_type::float_t:
+                    column().append_float(static_cast<double>(value));
+                    break;
+                case csv_column_type::boolean_t:
+                    column().append_boolean(value != 0);
+                    break;
+                default:
+                    buffer_.clear();
+                    jsoncons::detail::print_uinteger(value, buffer_);
+                    column().append_string(buffer_);
+                    break;
+            }
+        }
+        return true;
+    }
+
+    bool do_double_value(double value,
+                         semantic_tag_type,
+                         const serializing_context&) override
+    {
+        if (accepts_value())
+        {
+            switch (column().type())
+            {
+                case csv_column_type::float_t:
+                    column().append_float(value);
+                    break;
+                case csv_column_type::string_t:
+                {
+                    buffer_.clear();
+                    jsoncons::detail::print_double print(floating_point_options{});
+                    print(value, buffer_);
+                    column().append_string(buffer_);
+                    break;
+                }
+                default:
+                    column().append_null();
+                    break;
+            }
+        }
+        return true;
+    }
+
+    bool do_bool_value(bool value, semantic_tag_type, const serializing_context&) override
+    {
+        if (accepts_value())
+        {
+            switch (column().type())
+            {
+                case csv_column_type::boolean_t:
+                    column().append_boolean(value);
+                    break;
+                case csv_column_type::string_t:
+                    buffer_ = value ? string_type({'t','r','u','e'}) : string_type({'f','a','l','s','e'});
+                    column().append_string(buffer_);
+                    break;
+                default:
+                    column().append_null();
+                    break;
+            }
+        }
+        return true;
+    }
+
+    bool end_structure()
+    {
+        if (depth_ > 0 && --depth_ == 0 && accepts_value())
+        {
+            column().append_null();
+        }
+        return true;
+    }
+};
+
+}
+
+}}
+
+#endif
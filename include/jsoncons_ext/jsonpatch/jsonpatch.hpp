@@ -68,7 +68,9 @@ namespace detail {
     JSONCONS_DEFINE_LITERAL(from_literal,"from")
     JSONCONS_DEFINE_LITERAL(value_literal,"value")
 
-    enum class op_type {add,remove,replace};
+    // Undo actions. move_back and move_back_replace undo a move, by moving the value at path back 
+    // to from and then removing path, or restoring the value that the move replaced.
+    enum class op_type {add,remove,replace,move_back,move_back_replace};
     enum class state_type {begin,abort,commit};
 
     template <class Json>
@@ -82,17 +84,28 @@ namespace detail {
             op_type op;
             string_type path;
             Json value;
+            string_type from;
         };
 
         Json& target;
         state_type state;
+        bool atomic;
         std::vector<entry> stack;
 
-        operation_unwinder(Json& j)
-            : target(j), state(state_type::begin)
+        operation_unwinder(Json& j, bool atomic = true)
+            : target(j), state(state_type::begin), atomic(atomic)
         {
         }
 
+        // Values are moved into the undo log, and moved back into target on abort
+        void record(op_type op, const string_type& path, Json&& value, const string_type& from = string_type())
+        {
+            if (atomic)
+            {
+                stack.push_back(entry{op,path,std::move(value),from});
+            }
+        }
+
         ~operation_unwinder()
         {
             std::error_code ec;
@@ -103,7 +116,7 @@ namespace detail {
                 {
                     if (it->op == op_type::add)
                     {
-                        jsonpointer::insert_or_assign(target,it->path,it->value,ec);
+                        jsonpointer::detail::jsonpointer_evaluator<Json,Json&>().insert_or_assign(target,it->path,std::move(it->value),ec);
                         if (ec)
                         {
                             //std::cout << "add: " << it->path << std::endl;
@@ -121,64 +134,359 @@ namespace detail {
                     }
                     else if (it->op == op_type::replace)
                     {
-                        jsonpointer::replace(target,it->path,it->value,ec);
+                        jsonpointer::detail::jsonpointer_evaluator<Json,Json&>().replace(target,it->path,std::move(it->value),ec);
                         if (ec)
                         {
                             //std::cout << "replace: " << it->path << std::endl;
                             break;
                         }
                     }
+                    else
+                    {
+                        Json& moved = jsonpointer::get(target,it->path,ec);
+                        if (ec)
+                        {
+                            break;
+                        }
+                        Json val = std::move(moved);
+                        if (it->op == op_type::move_back_replace)
+                        {
+                            moved = std::move(it->value);
+                        }
+                        else
+                        {
+                            jsonpointer::remove(target,it->path,ec);
+                            if (ec)
+                            {
+                                break;
+                            }
+                        }
+                        jsonpointer::detail::jsonpointer_evaluator<Json,Json&>().insert_or_assign(target,it->from,std::move(val),ec);
+                        if (ec)
+                        {
+                            break;
+                        }
+                    }
                 }
             }
         }
     };
 
+    // Adds value at npath, replacing the value already there if npath names an existing object member.
+    // Sets replaced to true and moves the previous value to orig_val if it was replaced.
+    // value is only moved from on success.
+
+    template <class Json,class T>
+    void add_value(Json& target, const typename Json::string_type& npath, T&& value, 
+                   bool& replaced, Json& orig_val, std::error_code& ec)
+    {
+        std::error_code insert_ec;
+        jsonpointer::detail::jsonpointer_evaluator<Json,Json&>().insert(target,npath,std::forward<T>(value),insert_ec); // try insert without replace
+        if (!insert_ec)
+        {
+            replaced = false;
+            return;
+        }
+        Json& existing = jsonpointer::get(target,npath,ec); // try a replace
+        if (ec)
+        {
+            return;
+        }
+        orig_val = std::move(existing);
+        existing = std::forward<T>(value);
+        replaced = true;
+    }
+
+    // Compares a source value with a target value
+    struct value_equal
+    {
+        template <class Json>
+        bool operator()(const Json& source, const Json& target) const
+        {
+            return source == target;
+        }
+    };
+
+    // Compares a source value with a target value by their cached hashes
+    template <class Json>
+    struct hash_equal
+    {
+        const json_hash_cache<Json>& source_hashes;
+        const json_hash_cache<Json>& target_hashes;
+
+        bool operator()(const Json& source, const Json& target) const
+        {
+            return source_hashes.equal(source, target_hashes, target);
+        }
+    };
+
+    template <class Json,class Equal>
+    Json from_diff(const Json& source, const Json& target, const typename Json::string_type& path, const Equal& equal);
+
+    enum class edit_type {keep,remove,add};
+
+    // Upper bounds on the work done by shortest_edit_script, beyond which array_diff falls
+    // back to comparing the remaining elements index by index
+    const size_t max_edit_distance = 1024;
+    const size_t max_edit_steps = size_t(1) << 24;
+
+    // Myers' O(ND) algorithm for the shortest script of removes and adds that turns 
+    // source[first1,first1+n) into target[first2,first2+m). Returns false, leaving script
+    // empty, if the edit distance or the number of steps exceeds the bounds above.
+
+    template <class Json,class Equal>
+    bool shortest_edit_script(const Json& source, size_t first1, size_t n, 
+                              const Json& target, size_t first2, size_t m, 
+                              const Equal& equal, std::vector<edit_type>& script)
+    {
+        typedef std::ptrdiff_t diff_t;
+
+        const diff_t N = static_cast<diff_t>(n);
+        const diff_t M = static_cast<diff_t>(m);
+        const diff_t max_d = static_cast<diff_t>((std::min)(n + m, max_edit_distance));
+
+        // trace[d] holds the furthest reaching x on diagonals -d,-d+2,...,d after d edits
+        std::vector<std::vector<diff_t>> trace;
+        std::vector<diff_t> v(3, 0); // diagonals -1,0,1 before the first step
+        size_t steps = 0;
+
+        diff_t d = 0;
+        bool found = false;
+        for (; d <= max_d && !found; ++d)
+        {
+            std::vector<diff_t> next(2*d + 1, 0);
+            for (diff_t k = -d; k <= d; k += 2)
+            {
+                // v is indexed by k + d - 1 + 1 = k + d, covering diagonals -(d-1)-1 .. (d-1)+1
+                diff_t x;
+                if (k == -d || (k != d && v[k - 1 + d] < v[k + 1 + d]))
+                {
+                    x = v[k + 1 + d];
+                }
+                else
+                {
+                    x = v[k - 1 + d] + 1;
+                }
+                diff_t y = x - k;
+                while (x < N && y < M && equal(source[first1 + x], target[first2 + y]))
+                {
+                    ++x;
+                    ++y;
+                    ++steps;
+                }
+                next[k + d] = x;
+                if (x >= N && y >= M)
+                {
+                    found = true;
+                }
+            }
+            steps += 2*d + 1;
+            if (steps > max_edit_steps)
+            {
+                return false;
+            }
+            // widen by one diagonal on each side for the next step
+            v.assign(2*d + 3, 0);
+            std::copy(next.begin(), next.end(), v.begin() + 1);
+            trace.push_back(std::move(next));
+        }
+        if (!found)
+        {
+            return false;
+        }
+
+        // Walk back from (N,M) to (0,0), collecting the script in reverse
+        diff_t x = N;
+        diff_t y = M;
+        for (d = static_cast<diff_t>(trace.size()) - 1; d > 0; --d)
+        {
+            const std::vector<diff_t>& prev = trace[d - 1]; // diagonals -(d-1)..(d-1), indexed by k + d - 1
+            diff_t k = x - y;
+            diff_t prev_k;
+            if (k == -d || (k != d && prev[k - 1 + d - 1] < prev[k + 1 + d - 1]))
+            {
+                prev_k = k + 1;
+            }
+            else
+            {
+                prev_k = k - 1;
+            }
+            diff_t prev_x = prev[prev_k + d - 1];
+            diff_t snake_start = prev_k == k + 1 ? prev_x : prev_x + 1;
+            while (x > snake_start)
+            {
+                script.push_back(edit_type::keep);
+                --x;
+                --y;
+            }
+            if (prev_k == k + 1)
+            {
+                script.push_back(edit_type::add);
+                --y;
+            }
+            else
+            {
+                script.push_back(edit_type::remove);
+                --x;
+            }
+        }
+        while (x > 0)
+        {
+            script.push_back(edit_type::keep);
+            --x;
+        }
+        std::reverse(script.begin(), script.end());
+        return true;
+    }
+
+    template <class Json>
+    typename Json::string_type array_element_path(const typename Json::string_type& path, size_t index)
+    {
+        std::basic_ostringstream<typename Json::char_type> ss; 
+        ss << path << '/' << index;
+        return ss.str();
+    }
+
     template <class Json>
-    Json from_diff(const Json& source, const Json& target, const typename Json::string_type& path)
+    bool same_kind(const Json& a, const Json& b)
+    {
+        return a.is_object() ? b.is_object() : (a.is_array() ? b.is_array() : !(b.is_object() || b.is_array()));
+    }
+
+    template <class Json>
+    void remove_element(const typename Json::string_type& path, size_t index, Json& result)
     {
         typedef typename Json::char_type char_type;
 
-        Json result = typename Json::array();
+        Json val = typename Json::object();
+        val.insert_or_assign(op_literal<char_type>(), remove_literal<char_type>());
+        val.insert_or_assign(path_literal<char_type>(), array_element_path<Json>(path, index));
+        result.push_back(std::move(val));
+    }
 
-        if (source == target)
+    template <class Json>
+    void add_element(const Json& value, const typename Json::string_type& path, size_t index, Json& result)
+    {
+        typedef typename Json::char_type char_type;
+
+        Json val = typename Json::object();
+        val.insert_or_assign(op_literal<char_type>(), add_literal<char_type>());
+        val.insert_or_assign(path_literal<char_type>(), array_element_path<Json>(path, index));
+        val.insert_or_assign(value_literal<char_type>(), value);
+        result.push_back(std::move(val));
+    }
+
+    template <class Json,class Equal>
+    void array_diff(const Json& source, const Json& target, const typename Json::string_type& path, const Equal& equal, Json& result)
+    {
+        // Elements shared at both ends need no operations
+        size_t prefix = 0;
+        size_t min_size = (std::min)(source.size(),target.size());
+        while (prefix < min_size && equal(source[prefix], target[prefix]))
         {
-            return result;
+            ++prefix;
+        }
+        size_t suffix = 0;
+        while (suffix < min_size - prefix && equal(source[source.size()-1-suffix], target[target.size()-1-suffix]))
+        {
+            ++suffix;
         }
+        size_t n = source.size() - prefix - suffix;
+        size_t m = target.size() - prefix - suffix;
 
-        if (source.is_array() && target.is_array())
+        std::vector<edit_type> script;
+        if (n == 0 || m == 0 || !shortest_edit_script(source, prefix, n, target, prefix, m, equal, script))
         {
-            size_t common = (std::min)(source.size(),target.size());
-            for (size_t i = 0; i < common; ++i)
+            // Replace index by index, then remove or add the difference
+            size_t common = (std::min)(n, m);
+            script.assign(common, edit_type::remove);
+            script.insert(script.end(), common, edit_type::add);
+            script.insert(script.end(), n - common, edit_type::remove);
+            script.insert(script.end(), m - common, edit_type::add);
+        }
+
+        // Operations are applied in sequence, so pos is the index in the partially patched array.
+        // Within each run of removes and adds, paired elements are diffed in place and 
+        // the rest become remove or add operations.
+        size_t pos = prefix;
+        size_t i = prefix;
+        size_t j = prefix;
+        size_t k = 0;
+        while (k < script.size())
+        {
+            if (script[k] == edit_type::keep)
             {
-                std::basic_ostringstream<char_type> ss; 
-                ss << path << '/' << i;
-                auto temp_diff = from_diff(source[i],target[i],ss.str());
+                ++pos; ++i; ++j; ++k;
+                continue;
+            }
+            size_t removes = 0;
+            size_t adds = 0;
+            for (; k < script.size() && script[k] != edit_type::keep; ++k)
+            {
+                if (script[k] == edit_type::remove)
+                {
+                    ++removes;
+                }
+                else
+                {
+                    ++adds;
+                }
+            }
+            // Pair removed and added elements in order, objects with objects, arrays with arrays
+            // and other values with other values
+            size_t r = 0;
+            size_t a = 0;
+            while (r < removes && a < adds)
+            {
+                size_t r2 = r;
+                while (r2 < removes && !same_kind(source[i+r2-r], target[j]))
+                {
+                    ++r2;
+                }
+                if (r2 == removes)
+                {
+                    add_element(target[j++], path, pos++, result);
+                    ++a;
+                    continue;
+                }
+                for (; r < r2; ++r)
+                {
+                    remove_element<Json>(path, pos, result);
+                    ++i;
+                }
+                auto temp_diff = from_diff(source[i++],target[j++],array_element_path<Json>(path, pos++),equal);
                 result.insert(result.array_range().end(),temp_diff.array_range().begin(),temp_diff.array_range().end());
+                ++r;
+                ++a;
             }
-            // Element in source, not in target - remove
-            for (size_t i = target.size(); i < source.size(); ++i)
+            for (; r < removes; ++r)
             {
-                std::basic_ostringstream<char_type> ss; 
-                ss << path << '/' << i;
-                Json val = typename Json::object();
-                val.insert_or_assign(op_literal<char_type>(), remove_literal<char_type>());
-                val.insert_or_assign(path_literal<char_type>(), ss.str());
-                result.push_back(std::move(val));
+                remove_element<Json>(path, pos, result);
+                ++i;
             }
-            // Element in target, not in source - add, 
-            // Fix contributed by Alexander rog13
-            for (size_t i = source.size(); i < target.size(); ++i)
+            for (; a < adds; ++a)
             {
-                const auto& a = target[i];
-                std::basic_ostringstream<char_type> ss; 
-                ss << path << '/' << i;
-                Json val = typename Json::object();
-                val.insert_or_assign(op_literal<char_type>(), add_literal<char_type>());
-                val.insert_or_assign(path_literal<char_type>(), ss.str());
-                val.insert_or_assign(value_literal<char_type>(), a);
-                result.push_back(std::move(val));
+                add_element(target[j++], path, pos++, result);
             }
         }
+    }
+
+    template <class Json,class Equal>
+    Json from_diff(const Json& source, const Json& target, const typename Json::string_type& path, const Equal& equal)
+    {
+        typedef typename Json::char_type char_type;
+
+        Json result = typename Json::array();
+
+        if (equal(source, target))
+        {
+            return result;
+        }
+
+        if (source.is_array() && target.is_array())
+        {
+            array_diff(source, target, path, equal, result);
+        }
         else if (source.is_object() && target.is_object())
         {
             for (const auto& a : source.object_range())
@@ -189,7 +497,7 @@ namespace detail {
                 auto it = target.find(a.key());
                 if (it != target.object_range().end())
                 {
-                    auto temp_diff = from_diff(a.value(),it->value(),ss.str());
+                    auto temp_diff = from_diff(a.value(),it->value(),ss.str(),equal);
                     result.insert(result.array_range().end(),temp_diff.array_range().begin(),temp_diff.array_range().end());
                 }
                 else
@@ -229,14 +537,16 @@ namespace detail {
     }
 }
 
+enum class patch_mode {atomic,non_atomic};
+
 template <class Json>
-void apply_patch(Json& target, const Json& patch, std::error_code& patch_ec)
+void apply_patch(Json& target, const Json& patch, patch_mode mode, std::error_code& patch_ec)
 {
     typedef typename Json::char_type char_type;
     typedef typename Json::string_type string_type;
     typedef typename Json::string_view_type string_view_type;
 
-   jsoncons::jsonpatch::detail::operation_unwinder<Json> unwinder(target);
+   jsoncons::jsonpatch::detail::operation_unwinder<Json> unwinder(target, mode == patch_mode::atomic);
 
     // Validate
     
@@ -258,7 +568,7 @@ void apply_patch(Json& target, const Json& patch, std::error_code& patch_ec)
             if (op ==jsoncons::jsonpatch::detail::test_literal<char_type>())
             {
                 std::error_code ec;
-                Json val = jsonpointer::get(target,path,ec);
+                const Json& val = jsonpointer::get(static_cast<const Json&>(target),path,ec);
                 if (ec)
                 {
                     patch_ec = jsonpatch_errc::test_failed;
@@ -284,52 +594,41 @@ void apply_patch(Json& target, const Json& patch, std::error_code& patch_ec)
                 }
                 else
                 {
-                    std::error_code insert_ec;
-                    Json val = operation.at(detail::value_literal<char_type>());
+                    std::error_code ec;
+                    bool replaced = false;
+                    Json orig_val;
                     auto npath = jsonpointer::normalized_path(target,path);
-                    jsonpointer::insert(target,npath,val,insert_ec); // try insert without replace
-                    if (insert_ec) // try a replace
+                    detail::add_value(target,npath,operation.at(detail::value_literal<char_type>()),replaced,orig_val,ec);
+                    if (ec)
                     {
-                        std::error_code select_ec;
-                        Json orig_val = jsonpointer::get(target,npath,select_ec);
-                        if (select_ec) // shouldn't happen
-                        {
-                            patch_ec = jsonpatch_errc::add_failed;
-                            unwinder.state =jsoncons::jsonpatch::detail::state_type::abort;
-                        }
-                        else
-                        {
-                            std::error_code replace_ec;
-                            jsonpointer::replace(target,npath,val,replace_ec);
-                            if (replace_ec)
-                            {
-                                patch_ec = jsonpatch_errc::add_failed;
-                                unwinder.state =jsoncons::jsonpatch::detail::state_type::abort;
-                            }
-                            else
-                            {
-                                unwinder.stack.push_back({detail::op_type::replace,npath,orig_val});
-                            }
-                        }
+                        patch_ec = jsonpatch_errc::add_failed;
+                        unwinder.state =jsoncons::jsonpatch::detail::state_type::abort;
+                    }
+                    else if (replaced)
+                    {
+                        unwinder.record(detail::op_type::replace,npath,std::move(orig_val));
                     }
                     else // insert without replace succeeded
                     {
-                        unwinder.stack.push_back({detail::op_type::remove,npath,Json::null()});
+                        unwinder.record(detail::op_type::remove,npath,Json());
                     }
                 }
             }
             else if (op ==jsoncons::jsonpatch::detail::remove_literal<char_type>())
             {
                 std::error_code ec;
-                Json val = jsonpointer::get(target,path,ec);
-                if (ec)
+                if (!unwinder.atomic)
                 {
-                    patch_ec = jsonpatch_errc::remove_failed;
-                    unwinder.state =jsoncons::jsonpatch::detail::state_type::abort;
+                    jsonpointer::remove(target,path,ec);
+                    if (ec)
+                    {
+                        patch_ec = jsonpatch_errc::remove_failed;
+                        unwinder.state =jsoncons::jsonpatch::detail::state_type::abort;
+                    }
                 }
                 else
                 {
-                    jsonpointer::remove(target,path,ec);
+                    Json& removed = jsonpointer::get(target,path,ec);
                     if (ec)
                     {
                         patch_ec = jsonpatch_errc::remove_failed;
@@ -337,14 +636,25 @@ void apply_patch(Json& target, const Json& patch, std::error_code& patch_ec)
                     }
                     else
                     {
-                        unwinder.stack.push_back({detail::op_type::add,string_type(path),val});
+                        Json val = std::move(removed);
+                        jsonpointer::remove(target,path,ec);
+                        if (ec)
+                        {
+                            removed = std::move(val);
+                            patch_ec = jsonpatch_errc::remove_failed;
+                            unwinder.state =jsoncons::jsonpatch::detail::state_type::abort;
+                        }
+                        else
+                        {
+                            unwinder.record(detail::op_type::add,string_type(path),std::move(val));
+                        }
                     }
                 }
             }
             else if (op ==jsoncons::jsonpatch::detail::replace_literal<char_type>())
             {
                 std::error_code ec;
-                Json val = jsonpointer::get(target,path,ec);
+                Json& replaced = jsonpointer::get(target,path,ec);
                 if (ec)
                 {
                     patch_ec = jsonpatch_errc::replace_failed;
@@ -357,16 +667,8 @@ void apply_patch(Json& target, const Json& patch, std::error_code& patch_ec)
                 }
                 else
                 {
-                    jsonpointer::replace(target,path,operation.at(detail::value_literal<char_type>()),ec);
-                    if (ec)
-                    {
-                        patch_ec = jsonpatch_errc::replace_failed;
-                        unwinder.state =jsoncons::jsonpatch::detail::state_type::abort;
-                    }
-                    else
-                    {
-                        unwinder.stack.push_back({detail::op_type::replace,string_type(path),val});
-                    }
+                    unwinder.record(detail::op_type::replace,string_type(path),std::move(replaced));
+                    replaced = operation.at(detail::value_literal<char_type>());
                 }
             }
             else if (op ==jsoncons::jsonpatch::detail::move_literal<char_type>())
@@ -380,7 +682,7 @@ void apply_patch(Json& target, const Json& patch, std::error_code& patch_ec)
                 {
                     string_view_type from = operation.at(detail::from_literal<char_type>()).as_string_view();
                     std::error_code ec;
-                    Json val = jsonpointer::get(target,from,ec);
+                    Json& source = jsonpointer::get(target,from,ec);
                     if (ec)
                     {
                         patch_ec = jsonpatch_errc::move_failed;
@@ -388,48 +690,36 @@ void apply_patch(Json& target, const Json& patch, std::error_code& patch_ec)
                     }
                     else 
                     {
+                        Json val = std::move(source);
                         jsonpointer::remove(target,from,ec);
                         if (ec)
                         {
+                            source = std::move(val);
                             patch_ec = jsonpatch_errc::move_failed;
                             unwinder.state =jsoncons::jsonpatch::detail::state_type::abort;
                         }
                         else
                         {
-                            unwinder.stack.push_back({detail::op_type::add,string_type(from),val});
                             // add
-                            std::error_code insert_ec;
+                            bool replaced = false;
+                            Json orig_val;
                             auto npath = jsonpointer::normalized_path(target,path);
-                            jsonpointer::insert(target,npath,val,insert_ec); // try insert without replace
-                            if (insert_ec) // try a replace
+                            detail::add_value(target,npath,std::move(val),replaced,orig_val,ec);
+                            if (ec)
+                            {
+                                // val is only moved on success, put it back where it came from
+                                std::error_code restore_ec;
+                                jsonpointer::detail::jsonpointer_evaluator<Json,Json&>().insert_or_assign(target,from,std::move(val),restore_ec);
+                                patch_ec = jsonpatch_errc::move_failed;
+                                unwinder.state =jsoncons::jsonpatch::detail::state_type::abort;
+                            }
+                            else if (replaced)
                             {
-                                std::error_code select_ec;
-                                Json orig_val = jsonpointer::get(target,npath,select_ec);
-                                if (select_ec) // shouldn't happen
-                                {
-                                    patch_ec = jsonpatch_errc::copy_failed;
-                                    unwinder.state =jsoncons::jsonpatch::detail::state_type::abort;
-                                }
-                                else
-                                {
-                                    std::error_code replace_ec;
-                                    jsonpointer::replace(target, npath, val, replace_ec);
-                                    if (replace_ec)
-                                    {
-                                        patch_ec = jsonpatch_errc::copy_failed;
-                                        unwinder.state =jsoncons::jsonpatch::detail::state_type::abort;
-
-                                    }
-                                    else
-                                    {
-                                        unwinder.stack.push_back({jsoncons::jsonpatch::detail::op_type::replace,npath,orig_val });
-                                    }
-                                    
-                                }
+                                unwinder.record(detail::op_type::move_back_replace,npath,std::move(orig_val),string_type(from));
                             }
                             else
                             {
-                                unwinder.stack.push_back({detail::op_type::remove,npath,Json::null()});
+                                unwinder.record(detail::op_type::move_back,npath,Json(),string_type(from));
                             }
                         }           
                     }
@@ -455,36 +745,22 @@ void apply_patch(Json& target, const Json& patch, std::error_code& patch_ec)
                     else
                     {
                         // add
+                        bool replaced = false;
+                        Json orig_val;
                         auto npath = jsonpointer::normalized_path(target,path);
-                        std::error_code insert_ec;
-                        jsonpointer::insert(target,npath,val,insert_ec); // try insert without replace
-                        if (insert_ec) // Failed, try a replace
+                        detail::add_value(target,npath,std::move(val),replaced,orig_val,ec);
+                        if (ec)
                         {
-                            std::error_code select_ec;
-                            Json orig_val = jsonpointer::get(target,npath, select_ec);
-                            if (select_ec) // shouldn't happen
-                            {
-                                patch_ec = jsonpatch_errc::copy_failed;
-                                unwinder.state =jsoncons::jsonpatch::detail::state_type::abort;
-                            }
-                            else 
-                            {
-                                std::error_code replace_ec;
-                                jsonpointer::replace(target, npath, val,replace_ec);
-                                if (replace_ec)
-                                {
-                                    patch_ec = jsonpatch_errc::copy_failed;
-                                    unwinder.state =jsoncons::jsonpatch::detail::state_type::abort;
-                                }
-                                else
-                                {
-                                    unwinder.stack.push_back({jsoncons::jsonpatch::detail::op_type::replace,npath,orig_val });
-                                }
-                            }
+                            patch_ec = jsonpatch_errc::copy_failed;
+                            unwinder.state =jsoncons::jsonpatch::detail::state_type::abort;
+                        }
+                        else if (replaced)
+                        {
+                            unwinder.record(detail::op_type::replace,npath,std::move(orig_val));
                         }
                         else
                         {
-                            unwinder.stack.push_back({detail::op_type::remove,npath,Json::null()});
+                            unwinder.record(detail::op_type::remove,npath,Json());
                         }
                     }
                 }
@@ -505,11 +781,26 @@ void apply_patch(Json& target, const Json& patch, std::error_code& patch_ec)
     }
 }
 
+template <class Json>
+void apply_patch(Json& target, const Json& patch, std::error_code& patch_ec)
+{
+    apply_patch(target, patch, patch_mode::atomic, patch_ec);
+}
+
 template <class Json>
 Json from_diff(const Json& source, const Json& target)
 {
     typename Json::string_type path;
-    return jsoncons::jsonpatch::detail::from_diff(source, target, path);
+    return jsoncons::jsonpatch::detail::from_diff(source, target, path, jsoncons::jsonpatch::detail::value_equal());
+}
+
+template <class Json>
+Json from_diff(const Json& source, const Json& target, 
+               const json_hash_cache<Json>& source_hashes, const json_hash_cache<Json>& target_hashes)
+{
+    typename Json::string_type path;
+    jsoncons::jsonpatch::detail::hash_equal<Json> equal{source_hashes, target_hashes};
+    return jsoncons::jsonpatch::detail::from_diff(source, target, path, equal);
 }
 
 template <class Json>
@@ -523,6 +814,17 @@ void apply_patch(Json& target, const Json& patch)
     }
 }
 
+template <class Json>
+void apply_patch(Json& target, const Json& patch, patch_mode mode)
+{
+    std::error_code ec;
+    apply_patch(target, patch, mode, ec);
+    if (ec)
+    {
+        JSONCONS_THROW(jsonpatch_error(ec));
+    }
+}
+
 }}
 
 #endif
@@ -16,6 +16,8 @@
 #include <utility> // std::move
 #include <regex>
 #include <jsoncons/json.hpp>
+#include <jsoncons/detail/thread_pool.hpp>
+#include <jsoncons/parallel_policy.hpp>
 #include <jsoncons_ext/jsonpath/jsonpath_filter.hpp>
 #include <jsoncons_ext/jsonpath/jsonpath_error.hpp>
 #include <jsoncons_ext/jsonpath/jsonpath_function.hpp>
@@ -31,6 +33,8 @@ std::unique_ptr<T> make_unique_ptr(Args&&... args)
 
 enum class result_type {value,path};
 
+using jsoncons::parallel_policy;
+
 template<class Json>
 Json json_query(const Json& root, const typename Json::string_view_type& path, result_type result_t = result_type::value)
 {
@@ -48,6 +52,23 @@ Json json_query(const Json& root, const typename Json::string_view_type& path, r
     }
 }
 
+template<class Json>
+Json json_query(const Json& root, const typename Json::string_view_type& path, result_type result_t, const parallel_policy& policy)
+{
+    if (result_t == result_type::value)
+    {
+        jsoncons::jsonpath::detail::jsonpath_evaluator<Json,const Json&,detail::VoidPathConstructor<Json>> evaluator(policy);
+        evaluator.evaluate(root, path);
+        return evaluator.get_values();
+    }
+    else
+    {
+        jsoncons::jsonpath::detail::jsonpath_evaluator<Json,const Json&,detail::PathConstructor<Json>> evaluator(policy);
+        evaluator.evaluate(root, path);
+        return evaluator.get_normalized_paths();
+    }
+}
+
 template<class Json, class T>
 void json_replace(Json& root, const typename Json::string_view_type& path, T&& new_value)
 {
@@ -189,6 +210,15 @@ private:
         }
         virtual void select(jsonpath_evaluator& evaluator,
                             node_type& node, const string_type& path, reference val, node_set& nodes) = 0;
+
+        // A copy that can select concurrently with this one
+        virtual std::unique_ptr<selector> clone() const = 0;
+
+        // Filters update node_type::skip_contained_object as they visit values
+        virtual bool is_filter() const
+        {
+            return false;
+        }
     };
 
     class expr_selector final : public selector
@@ -201,6 +231,11 @@ private:
         {
         }
 
+        std::unique_ptr<selector> clone() const override
+        {
+            return make_unique_ptr<expr_selector>(result_.clone());
+        }
+
         void select(jsonpath_evaluator& evaluator,
                     node_type& node, const string_type& path, reference val, 
                     node_set& nodes) override
@@ -232,18 +267,36 @@ private:
         {
         }
 
-        void select(jsonpath_evaluator&,
+        std::unique_ptr<selector> clone() const override
+        {
+            return make_unique_ptr<filter_selector>(result_.clone());
+        }
+
+        bool is_filter() const override
+        {
+            return true;
+        }
+
+        void select(jsonpath_evaluator& evaluator,
                     node_type& node, const string_type& path, reference val, 
                     node_set& nodes) override
         {
             if (val.is_array())
             {
                 node.skip_contained_object =true;
-                for (size_t i = 0; i < val.size(); ++i)
+                size_t chunk_count = evaluator.parallel_chunk_count(val);
+                if (chunk_count > 1)
                 {
-                    if (result_.exists(val[i]))
+                    select_parallel(evaluator, chunk_count, path, val, nodes);
+                }
+                else
+                {
+                    for (size_t i = 0; i < val.size(); ++i)
                     {
-                        nodes.emplace_back(PathCons()(path,i),std::addressof(val[i]));
+                        if (result_.exists(val[i]))
+                        {
+                            nodes.emplace_back(PathCons()(path,i),std::addressof(val[i]));
+                        }
                     }
                 }
             }
@@ -262,6 +315,32 @@ private:
                 }
             }
         }
+    private:
+        void select_parallel(jsonpath_evaluator& evaluator, size_t chunk_count,
+                             const string_type& path, reference val, 
+                             node_set& nodes)
+        {
+            std::vector<jsonpath_filter_expr<Json>> exprs;
+            exprs.reserve(chunk_count);
+            for (size_t i = 0; i < chunk_count; ++i)
+            {
+                exprs.push_back(result_.clone());
+            }
+            std::vector<node_set> selected(chunk_count);
+
+            jsoncons::detail::parallel_for(evaluator.pool(), val.size(), chunk_count,
+                [&](size_t chunk, size_t first, size_t last)
+                {
+                    for (size_t i = first; i < last; ++i)
+                    {
+                        if (exprs[chunk].exists(val[i]))
+                        {
+                            selected[chunk].emplace_back(PathCons()(path,i),std::addressof(val[i]));
+                        }
+                    }
+                });
+            append_node_sets(selected, nodes);
+        }
     };
 
     class name_selector final : public selector
@@ -275,6 +354,11 @@ private:
         {
         }
 
+        std::unique_ptr<selector> clone() const override
+        {
+            return make_unique_ptr<name_selector>(*this);
+        }
+
         void select(jsonpath_evaluator& evaluator,
                     node_type&, const string_type& path, reference val,
                     node_set& nodes) override
@@ -345,6 +429,11 @@ private:
         {
         }
 
+        std::unique_ptr<selector> clone() const override
+        {
+            return make_unique_ptr<array_slice_selector>(*this);
+        }
+
         void select(jsonpath_evaluator&,
                     node_type&, const string_type& path, reference val,
                     node_set& nodes) override
@@ -437,6 +526,10 @@ private:
     typedef std::vector<pointer> argument_type;
     std::vector<argument_type> function_stack_;
 
+    parallel_policy policy_;
+    bool parallel_;
+    std::unique_ptr<jsoncons::detail::thread_pool> pool_;
+
 public:
     jsonpath_evaluator()
         : state_(path_state::start),
@@ -446,10 +539,51 @@ public:
           recursive_descent_(false),
           line_(0), column_(0),
           begin_input_(nullptr), end_input_(nullptr),
-          p_(nullptr)
+          p_(nullptr),
+          parallel_(false)
+    {
+    }
+
+    jsonpath_evaluator(const parallel_policy& policy)
+        : state_(path_state::start),
+          start_(0), positive_start_(true), 
+          end_(0), positive_end_(true), undefined_end_(false),
+          step_(0), positive_step_(true),
+          recursive_descent_(false),
+          line_(0), column_(0),
+          begin_input_(nullptr), end_input_(nullptr),
+          p_(nullptr),
+          policy_(policy),
+          parallel_(policy.max_threads() > 1)
     {
     }
 
+    // Number of chunks a selection over the elements of val is split into, 1 if it runs serially.
+    // Non-const element access converts a typed array to an ordinary array, so that is done 
+    // here, before the elements are shared between threads.
+    size_t parallel_chunk_count(reference val) const
+    {
+        size_t count = val.size();
+        if (!parallel_ || count < 2*policy_.min_chunk_size())
+        {
+            return 1;
+        }
+        if (val.is_typed_array())
+        {
+            val.array_range();
+        }
+        return jsoncons::detail::chunk_count(count, policy_.max_threads(), policy_.min_chunk_size());
+    }
+
+    jsoncons::detail::thread_pool& pool()
+    {
+        if (!pool_)
+        {
+            pool_ = make_unique_ptr<jsoncons::detail::thread_pool>(policy_.max_threads());
+        }
+        return *pool_;
+    }
+
     Json get_values() const
     {
         Json result = typename Json::array();
@@ -1230,9 +1364,26 @@ public:
 
             if (p->is_array())
             {
-                for (auto it = p->array_range().begin(); it != p->array_range().end(); ++it)
+                size_t chunk_count = parallel_chunk_count(*p);
+                if (chunk_count > 1)
+                {
+                    std::vector<node_set> selected(chunk_count);
+                    jsoncons::detail::parallel_for(pool(), p->size(), chunk_count,
+                        [&](size_t chunk, size_t first, size_t last)
+                        {
+                            for (size_t j = first; j < last; ++j)
+                            {
+                                selected[chunk].emplace_back(PathCons()(path,j),std::addressof((*p)[j]));
+                            }
+                        });
+                    append_node_sets(selected, nodes_);
+                }
+                else
                 {
-                    nodes_.emplace_back(PathCons()(path,it - p->array_range().begin()),std::addressof(*it));
+                    for (auto it = p->array_range().begin(); it != p->array_range().end(); ++it)
+                    {
+                        nodes_.emplace_back(PathCons()(path,it - p->array_range().begin()),std::addressof(*it));
+                    }
                 }
             }
             else if (p->is_object())
@@ -1296,11 +1447,19 @@ public:
             }
             if (recursive_descent_)
             {
-                for (auto it = val.array_range().begin(); it != val.array_range().end(); ++it)
+                size_t chunk_count = parallel_chunk_count(val);
+                if (chunk_count > 1)
+                {
+                    apply_unquoted_string_parallel(chunk_count, path, val, name);
+                }
+                else
                 {
-                    if (it->is_object() || it->is_array())
+                    for (auto it = val.array_range().begin(); it != val.array_range().end(); ++it)
                     {
-                        apply_unquoted_string(path, *it, name);
+                        if (it->is_object() || it->is_array())
+                        {
+                            apply_unquoted_string(path, *it, name);
+                        }
                     }
                 }
             }
@@ -1327,6 +1486,25 @@ public:
         }
     }
 
+    void apply_unquoted_string_parallel(size_t chunk_count, const string_type& path, reference val, const string_view_type& name)
+    {
+        std::vector<std::unique_ptr<jsonpath_evaluator>> workers = make_workers(chunk_count);
+
+        jsoncons::detail::parallel_for(pool(), val.size(), chunk_count,
+            [&](size_t chunk, size_t first, size_t last)
+            {
+                for (size_t i = first; i < last; ++i)
+                {
+                    reference elem = val[i];
+                    if (elem.is_object() || elem.is_array())
+                    {
+                        workers[chunk]->apply_unquoted_string(path, elem, name);
+                    }
+                }
+            });
+        merge_workers(workers);
+    }
+
     void apply_selectors()
     {
         if (selectors_.size() > 0)
@@ -1361,13 +1539,152 @@ public:
             }
             else if (val.is_array())
             {
-                for (auto& elem : val.array_range())
+                size_t chunk_count = parallel_chunk_count(val);
+                if (chunk_count > 1)
+                {
+                    apply_selectors_parallel(chunk_count, node, path, val);
+                }
+                else
+                {
+                    for (auto& elem : val.array_range())
+                    {
+                        if (elem.is_object() || elem.is_array())
+                        {
+                            apply_selectors(node,path, elem);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    // Descends into the elements of val on the thread pool, each chunk with its own 
+    // evaluator and selector copies, then appends the selections in document order
+
+    void apply_selectors_parallel(size_t chunk_count, node_type& node, const string_type& path, reference val)
+    {
+        bool has_filter = false;
+        for (const auto& selector : selectors_)
+        {
+            has_filter = has_filter || selector->is_filter();
+        }
+
+        std::vector<std::unique_ptr<jsonpath_evaluator>> workers = make_workers(chunk_count);
+        std::vector<node_type> chunk_nodes(chunk_count, node);
+        const bool skip_contained_object = node.skip_contained_object;
+
+        jsoncons::detail::parallel_for(pool(), val.size(), chunk_count,
+            [&](size_t chunk, size_t first, size_t last)
+            {
+                node_type& chunk_node = chunk_nodes[chunk];
+                if (has_filter)
+                {
+                    chunk_node.skip_contained_object = skip_contained_object_before(val, first, skip_contained_object);
+                }
+                for (size_t i = first; i < last; ++i)
                 {
+                    reference elem = val[i];
                     if (elem.is_object() || elem.is_array())
                     {
-                        apply_selectors(node,path, elem);
+                        workers[chunk]->apply_selectors(chunk_node, path, elem);
+                    }
+                }
+            });
+
+        node.skip_contained_object = chunk_nodes.back().skip_contained_object;
+        merge_workers(workers);
+    }
+
+    // Serial evaluators that continue a recursive descent with their own copies of the selectors
+
+    std::vector<std::unique_ptr<jsonpath_evaluator>> make_workers(size_t count) const
+    {
+        std::vector<std::unique_ptr<jsonpath_evaluator>> workers;
+        workers.reserve(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            auto worker = make_unique_ptr<jsonpath_evaluator>();
+            worker->recursive_descent_ = true;
+            for (const auto& selector : selectors_)
+            {
+                worker->selectors_.push_back(selector->clone());
+            }
+            workers.push_back(std::move(worker));
+        }
+        return workers;
+    }
+
+    void merge_workers(std::vector<std::unique_ptr<jsonpath_evaluator>>& workers)
+    {
+        for (auto& worker : workers)
+        {
+            for (auto& selected : worker->nodes_)
+            {
+                nodes_.push_back(std::move(selected));
+            }
+            for (auto& temp : worker->temp_json_values_)
+            {
+                temp_json_values_.push_back(std::move(temp));
+            }
+        }
+    }
+
+    // Filters set skip_contained_object when they visit an array and clear it when they visit
+    // an object, so its value before element first is determined by the last container
+    // visited, in document order, in the descent through the preceding elements
+
+    static bool skip_contained_object_before(const Json& val, size_t first, bool initial)
+    {
+        for (size_t i = first; i-- > 0; )
+        {
+            const Json* p = std::addressof(val[i]);
+            if (p->is_object() || p->is_array())
+            {
+                const Json* last_child = p;
+                while (last_child != nullptr)
+                {
+                    p = last_child;
+                    last_child = nullptr;
+                    if (p->is_object())
+                    {
+                        for (const auto& member : p->object_range())
+                        {
+                            if (member.value().is_object() || member.value().is_array())
+                            {
+                                last_child = std::addressof(member.value());
+                            }
+                        }
+                    }
+                    else
+                    {
+                        for (const auto& elem : p->array_range())
+                        {
+                            if (elem.is_object() || elem.is_array())
+                            {
+                                last_child = std::addressof(elem);
+                            }
+                        }
                     }
                 }
+                return p->is_array();
+            }
+        }
+        return initial;
+    }
+
+    static void append_node_sets(std::vector<node_set>& sets, node_set& nodes)
+    {
+        size_t count = nodes.size();
+        for (const auto& set : sets)
+        {
+            count += set.size();
+        }
+        nodes.reserve(count);
+        for (auto& set : sets)
+        {
+            for (auto& selected : set)
+            {
+                nodes.push_back(std::move(selected));
             }
         }
     }
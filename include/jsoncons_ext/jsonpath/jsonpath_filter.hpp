@@ -149,6 +149,9 @@ public:
 
     virtual void initialize(const Json&) = 0;
 
+    // A copy that can be initialized and evaluated independently of this term
+    virtual std::shared_ptr<term> clone() const = 0;
+
     virtual bool accept_single_node() const
     {
         throw jsonpath_error(jsonpath_errc::invalid_filter_unsupported_operator);
@@ -390,6 +393,16 @@ public:
             operand_ptr_->initialize(current_node);
         }
     }
+
+    token<Json> clone() const
+    {
+        token<Json> t(*this);
+        if (operand_ptr_.get() != nullptr)
+        {
+            t.operand_ptr_ = operand_ptr_->clone();
+        }
+        return t;
+    }
 };
 
 template <class Json>
@@ -542,6 +555,11 @@ public:
     {
     }
 
+    std::shared_ptr<term<Json>> clone() const override
+    {
+        return std::make_shared<value_term>(value_);
+    }
+
     bool accept_single_node() const override
     {
         return value_.as_bool();
@@ -683,6 +701,11 @@ public:
     {
     }
 
+    std::shared_ptr<term<Json>> clone() const override
+    {
+        return std::make_shared<regex_term>(*this);
+    }
+
     bool regex2(const string_type& subject) const override
     {
         return std::regex_match(subject, pattern_);
@@ -693,20 +716,66 @@ template <class Json>
 class path_term final : public term<Json>
 {
     typedef typename Json::string_type string_type;
+    typedef typename Json::char_type char_type;
 
     string_type path_;
-    Json nodes_;
+    // Member names of a path of the form @.a.b or @['a']['b'], empty if the path needs the general evaluator
+    std::vector<string_type> names_;
+    bool is_simple_path_;
+    // Values copied out of the general evaluator, which owns its selections only while it lives
+    Json values_;
+    std::vector<const Json*> nodes_;
 public:
     path_term(const string_type& path)
-        : path_(path)
+        : path_(path), is_simple_path_(false)
+    {
+        is_simple_path_ = try_compile_simple_path(path_, names_);
+    }
+
+    path_term(const path_term& other)
+        : path_(other.path_), names_(other.names_), is_simple_path_(other.is_simple_path_)
     {
     }
 
+    std::shared_ptr<term<Json>> clone() const override
+    {
+        return std::make_shared<path_term>(*this);
+    }
+
     void initialize(const Json& current_node) override
     {
-        jsonpath_evaluator<Json,const Json&,VoidPathConstructor<Json>> evaluator;
-        evaluator.evaluate(current_node, path_);
-        nodes_ = evaluator.get_values();
+        nodes_.clear();
+        if (is_simple_path_)
+        {
+            const Json* p = std::addressof(current_node);
+            for (const auto& name : names_)
+            {
+                if (p->is_object())
+                {
+                    auto it = p->find(name);
+                    if (it == p->object_range().end())
+                    {
+                        return;
+                    }
+                    p = std::addressof(it->value());
+                }
+                else if (p->is_array() || p->is_string())
+                {
+                    // Array indices and length need the general evaluator 
+                    evaluate_general(current_node);
+                    return;
+                }
+                else
+                {
+                    return;
+                }
+            }
+            nodes_.push_back(p);
+        }
+        else
+        {
+            evaluate_general(current_node);
+        }
     }
 
     bool accept_single_node() const override
@@ -716,7 +785,17 @@ public:
 
     Json get_single_node() const override
     {
-        return nodes_.size() == 1 ? nodes_[0] : nodes_;
+        if (nodes_.size() == 1)
+        {
+            return *nodes_[0];
+        }
+        Json result = typename Json::array();
+        result.reserve(nodes_.size());
+        for (const Json* p : nodes_)
+        {
+            result.push_back(*p);
+        }
+        return result;
     }
 
     bool exclaim() const override
@@ -732,7 +811,7 @@ public:
             result = true;
             for (size_t i = 0; result && i < nodes_.size(); ++i)
             {
-                result = rhs.eq(nodes_[i]);
+                result = rhs.eq(*nodes_[i]);
             }
         }
         return result;
@@ -746,7 +825,7 @@ public:
             result = true;
             for (size_t i = 0; result && i < nodes_.size(); ++i)
             {
-                result = nodes_[i] == rhs;
+                result = *nodes_[i] == rhs;
             }
         }
         return result;
@@ -760,7 +839,7 @@ public:
             result = true;
             for (size_t i = 0; result && i < nodes_.size(); ++i)
             {
-                result = rhs.ne(nodes_[i]);
+                result = rhs.ne(*nodes_[i]);
             }
         }
         return result;
@@ -774,7 +853,7 @@ public:
             result = true;
             for (size_t i = 0; result && i < nodes_.size(); ++i)
             {
-                result = nodes_[i] != rhs;
+                result = *nodes_[i] != rhs;
             }
         }
         return result;
@@ -787,7 +866,7 @@ public:
             result = true;
             for (size_t i = 0; result && i < nodes_.size(); ++i)
             {
-                result = rhs.regex2(nodes_[i].as_string());
+                result = rhs.regex2(nodes_[i]->as_string());
             }
         }
         return result;
@@ -800,7 +879,7 @@ public:
             result = true;
             for (size_t i = 0; result && i < nodes_.size(); ++i)
             {
-                result = rhs.ampamp(nodes_[i]);
+                result = rhs.ampamp(*nodes_[i]);
             }
         }
         return result;
@@ -813,7 +892,7 @@ public:
             result = true;
             for (size_t i = 0; result && i < nodes_.size(); ++i)
             {
-                result = jsoncons::jsonpath::detail::ampamp(nodes_[i],rhs);
+                result = jsoncons::jsonpath::detail::ampamp(*nodes_[i],rhs);
             }
         }
         return result;
@@ -826,7 +905,7 @@ public:
             result = true;
             for (size_t i = 0; result && i < nodes_.size(); ++i)
             {
-                result = rhs.pipepipe(nodes_[i]);
+                result = rhs.pipepipe(*nodes_[i]);
             }
         }
         return result;
@@ -839,7 +918,7 @@ public:
             result = true;
             for (size_t i = 0; result && i < nodes_.size(); ++i)
             {
-                result = jsoncons::jsonpath::detail::pipepipe(nodes_[i],rhs);
+                result = jsoncons::jsonpath::detail::pipepipe(*nodes_[i],rhs);
             }
         }
         return result;
@@ -853,7 +932,7 @@ public:
             result = true;
             for (size_t i = 0; result && i < nodes_.size(); ++i)
             {
-                result = jsoncons::jsonpath::detail::lt(nodes_[i],rhs);
+                result = jsoncons::jsonpath::detail::lt(*nodes_[i],rhs);
             }
         }
         return result;
@@ -867,7 +946,7 @@ public:
             result = true;
             for (size_t i = 0; result && i < nodes_.size(); ++i)
             {
-                result = rhs.gt(nodes_[i]);
+                result = rhs.gt(*nodes_[i]);
             }
         }
         return result;
@@ -881,7 +960,7 @@ public:
             result = true;
             for (size_t i = 0; result && i < nodes_.size(); ++i)
             {
-                result = jsoncons::jsonpath::detail::gt(nodes_[i],rhs);
+                result = jsoncons::jsonpath::detail::gt(*nodes_[i],rhs);
             }
         }
         return result;
@@ -895,7 +974,7 @@ public:
             result = true;
             for (size_t i = 0; result && i < nodes_.size(); ++i)
             {
-                result = rhs.lt(nodes_[i]);
+                result = rhs.lt(*nodes_[i]);
             }
         }
         return result;
@@ -904,102 +983,163 @@ public:
     Json minus_term(const term<Json>& rhs) const override
     {
         static auto a_null = Json(jsoncons::null_type());
-        return nodes_.size() == 1 ? rhs.left_minus(nodes_[0]) : a_null;
+        return nodes_.size() == 1 ? rhs.left_minus(*nodes_[0]) : a_null;
     }
     Json minus(const Json& rhs) const override
     {
-        return nodes_.size() == 1 ? jsoncons::jsonpath::detail::minus(nodes_[0],rhs) : Json(jsoncons::null_type());
+        return nodes_.size() == 1 ? jsoncons::jsonpath::detail::minus(*nodes_[0],rhs) : Json(jsoncons::null_type());
     }
 
     Json left_minus(const Json& lhs) const override
     {
         static auto a_null = Json(jsoncons::null_type());
-        return nodes_.size() == 1 ? jsoncons::jsonpath::detail::minus(lhs,nodes_[0]) : a_null;
+        return nodes_.size() == 1 ? jsoncons::jsonpath::detail::minus(lhs,*nodes_[0]) : a_null;
     }
 
     Json unary_minus() const override
     {
-        return nodes_.size() == 1 ? jsoncons::jsonpath::detail::unary_minus(nodes_[0]) : Json::null();
+        return nodes_.size() == 1 ? jsoncons::jsonpath::detail::unary_minus(*nodes_[0]) : Json::null();
     }
 
     Json plus_term(const term<Json>& rhs) const override
     {
         static auto a_null = Json(jsoncons::null_type());
-        return nodes_.size() == 1 ? rhs.plus(nodes_[0]) : a_null;
+        return nodes_.size() == 1 ? rhs.plus(*nodes_[0]) : a_null;
     }
     Json plus(const Json& rhs) const override
     {
         static auto a_null = Json(jsoncons::null_type());
-        return nodes_.size() == 1 ? jsoncons::jsonpath::detail::plus(nodes_[0],rhs) : a_null;
+        return nodes_.size() == 1 ? jsoncons::jsonpath::detail::plus(*nodes_[0],rhs) : a_null;
     }
 
     Json mult_term(const term<Json>& rhs) const override
     {
         static auto a_null = Json(jsoncons::null_type());
-        return nodes_.size() == 1 ? rhs.mult(nodes_[0]) : a_null;
+        return nodes_.size() == 1 ? rhs.mult(*nodes_[0]) : a_null;
     }
     Json mult(const Json& rhs) const override
     {
         static auto a_null = Json(jsoncons::null_type());
-        return nodes_.size() == 1 ? jsoncons::jsonpath::detail::mult(nodes_[0],rhs) : a_null;
+        return nodes_.size() == 1 ? jsoncons::jsonpath::detail::mult(*nodes_[0],rhs) : a_null;
     }
 
     Json div_term(const term<Json>& rhs) const override
     {
         static auto a_null = Json(jsoncons::null_type());
-        return nodes_.size() == 1 ? rhs.left_div(nodes_[0]) : a_null;
+        return nodes_.size() == 1 ? rhs.left_div(*nodes_[0]) : a_null;
     }
     Json div(const Json& rhs) const override
     {
         static auto a_null = Json(jsoncons::null_type());
-        return nodes_.size() == 1 ? jsoncons::jsonpath::detail::div(nodes_[0],rhs) : a_null;
+        return nodes_.size() == 1 ? jsoncons::jsonpath::detail::div(*nodes_[0],rhs) : a_null;
     }
 
     Json left_div(const Json& lhs) const override
     {
         static auto a_null = Json(jsoncons::null_type());
-        return nodes_.size() == 1 ? jsoncons::jsonpath::detail::div(lhs, nodes_[0]) : a_null;
+        return nodes_.size() == 1 ? jsoncons::jsonpath::detail::div(lhs, *nodes_[0]) : a_null;
     }
-};
 
-template <class Json>
-token<Json> evaluate(const Json& context, std::vector<token<Json>>& tokens)
-{
-    for (auto it= tokens.begin(); it != tokens.end(); ++it)
+private:
+    void evaluate_general(const Json& current_node)
     {
-        it->initialize(context);
+        jsonpath_evaluator<Json,const Json&,VoidPathConstructor<Json>> evaluator;
+        evaluator.evaluate(current_node, path_);
+        values_ = evaluator.get_values();
+        nodes_.clear();
+        nodes_.reserve(values_.size());
+        for (const auto& val : values_.array_range())
+        {
+            nodes_.push_back(std::addressof(val));
+        }
     }
-    std::vector<token<Json>> stack;
-    for (auto t : tokens)
+
+    static bool is_name_char(char_type c)
     {
-        if (t.is_operand())
+        switch (c)
         {
-            stack.push_back(t);
+            case '.':case '[':case ']':case '(':case ')':case '*':case '@':case '$':case '?':
+            case ',':case ':':case '\'':case '\"':case ' ':case '\t':case '\r':case '\n':
+                return false;
+            default:
+                return true;
         }
-        else if (t.is_unary_operator())
+    }
+
+    static bool try_compile_simple_path(const string_type& path, std::vector<string_type>& names)
+    {
+        const char_type* p = path.data();
+        const char_type* end = path.data() + path.length();
+
+        if (p == end || *p != '$')
         {
-            auto rhs = stack.back();
-            stack.pop_back();
-            Json val = t(rhs.operand());
-            stack.push_back(token<Json>(token_type::operand,std::make_shared<value_term<Json>>(std::move(val))));
+            return false;
         }
-        else if (t.is_binary_operator())
+        ++p;
+        while (p < end)
         {
-            auto rhs = stack.back();
-            stack.pop_back();
-            auto lhs = stack.back();
-            stack.pop_back();
-            Json val = t(lhs.operand(), rhs.operand());
-            stack.push_back(token<Json>(token_type::operand,std::make_shared<value_term<Json>>(std::move(val))));
+            switch (*p)
+            {
+                case '.':
+                {
+                    const char_type* sb = ++p;
+                    while (p < end && is_name_char(*p))
+                    {
+                        ++p;
+                    }
+                    if (p == sb)
+                    {
+                        return false;
+                    }
+                    names.emplace_back(sb, p - sb);
+                    break;
+                }
+                case '[':
+                {
+                    ++p;
+                    if (p == end || (*p != '\'' && *p != '\"'))
+                    {
+                        return false;
+                    }
+                    char_type quote = *p++;
+                    const char_type* sb = p;
+                    while (p < end && *p != quote)
+                    {
+                        if (*p == '\\')
+                        {
+                            return false;
+                        }
+                        ++p;
+                    }
+                    if (p == end || p+1 == end || *(p+1) != ']')
+                    {
+                        return false;
+                    }
+                    names.emplace_back(sb, p - sb);
+                    p += 2;
+                    break;
+                }
+                case ' ':case '\t':case '\r':case '\n':
+                    ++p;
+                    while (p < end)
+                    {
+                        switch (*p)
+                        {
+                            case ' ':case '\t':case '\r':case '\n':
+                                ++p;
+                                break;
+                            default:
+                                return false;
+                        }
+                    }
+                    break;
+                default:
+                    return false;
+            }
         }
+        return true;
     }
-    if (stack.size() != 1)
-    {
-        JSONCONS_THROW(json_exception_impl<std::runtime_error>("Invalid state"));
-    }
-
-    return stack.back();
-}
+};
 
 template <class Json>
 class jsonpath_filter_expr
@@ -1008,6 +1148,10 @@ public:
     std::vector<token<Json>> tokens_;
     size_t line_;
     size_t column_;
+private:
+    // Evaluation workspace, sized once from the tokens and reused for every node
+    std::vector<const term<Json>*> stack_;
+    std::vector<value_term<Json>> results_;
 public:
     jsonpath_filter_expr()
         : line_(0), column_(0)
@@ -1017,16 +1161,41 @@ public:
     jsonpath_filter_expr(const std::vector<token<Json>>& tokens, size_t line, size_t column)
         : tokens_(tokens), line_(line), column_(column)
     {
+        reserve_workspace();
+    }
+
+    jsonpath_filter_expr(const jsonpath_filter_expr& other)
+        : tokens_(other.tokens_), line_(other.line_), column_(other.column_)
+    {
+        reserve_workspace();
+    }
+
+    jsonpath_filter_expr& operator=(const jsonpath_filter_expr& other)
+    {
+        tokens_ = other.tokens_;
+        line_ = other.line_;
+        column_ = other.column_;
+        reserve_workspace();
+        return *this;
+    }
+
+    // Copies of a filter expression share operand state, a clone can be evaluated concurrently with this one
+    jsonpath_filter_expr clone() const
+    {
+        std::vector<token<Json>> tokens;
+        tokens.reserve(tokens_.size());
+        for (const auto& t : tokens_)
+        {
+            tokens.push_back(t.clone());
+        }
+        return jsonpath_filter_expr(tokens, line_, column_);
     }
 
     Json eval(const Json& current_node)
     {
         try
         {
-            auto t = evaluate(current_node, tokens_);
-
-            return t.operand().get_single_node();
-
+            return evaluate(current_node).get_single_node();
         }
         catch (const jsonpath_error& e)
         {
@@ -1038,14 +1207,77 @@ public:
     {
         try
         {
-            auto t = evaluate(current_node,tokens_);
-            return t.operand().accept_single_node();
+            return evaluate(current_node).accept_single_node();
         }
         catch (const jsonpath_error& e)
         {
             throw jsonpath_error(e.code(),line_,column_);
         }
     }
+private:
+    void reserve_workspace()
+    {
+        size_t operator_count = 0;
+        for (const auto& t : tokens_)
+        {
+            if (t.is_operator())
+            {
+                ++operator_count;
+            }
+        }
+        stack_.clear();
+        stack_.reserve(tokens_.size());
+        results_.clear();
+        // Reserved so that pushing results never invalidates the pointers held in stack_
+        results_.reserve(operator_count);
+    }
+
+    const term<Json>& evaluate(const Json& context)
+    {
+        for (auto& t : tokens_)
+        {
+            t.initialize(context);
+        }
+        stack_.clear();
+        results_.clear();
+        for (auto& t : tokens_)
+        {
+            if (t.is_operand())
+            {
+                stack_.push_back(std::addressof(t.operand()));
+            }
+            else if (t.is_unary_operator())
+            {
+                if (stack_.empty())
+                {
+                    JSONCONS_THROW(json_exception_impl<std::runtime_error>("Invalid state"));
+                }
+                const term<Json>* rhs = stack_.back();
+                stack_.pop_back();
+                results_.emplace_back(t(*rhs));
+                stack_.push_back(std::addressof(results_.back()));
+            }
+            else if (t.is_binary_operator())
+            {
+                if (stack_.size() < 2)
+                {
+                    JSONCONS_THROW(json_exception_impl<std::runtime_error>("Invalid state"));
+                }
+                const term<Json>* rhs = stack_.back();
+                stack_.pop_back();
+                const term<Json>* lhs = stack_.back();
+                stack_.pop_back();
+                results_.emplace_back(t(*lhs, *rhs));
+                stack_.push_back(std::addressof(results_.back()));
+            }
+        }
+        if (stack_.size() != 1)
+        {
+            JSONCONS_THROW(json_exception_impl<std::runtime_error>("Invalid state"));
+        }
+
+        return *stack_.back();
+    }
 };
 
 template <class Json>
@@ -13,6 +13,8 @@
 #include <memory>
 #include <iostream>
 #include <iterator>
+#include <algorithm> // std::lower_bound
+#include <initializer_list>
 #include <utility> // std::move
 #include <type_traits> // std::enable_if, std::true_type
 #include <jsoncons/json.hpp>
@@ -368,6 +370,331 @@ public:
 
 typedef basic_address<char> address;
 
+// compiled_address
+
+template <class CharT>
+class basic_compiled_address
+{
+public:
+    // Member types
+    typedef CharT char_type;
+    typedef std::basic_string<char_type> string_type;
+    typedef basic_string_view<char_type> string_view_type;
+
+    class token
+    {
+        string_type name_;
+        size_t index_;
+        bool is_index_;
+    public:
+        token()
+            : index_(0), is_index_(false)
+        {
+        }
+
+        explicit token(const string_type& name)
+            : name_(name), index_(0), is_index_(false)
+        {
+            if (jsoncons::detail::is_integer(name_.data(), name_.length()))
+            {
+                auto result = jsoncons::detail::to_integer<size_t>(name_.data(), name_.length());
+                if (!result.overflow)
+                {
+                    index_ = result.value;
+                    is_index_ = true;
+                }
+            }
+        }
+
+        const string_type& name() const
+        {
+            return name_;
+        }
+
+        // True if the token is a valid array index
+        bool is_index() const
+        {
+            return is_index_;
+        }
+
+        size_t index() const
+        {
+            return index_;
+        }
+
+        // True if the token is "-", which refers to the position after the last array element
+        bool is_end() const
+        {
+            return name_.size() == 1 && name_[0] == '-';
+        }
+    };
+
+    typedef typename std::vector<token>::const_iterator const_iterator;
+    typedef const_iterator iterator;
+private:
+    std::vector<token> tokens_;
+public:
+    // Constructors
+    basic_compiled_address()
+    {
+    }
+
+    explicit basic_compiled_address(const basic_address<CharT>& location)
+    {
+        std::error_code ec;
+        compile(location.string(), ec);
+        if (ec)
+        {
+            JSONCONS_THROW(jsonpointer_error(ec));
+        }
+    }
+
+    basic_compiled_address(const basic_address<CharT>& location, std::error_code& ec)
+    {
+        compile(location.string(), ec);
+    }
+
+    explicit basic_compiled_address(const string_view_type& s)
+    {
+        std::error_code ec;
+        compile(s, ec);
+        if (ec)
+        {
+            JSONCONS_THROW(jsonpointer_error(ec));
+        }
+    }
+
+    basic_compiled_address(const string_view_type& s, std::error_code& ec)
+    {
+        compile(s, ec);
+    }
+
+    basic_compiled_address(const basic_compiled_address&) = default;
+
+    basic_compiled_address(basic_compiled_address&&) = default;
+
+    // operator=
+    basic_compiled_address& operator=(const basic_compiled_address&) = default;
+
+    basic_compiled_address& operator=(basic_compiled_address&&) = default;
+
+    // Accessors
+    bool empty() const
+    {
+        return tokens_.empty();
+    }
+
+    size_t size() const
+    {
+        return tokens_.size();
+    }
+
+    const token& operator[](size_t i) const
+    {
+        return tokens_[i];
+    }
+
+    // Iterators
+    iterator begin() const
+    {
+        return tokens_.begin();
+    }
+    iterator end() const
+    {
+        return tokens_.end();
+    }
+private:
+    void compile(const string_view_type& s, std::error_code& ec)
+    {
+        address_iterator<typename string_view_type::iterator> it(s.begin(), s.end(), s.begin());
+        address_iterator<typename string_view_type::iterator> end(s.begin(), s.end(), s.end());
+        it.increment(ec);
+        while (!ec && it != end)
+        {
+            tokens_.emplace_back(*it);
+            it.increment(ec);
+        }
+        if (ec)
+        {
+            tokens_.clear();
+        }
+    }
+};
+
+typedef basic_compiled_address<char> compiled_address;
+
+// address_set
+
+// A set of JSON Pointers arranged as a prefix tree, so that pointers that share
+// leading tokens are resolved together in a single descent of the document
+
+template <class CharT>
+class basic_address_set
+{
+public:
+    // Member types
+    typedef CharT char_type;
+    typedef std::basic_string<char_type> string_type;
+    typedef basic_string_view<char_type> string_view_type;
+    typedef typename basic_compiled_address<CharT>::token token;
+private:
+    struct node
+    {
+        token tok;
+        std::vector<size_t> children; // sorted by token name
+        std::vector<size_t> targets;  // indices of the pointers that end at this node
+
+        node()
+        {
+        }
+
+        explicit node(const token& t)
+            : tok(t)
+        {
+        }
+    };
+
+    std::vector<node> nodes_;
+    size_t size_;
+public:
+    // Constructors
+    basic_address_set()
+        : nodes_(1), size_(0)
+    {
+    }
+
+    basic_address_set(std::initializer_list<string_view_type> init)
+        : nodes_(1), size_(0)
+    {
+        for (const auto& s : init)
+        {
+            add(s);
+        }
+    }
+
+    basic_address_set(const basic_address_set&) = default;
+
+    basic_address_set(basic_address_set&&) = default;
+
+    // operator=
+    basic_address_set& operator=(const basic_address_set&) = default;
+
+    basic_address_set& operator=(basic_address_set&&) = default;
+
+    // Modifiers
+
+    // Adds a pointer to the set and returns its index, which is the position of its result
+    size_t add(const basic_compiled_address<CharT>& location)
+    {
+        size_t current = 0;
+        for (const auto& tok : location)
+        {
+            current = find_or_add_child(current, tok);
+        }
+        nodes_[current].targets.push_back(size_);
+        return size_++;
+    }
+
+    size_t add(const string_view_type& s)
+    {
+        return add(basic_compiled_address<CharT>(s));
+    }
+
+    size_t add(const string_view_type& s, std::error_code& ec)
+    {
+        basic_compiled_address<CharT> location(s, ec);
+        if (ec)
+        {
+            return size_;
+        }
+        return add(location);
+    }
+
+    void clear()
+    {
+        nodes_.clear();
+        nodes_.emplace_back();
+        size_ = 0;
+    }
+
+    // Accessors
+
+    // Number of pointers added to the set
+    size_t size() const
+    {
+        return size_;
+    }
+
+    bool empty() const
+    {
+        return size_ == 0;
+    }
+
+    // Walks the prefix tree from root. resolve(handle, token, ec) steps handle to the child
+    // selected by token, and report(index, handle, ec) is called once for every pointer in the set.
+    // A failed step is reported for all pointers below it without descending further.
+    template <class Handle,class Resolve,class Report>
+    void resolve(const Handle& root, Resolve resolve, Report report) const
+    {
+        resolve_node(0, root, resolve, report);
+    }
+private:
+    size_t find_or_add_child(size_t parent, const token& tok)
+    {
+        auto& children = nodes_[parent].children;
+        auto it = std::lower_bound(children.begin(), children.end(), tok.name(),
+                                   [this](size_t i, const string_type& name) {return nodes_[i].tok.name() < name;});
+        if (it != children.end() && nodes_[*it].tok.name() == tok.name())
+        {
+            return *it;
+        }
+        size_t index = nodes_.size();
+        nodes_[parent].children.insert(it, index);
+        nodes_.emplace_back(tok); // may invalidate children
+        return index;
+    }
+
+    template <class Handle,class Resolve,class Report>
+    void resolve_node(size_t index, const Handle& current, Resolve& resolve, Report& report) const
+    {
+        const node& n = nodes_[index];
+        for (size_t target : n.targets)
+        {
+            report(target, current, std::error_code());
+        }
+        for (size_t child : n.children)
+        {
+            Handle next(current);
+            std::error_code ec;
+            resolve(next, nodes_[child].tok, ec);
+            if (ec)
+            {
+                report_error(child, current, ec, report);
+            }
+            else
+            {
+                resolve_node(child, next, resolve, report);
+            }
+        }
+    }
+
+    template <class Handle,class Report>
+    void report_error(size_t index, const Handle& current, const std::error_code& ec, Report& report) const
+    {
+        const node& n = nodes_[index];
+        for (size_t target : n.targets)
+        {
+            report(target, current, ec);
+        }
+        for (size_t child : n.children)
+        {
+            report_error(child, current, ec, report);
+        }
+    }
+};
+
+typedef basic_address_set<char> address_set;
+
 namespace detail {
 
 template <class J,class JReference,class Enable = void>
@@ -486,7 +813,8 @@ public:
         }
     }
 
-    void insert_or_assign(reference root, const string_view_type& path, const J& value, std::error_code& ec)
+    template <class T>
+    void insert_or_assign(reference root, const string_view_type& path, T&& value, std::error_code& ec)
     {
         evaluate(root, path, ec);
         if (ec)
@@ -497,7 +825,7 @@ public:
         {
             if (buffer_.size() == 1 && buffer_[0] == '-')
             {
-                current_.back().get().push_back(value);
+                current_.back().get().push_back(std::forward<T>(value));
             }
             else
             {
@@ -520,17 +848,17 @@ public:
                 }
                 if (index == current_.back().get().size())
                 {
-                    current_.back().get().push_back(value);
+                    current_.back().get().push_back(std::forward<T>(value));
                 }
                 else
                 {
-                    current_.back().get().insert(current_.back().get().array_range().begin()+index,value);
+                    current_.back().get().insert(current_.back().get().array_range().begin()+index,std::forward<T>(value));
                 }
             }
         }
         else if (current_.back().get().is_object())
         {
-            current_.back().get().insert_or_assign(buffer_,value);
+            current_.back().get().insert_or_assign(buffer_,std::forward<T>(value));
         }
         else
         {
@@ -539,7 +867,8 @@ public:
         }
     }
 
-    void insert(reference root, const string_view_type& path, const J& value, std::error_code& ec)
+    template <class T>
+    void insert(reference root, const string_view_type& path, T&& value, std::error_code& ec)
     {
         evaluate(root, path, ec);
         if (ec)
@@ -550,7 +879,7 @@ public:
         {
             if (buffer_.size() == 1 && buffer_[0] == '-')
             {
-                current_.back().get().push_back(value);
+                current_.back().get().push_back(std::forward<T>(value));
             }
             else
             {
@@ -573,11 +902,11 @@ public:
                 }
                 if (index == current_.back().get().size())
                 {
-                    current_.back().get().push_back(value);
+                    current_.back().get().push_back(std::forward<T>(value));
                 }
                 else
                 {
-                    current_.back().get().insert(current_.back().get().array_range().begin()+index,value);
+                    current_.back().get().insert(current_.back().get().array_range().begin()+index,std::forward<T>(value));
                 }
             }
         }
@@ -590,7 +919,7 @@ public:
             }
             else
             {
-                current_.back().get().insert_or_assign(buffer_,value);
+                current_.back().get().insert_or_assign(buffer_,std::forward<T>(value));
             }
         }
         else
@@ -655,7 +984,8 @@ public:
         }
     }
 
-    void replace(reference root, const string_view_type& path, const J& value, std::error_code& ec)
+    template <class T>
+    void replace(reference root, const string_view_type& path, T&& value, std::error_code& ec)
     {
         evaluate(root, path, ec);
         if (ec)
@@ -688,7 +1018,7 @@ public:
                     ec = jsonpointer_errc::index_exceeds_array_size;
                     return;
                 }
-                (current_.back().get())[index] = value;
+                (current_.back().get())[index] = std::forward<T>(value);
             }
         }
         else if (current_.back().get().is_object())
@@ -700,7 +1030,7 @@ public:
             }
             else
             {
-                current_.back().get().insert_or_assign(buffer_,value);
+                current_.back().get().insert_or_assign(buffer_,std::forward<T>(value));
             }
         }
         else
@@ -794,6 +1124,157 @@ public:
     }
 };
 
+template <class J,class JReference>
+typename std::enable_if<is_accessible_by_reference<J>::value>::type
+resolve_member(handle_type<J,JReference>& current, const typename J::string_view_type& name, std::error_code& ec)
+{
+    auto it = current.get().find(name);
+    if (it == current.get().object_range().end())
+    {
+        ec = jsonpointer_errc::name_not_found;
+        return;
+    }
+    current = handle_type<J,JReference>(it->value());
+}
+
+template <class J,class JReference>
+typename std::enable_if<!is_accessible_by_reference<J>::value>::type
+resolve_member(handle_type<J,JReference>& current, const typename J::string_view_type& name, std::error_code& ec)
+{
+    if (!current.get().contains(name))
+    {
+        ec = jsonpointer_errc::name_not_found;
+        return;
+    }
+    current = handle_type<J,JReference>(current.get().at(name));
+}
+
+// Resolves the tokens in [first,last) starting from current, which on error is left at the last value resolved
+
+template <class J,class JReference,class Token>
+void resolve_token(handle_type<J,JReference>& current, const Token& tok, std::error_code& ec)
+{
+    if (current.get().is_array())
+    {
+        if (tok.is_end())
+        {
+            ec = jsonpointer_errc::index_exceeds_array_size;
+            return;
+        }
+        if (!tok.is_index())
+        {
+            ec = jsonpointer_errc::invalid_index;
+            return;
+        }
+        if (tok.index() >= current.get().size())
+        {
+            ec = jsonpointer_errc::index_exceeds_array_size;
+            return;
+        }
+        current = handle_type<J,JReference>(current.get().at(tok.index()));
+    }
+    else if (current.get().is_object())
+    {
+        resolve_member(current, tok.name(), ec);
+    }
+    else
+    {
+        ec = jsonpointer_errc::expected_object_or_array;
+    }
+}
+
+template <class J,class JReference,class Iterator>
+void resolve_tokens(handle_type<J,JReference>& current, Iterator first, Iterator last, std::error_code& ec)
+{
+    for (Iterator it = first; it != last; ++it)
+    {
+        resolve_token(current, *it, ec);
+        if (ec)
+        {
+            return;
+        }
+    }
+}
+
+enum class update_kind {insert_or_assign, insert, replace};
+
+template <class J,class CharT>
+void update(J& root, const basic_compiled_address<CharT>& location, const J& value, update_kind kind, std::error_code& ec)
+{
+    handle_type<J,J&> parent(root);
+    typename basic_compiled_address<CharT>::token default_token;
+    const auto& last = location.empty() ? default_token : location[location.size()-1];
+    if (!location.empty())
+    {
+        resolve_tokens(parent, location.begin(), location.end()-1, ec);
+        if (ec)
+        {
+            return;
+        }
+    }
+
+    J& target = parent.get();
+    if (target.is_array())
+    {
+        if (last.is_end())
+        {
+            if (kind == update_kind::replace)
+            {
+                ec = jsonpointer_errc::index_exceeds_array_size;
+                return;
+            }
+            target.push_back(value);
+            return;
+        }
+        if (!last.is_index())
+        {
+            ec = jsonpointer_errc::invalid_index;
+            return;
+        }
+        size_t index = last.index();
+        if (kind == update_kind::replace)
+        {
+            if (index >= target.size())
+            {
+                ec = jsonpointer_errc::index_exceeds_array_size;
+                return;
+            }
+            target[index] = value;
+        }
+        else if (index > target.size())
+        {
+            ec = jsonpointer_errc::index_exceeds_array_size;
+            return;
+        }
+        else if (index == target.size())
+        {
+            target.push_back(value);
+        }
+        else
+        {
+            target.insert(target.array_range().begin()+index,value);
+        }
+    }
+    else if (target.is_object())
+    {
+        if (kind == update_kind::insert && target.contains(last.name()))
+        {
+            ec = jsonpointer_errc::key_already_exists;
+            return;
+        }
+        if (kind == update_kind::replace && !target.contains(last.name()))
+        {
+            ec = jsonpointer_errc::key_already_exists;
+            return;
+        }
+        target.insert_or_assign(last.name(),value);
+    }
+    else
+    {
+        ec = jsonpointer_errc::expected_object_or_array;
+    }
+}
+
 }
 
 template<class J>
@@ -967,6 +1448,253 @@ void replace(J& root, const typename J::string_view_type& path, const J& value,
     evaluator.replace(root, path, value, ec);
 }
 
+// Compiled address overloads
+
+template<class J>
+typename std::enable_if<is_accessible_by_reference<J>::value,J&>::type
+get(J& root, const basic_compiled_address<typename J::char_type>& location, std::error_code& ec)
+{
+    jsoncons::jsonpointer::detail::handle_type<J,J&> current(root);
+    jsoncons::jsonpointer::detail::resolve_tokens(current, location.begin(), location.end(), ec);
+    return current.get();
+}
+
+template<class J>
+typename std::enable_if<is_accessible_by_reference<J>::value,const J&>::type
+get(const J& root, const basic_compiled_address<typename J::char_type>& location, std::error_code& ec)
+{
+    jsoncons::jsonpointer::detail::handle_type<J,const J&> current(root);
+    jsoncons::jsonpointer::detail::resolve_tokens(current, location.begin(), location.end(), ec);
+    return current.get();
+}
+
+template<class J>
+typename std::enable_if<!is_accessible_by_reference<J>::value,J>::type
+get(const J& root, const basic_compiled_address<typename J::char_type>& location, std::error_code& ec)
+{
+    jsoncons::jsonpointer::detail::handle_type<J,const J&> current(root);
+    jsoncons::jsonpointer::detail::resolve_tokens(current, location.begin(), location.end(), ec);
+    return current.get();
+}
+
+template<class J>
+typename std::enable_if<is_accessible_by_reference<J>::value,J&>::type
+get(J& root, const basic_compiled_address<typename J::char_type>& location)
+{
+    std::error_code ec;
+    J& result = get(root, location, ec);
+    if (ec)
+    {
+        JSONCONS_THROW(jsonpointer_error(ec));
+    }
+    return result;
+}
+
+template<class J>
+typename std::enable_if<is_accessible_by_reference<J>::value,const J&>::type
+get(const J& root, const basic_compiled_address<typename J::char_type>& location)
+{
+    std::error_code ec;
+    const J& result = get(root, location, ec);
+    if (ec)
+    {
+        JSONCONS_THROW(jsonpointer_error(ec));
+    }
+    return result;
+}
+
+template<class J>
+typename std::enable_if<!is_accessible_by_reference<J>::value,J>::type
+get(const J& root, const basic_compiled_address<typename J::char_type>& location)
+{
+    std::error_code ec;
+    J result = get(root, location, ec);
+    if (ec)
+    {
+        JSONCONS_THROW(jsonpointer_error(ec));
+    }
+    return result;
+}
+
+// Address set overloads
+
+template<class J>
+typename std::enable_if<is_accessible_by_reference<J>::value,std::vector<const J*>>::type
+get(const J& root, const basic_address_set<typename J::char_type>& locations, std::vector<std::error_code>& ec)
+{
+    typedef jsoncons::jsonpointer::detail::handle_type<J,const J&> handle;
+    typedef typename basic_address_set<typename J::char_type>::token token;
+
+    std::vector<const J*> values(locations.size(), nullptr);
+    ec.assign(locations.size(), std::error_code());
+    locations.resolve(handle(root),
+                      [](handle& current, const token& tok, std::error_code& e)
+                      {
+                          jsoncons::jsonpointer::detail::resolve_token(current, tok, e);
+                      },
+                      [&](size_t i, const handle& current, const std::error_code& e)
+                      {
+                          if (e)
+                          {
+                              ec[i] = e;
+                          }
+                          else
+                          {
+                              values[i] = std::addressof(current.get());
+                          }
+                      });
+    return values;
+}
+
+template<class J>
+typename std::enable_if<!is_accessible_by_reference<J>::value,std::vector<J>>::type
+get(const J& root, const basic_address_set<typename J::char_type>& locations, std::vector<std::error_code>& ec)
+{
+    typedef jsoncons::jsonpointer::detail::handle_type<J,const J&> handle;
+    typedef typename basic_address_set<typename J::char_type>::token token;
+
+    std::vector<J> values(locations.size());
+    ec.assign(locations.size(), std::error_code());
+    locations.resolve(handle(root),
+                      [](handle& current, const token& tok, std::error_code& e)
+                      {
+                          jsoncons::jsonpointer::detail::resolve_token(current, tok, e);
+                      },
+                      [&](size_t i, const handle& current, const std::error_code& e)
+                      {
+                          if (e)
+                          {
+                              ec[i] = e;
+                          }
+                          else
+                          {
+                              values[i] = current.get();
+                          }
+                      });
+    return values;
+}
+
+template<class J>
+bool contains(const J& root, const basic_compiled_address<typename J::char_type>& location)
+{
+    std::error_code ec;
+    jsoncons::jsonpointer::detail::handle_type<J,const J&> current(root);
+    jsoncons::jsonpointer::detail::resolve_tokens(current, location.begin(), location.end(), ec);
+    return !ec ? true : false;
+}
+
+template<class J>
+void insert_or_assign(J& root, const basic_compiled_address<typename J::char_type>& location, const J& value, std::error_code& ec)
+{
+    jsoncons::jsonpointer::detail::update(root, location, value, jsoncons::jsonpointer::detail::update_kind::insert_or_assign, ec);
+}
+
+template<class J>
+void insert_or_assign(J& root, const basic_compiled_address<typename J::char_type>& location, const J& value)
+{
+    std::error_code ec;
+    insert_or_assign(root, location, value, ec);
+    if (ec)
+    {
+        JSONCONS_THROW(jsonpointer_error(ec));
+    }
+}
+
+template<class J>
+void insert(J& root, const basic_compiled_address<typename J::char_type>& location, const J& value, std::error_code& ec)
+{
+    jsoncons::jsonpointer::detail::update(root, location, value, jsoncons::jsonpointer::detail::update_kind::insert, ec);
+}
+
+template<class J>
+void insert(J& root, const basic_compiled_address<typename J::char_type>& location, const J& value)
+{
+    std::error_code ec;
+    insert(root, location, value, ec);
+    if (ec)
+    {
+        JSONCONS_THROW(jsonpointer_error(ec));
+    }
+}
+
+template<class J>
+void replace(J& root, const basic_compiled_address<typename J::char_type>& location, const J& value, std::error_code& ec)
+{
+    jsoncons::jsonpointer::detail::update(root, location, value, jsoncons::jsonpointer::detail::update_kind::replace, ec);
+}
+
+template<class J>
+void replace(J& root, const basic_compiled_address<typename J::char_type>& location, const J& value)
+{
+    std::error_code ec;
+    replace(root, location, value, ec);
+    if (ec)
+    {
+        JSONCONS_THROW(jsonpointer_error(ec));
+    }
+}
+
+template<class J>
+void remove(J& root, const basic_compiled_address<typename J::char_type>& location, std::error_code& ec)
+{
+    jsoncons::jsonpointer::detail::handle_type<J,J&> parent(root);
+    typename basic_compiled_address<typename J::char_type>::token default_token;
+    const auto& last = location.empty() ? default_token : location[location.size()-1];
+    if (!location.empty())
+    {
+        jsoncons::jsonpointer::detail::resolve_tokens(parent, location.begin(), location.end()-1, ec);
+        if (ec)
+        {
+            return;
+        }
+    }
+
+    J& target = parent.get();
+    if (target.is_array())
+    {
+        if (last.is_end())
+        {
+            ec = jsonpointer_errc::index_exceeds_array_size;
+            return;
+        }
+        if (!last.is_index())
+        {
+            ec = jsonpointer_errc::invalid_index;
+            return;
+        }
+        if (last.index() >= target.size())
+        {
+            ec = jsonpointer_errc::index_exceeds_array_size;
+            return;
+        }
+        target.erase(target.array_range().begin()+last.index());
+    }
+    else if (target.is_object())
+    {
+        if (!target.contains(last.name()))
+        {
+            ec = jsonpointer_errc::name_not_found;
+            return;
+        }
+        target.erase(last.name());
+    }
+    else
+    {
+        ec = jsonpointer_errc::expected_object_or_array;
+    }
+}
+
+template<class J>
+void remove(J& root, const basic_compiled_address<typename J::char_type>& location)
+{
+    std::error_code ec;
+    remove(root, location, ec);
+    if (ec)
+    {
+        JSONCONS_THROW(jsonpointer_error(ec));
+    }
+}
+
 template <class String>
 void escape(const String& s, std::basic_ostringstream<typename String::value_type>& os)
 {
@@ -16,6 +16,7 @@
 #include <jsoncons/config/binary_detail.hpp>
 #include <jsoncons_ext/msgpack/msgpack_serializer.hpp>
 #include <jsoncons_ext/msgpack/msgpack_reader.hpp>
+#include <jsoncons_ext/msgpack/msgpack_pull_reader.hpp>
 
 namespace jsoncons { namespace msgpack {
 
@@ -40,7 +41,8 @@ void encode_msgpack(const Json& j, std::vector<uint8_t>& v)
 // decode_msgpack
 
 template<class Json>
-Json decode_msgpack(const std::vector<uint8_t>& v)
+typename std::enable_if<jsoncons::detail::is_basic_json_class<Json>::value,Json>::type 
+decode_msgpack(const std::vector<uint8_t>& v)
 {
     jsoncons::json_decoder<Json> decoder;
     msgpack_buffer_reader parser(v, decoder);
@@ -54,7 +56,7 @@ Json decode_msgpack(const std::vector<uint8_t>& v)
 }
 
 template<class Json>
-typename std::enable_if<std::is_same<typename Json::char_type,char>::value,Json>::type 
+typename std::enable_if<jsoncons::detail::is_basic_json_class<Json>::value && std::is_same<typename Json::char_type,char>::value,Json>::type 
 decode_msgpack(std::basic_istream<typename Json::char_type>& is)
 {
     //typedef typename Json::char_type char_type;
@@ -71,7 +73,7 @@ decode_msgpack(std::basic_istream<typename Json::char_type>& is)
 }
 
 template<class Json>
-typename std::enable_if<!std::is_same<typename Json::char_type,char>::value,Json>::type 
+typename std::enable_if<jsoncons::detail::is_basic_json_class<Json>::value && !std::is_same<typename Json::char_type,char>::value,Json>::type 
 decode_msgpack(std::basic_istream<typename Json::char_type>& is)
 {
     //typedef typename Json::char_type char_type;
@@ -87,6 +89,28 @@ decode_msgpack(std::basic_istream<typename Json::char_type>& is)
     }
     return decoder.get_result();
 }
+
+// Types other than basic_json are decoded with conversion_traits straight from a pull reader
+
+template<class T>
+typename std::enable_if<!jsoncons::detail::is_basic_json_class<T>::value,T>::type 
+decode_msgpack(const std::vector<uint8_t>& v)
+{
+    msgpack_buffer_pull_reader reader(v);
+    T val;
+    decode_stream(reader, val);
+    return val;
+}
+
+template<class T>
+typename std::enable_if<!jsoncons::detail::is_basic_json_class<T>::value,T>::type 
+decode_msgpack(std::istream& is)
+{
+    msgpack_pull_reader reader(is);
+    T val;
+    decode_stream(reader, val);
+    return val;
+}
   
 #if !defined(JSONCONS_NO_DEPRECATED)
 template<class Json>
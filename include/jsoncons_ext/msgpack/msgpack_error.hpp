@@ -21,7 +21,9 @@ enum class msgpack_errc
     array_length_required,
     object_length_required,
     too_many_items,
-    too_few_items
+    too_few_items,
+    unknown_type,
+    map_key_must_be_string
 };
 
 class msgpack_error_category_impl
@@ -50,6 +52,10 @@ public:
                 return "Too many items were added to a MessagePack object or array";
             case msgpack_errc::too_few_items:
                 return "Too few items were added to a MessagePack object or array";
+            case msgpack_errc::unknown_type:
+                return "An unknown type was found in the stream";
+            case msgpack_errc::map_key_must_be_string:
+                return "MessagePack map keys must be strings";
             default:
                 return "Unknown MessagePack parser error";
         }
@@ -0,0 +1,590 @@
+// Copyright 2017 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_MSGPACK_MSGPACK_PARSER_HPP
+#define JSONCONS_MSGPACK_MSGPACK_PARSER_HPP
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <utility> // std::move
+#include <jsoncons/json.hpp>
+#include <jsoncons/source.hpp>
+#include <jsoncons/json_content_handler.hpp>
+#include <jsoncons/config/binary_detail.hpp>
+#include <jsoncons_ext/msgpack/msgpack_detail.hpp>
+#include <jsoncons_ext/msgpack/msgpack_error.hpp>
+
+namespace jsoncons { namespace msgpack {
+
+enum class msgpack_parse_mode {root,before_done,array,map_key,map_value};
+
+struct msgpack_parse_state
+{
+    msgpack_parse_mode mode;
+    size_t length;
+    size_t index;
+
+    msgpack_parse_state(msgpack_parse_mode mode, size_t length)
+        : mode(mode), length(length), index(0)
+    {
+    }
+};
+
+// Reads one MessagePack item from source, reporting its events to a handler. Containers are
+// tracked on an explicit stack, so nesting depth doesn't grow the call stack, and parsing
+// stops after any event for which the handler returns false, resuming there on the
+// next call to parse. With a partial_buffer_source, the input may be given a piece at a
+// time with update and parse_some.
+
+template <class Source>
+class basic_msgpack_parser : public serializing_context
+{
+    Source source_;
+    bool continue_;
+    bool done_;
+    std::string buffer_;
+    std::vector<uint8_t> bytes_buffer_;
+    std::vector<msgpack_parse_state> state_stack_;
+public:
+    typedef Source source_type;
+
+    basic_msgpack_parser(Source source)
+       : source_(std::move(source)),
+         continue_(true),
+         done_(false)
+    {
+        state_stack_.emplace_back(msgpack_parse_mode::root,0);
+    }
+
+    // Prepares to read the next item from the source
+    void reset()
+    {
+        state_stack_.clear();
+        state_stack_.emplace_back(msgpack_parse_mode::root,0);
+        continue_ = true;
+        done_ = false;
+    }
+
+    bool done() const
+    {
+        return done_;
+    }
+
+    bool stopped() const
+    {
+        return !continue_;
+    }
+
+    void restart()
+    {
+        continue_ = true;
+    }
+
+    void parse(json_content_handler& handler, std::error_code& ec)
+    {
+        try
+        {
+            while (!done_ && continue_)
+            {
+                parse_step(handler, ec);
+                if (ec)
+                {
+                    return;
+                }
+            }
+        }
+        catch (const serialization_error& e)
+        {
+            ec = e.code();
+        }
+    }
+
+    // Gives the parser the next piece of input, when Source is partial_buffer_source
+    void update(const uint8_t* data, size_t length)
+    {
+        source_.update(data, length);
+    }
+
+    bool source_exhausted() const
+    {
+        return source_.exhausted();
+    }
+
+    // Parses the input given to update so far. An item that runs past the end of it is
+    // put back, along with its parse state, and read again once more input arrives.
+    void parse_some(json_content_handler& handler, std::error_code& ec)
+    {
+        if (!source_.can_resume())
+        {
+            return;
+        }
+        try
+        {
+            while (!done_ && continue_)
+            {
+                msgpack_parse_state state = state_stack_.back();
+                size_t depth = state_stack_.size();
+                source_.mark();
+                parse_step(handler, ec);
+                if (ec)
+                {
+                    if (ec == msgpack_errc::unexpected_eof && source_.eof())
+                    {
+                        source_.rewind();
+                        if (state_stack_.size() > depth)
+                        {
+                            state_stack_.erase(state_stack_.begin() + depth, state_stack_.end());
+                        }
+                        state_stack_.back() = state;
+                        ec = std::error_code();
+                    }
+                    return;
+                }
+            }
+        }
+        catch (const serialization_error& e)
+        {
+            ec = e.code();
+        }
+    }
+
+    size_t line_number() const override
+    {
+        return 0;
+    }
+
+    size_t column_number() const override
+    {
+        return source_.position();
+    }
+private:
+    void parse_step(json_content_handler& handler, std::error_code& ec)
+    {
+        msgpack_parse_state& state = state_stack_.back();
+        switch (state.mode)
+        {
+            case msgpack_parse_mode::array:
+            {
+                if (state.index < state.length)
+                {
+                    ++state.index;
+                    read_item(handler, ec);
+                    if (ec)
+                    {
+                        return;
+                    }
+                }
+                else
+                {
+                    state_stack_.pop_back();
+                    continue_ = handler.end_array(*this);
+                }
+                break;
+            }
+            case msgpack_parse_mode::map_key:
+            {
+                if (state.index < state.length)
+                {
+                    ++state.index;
+                    state.mode = msgpack_parse_mode::map_value;
+                    read_name(handler, ec);
+                    if (ec)
+                    {
+                        return;
+                    }
+                }
+                else
+                {
+                    state_stack_.pop_back();
+                    continue_ = handler.end_object(*this);
+                }
+                break;
+            }
+            case msgpack_parse_mode::map_value:
+            {
+                state.mode = msgpack_parse_mode::map_key;
+                read_item(handler, ec);
+                if (ec)
+                {
+                    return;
+                }
+                break;
+            }
+            case msgpack_parse_mode::root:
+            {
+                state.mode = msgpack_parse_mode::before_done;
+                read_item(handler, ec);
+                if (ec)
+                {
+                    return;
+                }
+                break;
+            }
+            case msgpack_parse_mode::before_done:
+            {
+                JSONCONS_ASSERT(state_stack_.size() == 1);
+                handler.flush();
+                done_ = true;
+                break;
+            }
+        }
+    }
+
+
+    void read_item(json_content_handler& handler, std::error_code& ec)
+    {
+        if (source_.is_error())
+        {
+            ec = msgpack_errc::source_error;
+            return;
+        }
+
+        uint8_t type{};
+        if (source_.get(type) == 0)
+        {
+            ec = msgpack_errc::unexpected_eof;
+            return;
+        }
+
+        if (type <= 0xbf)
+        {
+            if (type <= 0x7f)
+            {
+                // positive fixint
+                continue_ = handler.uint64_value(type, semantic_tag_type::none, *this);
+            }
+            else if (type <= 0x8f)
+            {
+                // fixmap
+                begin_object(handler, type & 0x0f);
+            }
+            else if (type <= 0x9f)
+            {
+                // fixarray
+                begin_array(handler, type & 0x0f);
+            }
+            else
+            {
+                // fixstr
+                read_string(type & 0x1f, ec);
+                if (ec)
+                {
+                    return;
+                }
+                continue_ = handler.string_value(basic_string_view<char>(buffer_.data(),buffer_.length()), semantic_tag_type::none, *this);
+            }
+        }
+        else if (type >= 0xe0)
+        {
+            // negative fixint
+            continue_ = handler.int64_value(static_cast<int8_t>(type), semantic_tag_type::none, *this);
+        }
+        else
+        {
+            switch (type)
+            {
+                case msgpack_format::nil_cd:
+                {
+                    continue_ = handler.null_value(semantic_tag_type::none, *this);
+                    break;
+                }
+                case msgpack_format::true_cd:
+                {
+                    continue_ = handler.bool_value(true, semantic_tag_type::none, *this);
+                    break;
+                }
+                case msgpack_format::false_cd:
+                {
+                    continue_ = handler.bool_value(false, semantic_tag_type::none, *this);
+                    break;
+                }
+                case msgpack_format::float32_cd:
+                {
+                    float val = read_number<float>(ec);
+                    if (ec)
+                    {
+                        return;
+                    }
+                    continue_ = handler.double_value(val, semantic_tag_type::none, *this);
+                    break;
+                }
+
+                case msgpack_format::float64_cd:
+                {
+                    double val = read_number<double>(ec);
+                    if (ec)
+                    {
+                        return;
+                    }
+                    continue_ = handler.double_value(val, semantic_tag_type::none, *this);
+                    break;
+                }
+
+                case msgpack_format::uint8_cd:
+                {
+                    uint8_t val = read_number<uint8_t>(ec);
+                    if (ec)
+                    {
+                        return;
+                    }
+                    continue_ = handler.uint64_value(val, semantic_tag_type::none, *this);
+                    break;
+                }
+
+                case msgpack_format::uint16_cd:
+                {
+                    uint16_t val = read_number<uint16_t>(ec);
+                    if (ec)
+                    {
+                        return;
+                    }
+                    continue_ = handler.uint64_value(val, semantic_tag_type::none, *this);
+                    break;
+                }
+
+                case msgpack_format::uint32_cd:
+                {
+                    uint32_t val = read_number<uint32_t>(ec);
+                    if (ec)
+                    {
+                        return;
+                    }
+                    continue_ = handler.uint64_value(val, semantic_tag_type::none, *this);
+                    break;
+                }
+
+                case msgpack_format::uint64_cd:
+                {
+                    uint64_t val = read_number<uint64_t>(ec);
+                    if (ec)
+                    {
+                        return;
+                    }
+                    continue_ = handler.uint64_value(val, semantic_tag_type::none, *this);
+                    break;
+                }
+
+                case msgpack_format::int8_cd:
+                {
+                    int8_t val = read_number<int8_t>(ec);
+                    if (ec)
+                    {
+                        return;
+                    }
+                    continue_ = handler.int64_value(val, semantic_tag_type::none, *this);
+                    break;
+                }
+
+                case msgpack_format::int16_cd:
+                {
+                    int16_t val = read_number<int16_t>(ec);
+                    if (ec)
+                    {
+                        return;
+                    }
+                    continue_ = handler.int64_value(val, semantic_tag_type::none, *this);
+                    break;
+                }
+
+                case msgpack_format::int32_cd:
+                {
+                    int32_t val = read_number<int32_t>(ec);
+                    if (ec)
+                    {
+                        return;
+                    }
+                    continue_ = handler.int64_value(val, semantic_tag_type::none, *this);
+                    break;
+                }
+
+                case msgpack_format::int64_cd:
+                {
+                    int64_t val = read_number<int64_t>(ec);
+                    if (ec)
+                    {
+                        return;
+                    }
+                    continue_ = handler.int64_value(val, semantic_tag_type::none, *this);
+                    break;
+                }
+
+                case msgpack_format::str8_cd:
+                case msgpack_format::str16_cd:
+                case msgpack_format::str32_cd:
+                {
+                    size_t len = read_length(type, ec);
+                    if (ec)
+                    {
+                        return;
+                    }
+                    read_string(len, ec);
+                    if (ec)
+                    {
+                        return;
+                    }
+                    continue_ = handler.string_value(basic_string_view<char>(buffer_.data(),buffer_.length()), semantic_tag_type::none, *this);
+                    break;
+                }
+
+                case msgpack_format::bin8_cd:
+                case msgpack_format::bin16_cd:
+                case msgpack_format::bin32_cd:
+                {
+                    size_t len = read_length(type, ec);
+                    if (ec)
+                    {
+                        return;
+                    }
+                    bytes_buffer_.clear();
+                    if (source_.read(std::back_inserter(bytes_buffer_), len) != len)
+                    {
+                        ec = msgpack_errc::unexpected_eof;
+                        return;
+                    }
+                    continue_ = handler.byte_string_value(byte_string_view(bytes_buffer_.data(),bytes_buffer_.size()),
+                                                          semantic_tag_type::none,
+                                                          *this);
+                    break;
+                }
+
+                case msgpack_format::array16_cd:
+                case msgpack_format::array32_cd:
+                {
+                    size_t len = read_length(type, ec);
+                    if (ec)
+                    {
+                        return;
+                    }
+                    begin_array(handler, len);
+                    break;
+                }
+
+                case msgpack_format::map16_cd :
+                case msgpack_format::map32_cd :
+                {
+                    size_t len = read_length(type, ec);
+                    if (ec)
+                    {
+                        return;
+                    }
+                    begin_object(handler, len);
+                    break;
+                }
+
+                default:
+                {
+                    ec = msgpack_errc::unknown_type;
+                    return;
+                }
+            }
+        }
+    }
+
+    void read_name(json_content_handler& handler, std::error_code& ec)
+    {
+        uint8_t type{};
+        if (source_.get(type) == 0)
+        {
+            ec = msgpack_errc::unexpected_eof;
+            return;
+        }
+
+        size_t len;
+        if (type >= 0xa0 && type <= 0xbf)
+        {
+            // fixstr
+            len = type & 0x1f;
+        }
+        else
+        {
+            switch (type)
+            {
+                case msgpack_format::str8_cd:
+                case msgpack_format::str16_cd:
+                case msgpack_format::str32_cd:
+                    len = read_length(type, ec);
+                    if (ec)
+                    {
+                        return;
+                    }
+                    break;
+                default:
+                    ec = msgpack_errc::map_key_must_be_string;
+                    return;
+            }
+        }
+        read_string(len, ec);
+        if (ec)
+        {
+            return;
+        }
+        continue_ = handler.name(basic_string_view<char>(buffer_.data(),buffer_.length()), *this);
+    }
+
+    void begin_array(json_content_handler& handler, size_t length)
+    {
+        state_stack_.emplace_back(msgpack_parse_mode::array,length);
+        continue_ = handler.begin_array(length, semantic_tag_type::none, *this);
+    }
+
+    void begin_object(json_content_handler& handler, size_t length)
+    {
+        state_stack_.emplace_back(msgpack_parse_mode::map_key,length);
+        continue_ = handler.begin_object(length, semantic_tag_type::none, *this);
+    }
+
+    template <class T>
+    T read_number(std::error_code& ec)
+    {
+        uint8_t buf[sizeof(T)];
+        if (source_.read(buf, sizeof(T)) != sizeof(T))
+        {
+            ec = msgpack_errc::unexpected_eof;
+            return T();
+        }
+        const uint8_t* endp;
+        return jsoncons::detail::from_big_endian<T>(buf,buf+sizeof(buf),&endp);
+    }
+
+    // Reads the length that follows a str, bin, array or map type code
+    size_t read_length(uint8_t type, std::error_code& ec)
+    {
+        switch (type)
+        {
+            case msgpack_format::str8_cd:
+            case msgpack_format::bin8_cd:
+                return read_number<uint8_t>(ec);
+            case msgpack_format::str16_cd:
+            case msgpack_format::bin16_cd:
+            case msgpack_format::array16_cd:
+            case msgpack_format::map16_cd:
+                return read_number<uint16_t>(ec);
+            default:
+                return read_number<uint32_t>(ec);
+        }
+    }
+
+    void read_string(size_t length, std::error_code& ec)
+    {
+        buffer_.clear();
+        if (source_.read(std::back_inserter(buffer_), length) != length)
+        {
+            ec = msgpack_errc::unexpected_eof;
+            return;
+        }
+        auto result = unicons::validate(buffer_.begin(),buffer_.end());
+        if (result.ec != unicons::conv_errc())
+        {
+            ec = msgpack_errc::invalid_utf8_text_string;
+            return;
+        }
+    }
+};
+
+}}
+
+#endif
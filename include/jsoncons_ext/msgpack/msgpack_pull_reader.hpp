@@ -0,0 +1,25 @@
+// Copyright 2018 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_MSGPACK_MSGPACK_PULL_READER_HPP
+#define JSONCONS_MSGPACK_MSGPACK_PULL_READER_HPP
+
+#include <jsoncons/source.hpp>
+#include <jsoncons/binary_pull_reader.hpp>
+#include <jsoncons_ext/msgpack/msgpack_parser.hpp>
+
+namespace jsoncons { namespace msgpack {
+
+template <class Source>
+using basic_msgpack_pull_reader = basic_binary_pull_reader<basic_msgpack_parser<Source>>;
+
+typedef basic_msgpack_pull_reader<jsoncons::binary_stream_source> msgpack_pull_reader;
+
+typedef basic_msgpack_pull_reader<jsoncons::buffer_source> msgpack_buffer_pull_reader;
+
+}}
+
+#endif
@@ -16,6 +16,7 @@
 #include <jsoncons/config/binary_detail.hpp>
 #include <jsoncons_ext/ubjson/ubjson_serializer.hpp>
 #include <jsoncons_ext/ubjson/ubjson_reader.hpp>
+#include <jsoncons_ext/ubjson/ubjson_pull_reader.hpp>
 
 namespace jsoncons { namespace ubjson {
 
@@ -40,7 +41,8 @@ void encode_ubjson(const Json& j, std::vector<uint8_t>& v)
 // decode_ubjson
 
 template<class Json>
-Json decode_ubjson(const std::vector<uint8_t>& v)
+typename std::enable_if<jsoncons::detail::is_basic_json_class<Json>::value,Json>::type 
+decode_ubjson(const std::vector<uint8_t>& v)
 {
     jsoncons::json_decoder<Json> decoder;
     ubjson_buffer_reader parser(v, decoder);
@@ -53,7 +55,7 @@ Json decode_ubjson(const std::vector<uint8_t>& v)
     return decoder.get_result();
 }
 template<class Json>
-typename std::enable_if<std::is_same<typename Json::char_type,char>::value,Json>::type 
+typename std::enable_if<jsoncons::detail::is_basic_json_class<Json>::value && std::is_same<typename Json::char_type,char>::value,Json>::type 
 decode_ubjson(std::basic_istream<typename Json::char_type>& is)
 {
     //typedef typename Json::char_type char_type;
@@ -70,7 +72,7 @@ decode_ubjson(std::basic_istream<typename Json::char_type>& is)
 }
 
 template<class Json>
-typename std::enable_if<!std::is_same<typename Json::char_type,char>::value,Json>::type 
+typename std::enable_if<jsoncons::detail::is_basic_json_class<Json>::value && !std::is_same<typename Json::char_type,char>::value,Json>::type 
 decode_ubjson(std::basic_istream<typename Json::char_type>& is)
 {
     //typedef typename Json::char_type char_type;
@@ -87,6 +89,29 @@ decode_ubjson(std::basic_istream<typename Json::char_type>& is)
     return decoder.get_result();
 }
 
+// For any other T, the value is read through conversion_traits<T> with a pull reader,
+// without building an intermediate basic_json
+
+template<class T>
+typename std::enable_if<!jsoncons::detail::is_basic_json_class<T>::value,T>::type 
+decode_ubjson(const std::vector<uint8_t>& v)
+{
+    ubjson_buffer_pull_reader reader(v);
+    T val;
+    decode_stream(reader, val);
+    return val;
+}
+
+template<class T>
+typename std::enable_if<!jsoncons::detail::is_basic_json_class<T>::value,T>::type 
+decode_ubjson(std::istream& is)
+{
+    ubjson_pull_reader reader(is);
+    T val;
+    decode_stream(reader, val);
+    return val;
+}
+
 }}
 
 #endif
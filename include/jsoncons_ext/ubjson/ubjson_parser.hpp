@@ -0,0 +1,759 @@
+// Copyright 2017 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_UBJSON_UBJSON_PARSER_HPP
+#define JSONCONS_UBJSON_UBJSON_PARSER_HPP
+
+#include <string>
+#include <memory>
+#include <vector>
+#include <algorithm> // std::min
+#include <utility> // std::move
+#include <jsoncons/json.hpp>
+#include <jsoncons/source.hpp>
+#include <jsoncons/json_content_handler.hpp>
+#include <jsoncons/config/binary_detail.hpp>
+#include <jsoncons_ext/ubjson/ubjson_detail.hpp>
+#include <jsoncons_ext/ubjson/ubjson_error.hpp>
+
+namespace jsoncons { namespace ubjson {
+
+enum class ubjson_parse_mode {root,before_done,array,indefinite_array,map_key,map_value,indefinite_map_key,indefinite_map_value};
+
+// type is the item type of a strongly typed container, or 0 if items carry their own type
+struct ubjson_parse_state
+{
+    ubjson_parse_mode mode;
+    size_t length;
+    size_t index;
+    uint8_t type;
+
+    ubjson_parse_state(ubjson_parse_mode mode, size_t length, uint8_t type = 0)
+        : mode(mode), length(length), index(0), type(type)
+    {
+    }
+};
+
+// Reads one UBJSON value from source, reporting its events to a handler. Containers are
+// tracked on an explicit stack, so nesting depth doesn't grow the call stack, and parsing
+// stops after any event for which the handler returns false, resuming there on the
+// next call to parse. With a partial_buffer_source, the input may be given a piece at a
+// time with update and parse_some.
+
+template <class Source>
+class basic_ubjson_parser : public serializing_context
+{
+    Source source_;
+    bool continue_;
+    bool done_;
+    std::string buffer_;
+    std::vector<int64_t> int64_array_;
+    std::vector<uint64_t> uint64_array_;
+    std::vector<double> double_array_;
+    std::vector<ubjson_parse_state> state_stack_;
+public:
+    typedef Source source_type;
+
+    basic_ubjson_parser(Source source)
+       : source_(std::move(source)),
+         continue_(true),
+         done_(false)
+    {
+        state_stack_.emplace_back(ubjson_parse_mode::root,0);
+    }
+
+    // Prepares to read the next value from the source
+    void reset()
+    {
+        state_stack_.clear();
+        state_stack_.emplace_back(ubjson_parse_mode::root,0);
+        continue_ = true;
+        done_ = false;
+    }
+
+    bool done() const
+    {
+        return done_;
+    }
+
+    bool stopped() const
+    {
+        return !continue_;
+    }
+
+    void restart()
+    {
+        continue_ = true;
+    }
+
+    void parse(json_content_handler& handler, std::error_code& ec)
+    {
+        try
+        {
+            while (!done_ && continue_)
+            {
+                parse_step(handler, ec);
+                if (ec)
+                {
+                    return;
+                }
+            }
+        }
+        catch (const serialization_error& e)
+        {
+            ec = e.code();
+        }
+    }
+
+    // Gives the parser the next piece of input, when Source is partial_buffer_source
+    void update(const uint8_t* data, size_t length)
+    {
+        source_.update(data, length);
+    }
+
+    bool source_exhausted() const
+    {
+        return source_.exhausted();
+    }
+
+    // Parses the input given to update so far. An item that runs past the end of it is
+    // put back, along with its parse state, and read again once more input arrives.
+    void parse_some(json_content_handler& handler, std::error_code& ec)
+    {
+        if (!source_.can_resume())
+        {
+            return;
+        }
+        try
+        {
+            while (!done_ && continue_)
+            {
+                ubjson_parse_state state = state_stack_.back();
+                size_t depth = state_stack_.size();
+                source_.mark();
+                parse_step(handler, ec);
+                if (ec)
+                {
+                    if (ec == ubjson_errc::unexpected_eof && source_.eof())
+                    {
+                        source_.rewind();
+                        if (state_stack_.size() > depth)
+                        {
+                            state_stack_.erase(state_stack_.begin() + depth, state_stack_.end());
+                        }
+                        state_stack_.back() = state;
+                        ec = std::error_code();
+                    }
+                    return;
+                }
+            }
+        }
+        catch (const serialization_error& e)
+        {
+            ec = e.code();
+        }
+    }
+
+    size_t line_number() const override
+    {
+        return 0;
+    }
+
+    size_t column_number() const override
+    {
+        return source_.position();
+    }
+private:
+    void parse_step(json_content_handler& handler, std::error_code& ec)
+    {
+        ubjson_parse_state& state = state_stack_.back();
+        switch (state.mode)
+        {
+            case ubjson_parse_mode::array:
+            {
+                if (state.index < state.length)
+                {
+                    ++state.index;
+                    read_item(handler, state.type, ec);
+                    if (ec)
+                    {
+                        return;
+                    }
+                }
+                else
+                {
+                    state_stack_.pop_back();
+                    continue_ = handler.end_array(*this);
+                }
+                break;
+            }
+            case ubjson_parse_mode::indefinite_array:
+            {
+                bool at_end = peek_marker(ubjson_format::end_array_marker, ec);
+                if (ec)
+                {
+                    return;
+                }
+                if (at_end)
+                {
+                    source_.ignore(1);
+                    state_stack_.pop_back();
+                    continue_ = handler.end_array(*this);
+                }
+                else
+                {
+                    read_item(handler, 0, ec);
+                    if (ec)
+                    {
+                        return;
+                    }
+                }
+                break;
+            }
+            case ubjson_parse_mode::map_key:
+            {
+                if (state.index < state.length)
+                {
+                    ++state.index;
+                    state.mode = ubjson_parse_mode::map_value;
+                    read_name(handler, ec);
+                    if (ec)
+                    {
+                        return;
+                    }
+                }
+                else
+                {
+                    state_stack_.pop_back();
+                    continue_ = handler.end_object(*this);
+                }
+                break;
+            }
+            case ubjson_parse_mode::map_value:
+            {
+                state.mode = ubjson_parse_mode::map_key;
+                read_item(handler, state.type, ec);
+                if (ec)
+                {
+                    return;
+                }
+                break;
+            }
+            case ubjson_parse_mode::indefinite_map_key:
+            {
+                bool at_end = peek_marker(ubjson_format::end_object_marker, ec);
+                if (ec)
+                {
+                    return;
+                }
+                if (at_end)
+                {
+                    source_.ignore(1);
+                    state_stack_.pop_back();
+                    continue_ = handler.end_object(*this);
+                }
+                else
+                {
+                    state.mode = ubjson_parse_mode::indefinite_map_value;
+                    read_name(handler, ec);
+                    if (ec)
+                    {
+                        return;
+                    }
+                }
+                break;
+            }
+            case ubjson_parse_mode::indefinite_map_value:
+            {
+                state.mode = ubjson_parse_mode::indefinite_map_key;
+                read_item(handler, 0, ec);
+                if (ec)
+                {
+                    return;
+                }
+                break;
+            }
+            case ubjson_parse_mode::root:
+            {
+                state.mode = ubjson_parse_mode::before_done;
+                read_item(handler, 0, ec);
+                if (ec)
+                {
+                    return;
+                }
+                break;
+            }
+            case ubjson_parse_mode::before_done:
+            {
+                JSONCONS_ASSERT(state_stack_.size() == 1);
+                handler.flush();
+                done_ = true;
+                break;
+            }
+        }
+    }
+
+
+    // Reads a value of the given type, or reads the type first if it is 0
+    void read_item(json_content_handler& handler, uint8_t type, std::error_code& ec)
+    {
+        if (source_.is_error())
+        {
+            ec = ubjson_errc::source_error;
+            return;
+        }
+        if (type == 0 && source_.get(type) == 0)
+        {
+            ec = ubjson_errc::unexpected_eof;
+            return;
+        }
+        read_value(handler, type, ec);
+    }
+
+    static bool is_number_type(uint8_t type)
+    {
+        switch (type)
+        {
+            case ubjson_format::int8_type:
+            case ubjson_format::uint8_type:
+            case ubjson_format::int16_type:
+            case ubjson_format::int32_type:
+            case ubjson_format::int64_type:
+            case ubjson_format::float32_type:
+            case ubjson_format::float64_type:
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    void read_typed_array(json_content_handler& handler, uint8_t type, size_t length, std::error_code& ec)
+    {
+        switch (type)
+        {
+            case ubjson_format::int8_type:
+                read_typed_array<int8_t>(handler, length, int64_array_, ec);
+                break;
+            case ubjson_format::uint8_type:
+                read_typed_array<uint8_t>(handler, length, uint64_array_, ec);
+                break;
+            case ubjson_format::int16_type:
+                read_typed_array<int16_t>(handler, length, int64_array_, ec);
+                break;
+            case ubjson_format::int32_type:
+                read_typed_array<int32_t>(handler, length, int64_array_, ec);
+                break;
+            case ubjson_format::int64_type:
+                read_typed_array<int64_t>(handler, length, int64_array_, ec);
+                break;
+            case ubjson_format::float32_type:
+                read_typed_array<float>(handler, length, double_array_, ec);
+                break;
+            case ubjson_format::float64_type:
+                read_typed_array<double>(handler, length, double_array_, ec);
+                break;
+            default:
+                break;
+        }
+    }
+
+    // Reads length big endian values of type T into v a block at a time, so that a bogus
+    // length runs into the end of the source before it runs out of memory, then passes
+    // them to the handler in one typed_array call
+    template <class T, class Value>
+    void read_typed_array(json_content_handler& handler, size_t length, std::vector<Value>& v, std::error_code& ec)
+    {
+        const size_t block_length = 1024;
+        uint8_t buf[block_length*sizeof(T)];
+
+        v.clear();
+        while (length > 0)
+        {
+            size_t n = (std::min)(length, block_length);
+            if (source_.read(buf, n*sizeof(T)) != n*sizeof(T))
+            {
+                ec = ubjson_errc::unexpected_eof;
+                return;
+            }
+            const uint8_t* endp;
+            for (const uint8_t* p = buf; p < buf + n*sizeof(T); p += sizeof(T))
+            {
+                v.push_back(static_cast<Value>(jsoncons::detail::from_big_endian<T>(p,p+sizeof(T),&endp)));
+            }
+            length -= n;
+        }
+        continue_ = handler.typed_array(v.data(), v.size(), semantic_tag_type::none, *this);
+    }
+
+    void read_value(json_content_handler& handler, uint8_t type, std::error_code& ec)
+    {
+        switch (type)
+        {
+            case ubjson_format::null_type:
+            {
+                continue_ = handler.null_value(semantic_tag_type::none, *this);
+                break;
+            }
+            case ubjson_format::no_op_type:
+            {
+                break;
+            }
+            case ubjson_format::true_type:
+            {
+                continue_ = handler.bool_value(true, semantic_tag_type::none, *this);
+                break;
+            }
+            case ubjson_format::false_type:
+            {
+                continue_ = handler.bool_value(false, semantic_tag_type::none, *this);
+                break;
+            }
+            case ubjson_format::int8_type:
+            {
+                int8_t val = read_number<int8_t>(ec);
+                if (ec)
+                {
+                    return;
+                }
+                continue_ = handler.int64_value(val, semantic_tag_type::none, *this);
+                break;
+            }
+            case ubjson_format::uint8_type:
+            {
+                uint8_t val = read_number<uint8_t>(ec);
+                if (ec)
+                {
+                    return;
+                }
+                continue_ = handler.uint64_value(val, semantic_tag_type::none, *this);
+                break;
+            }
+            case ubjson_format::int16_type:
+            {
+                int16_t val = read_number<int16_t>(ec);
+                if (ec)
+                {
+                    return;
+                }
+                continue_ = handler.int64_value(val, semantic_tag_type::none, *this);
+                break;
+            }
+            case ubjson_format::int32_type:
+            {
+                int32_t val = read_number<int32_t>(ec);
+                if (ec)
+                {
+                    return;
+                }
+                continue_ = handler.int64_value(val, semantic_tag_type::none, *this);
+                break;
+            }
+            case ubjson_format::int64_type:
+            {
+                int64_t val = read_number<int64_t>(ec);
+                if (ec)
+                {
+                    return;
+                }
+                continue_ = handler.int64_value(val, semantic_tag_type::none, *this);
+                break;
+            }
+            case ubjson_format::float32_type:
+            {
+                float val = read_number<float>(ec);
+                if (ec)
+                {
+                    return;
+                }
+                continue_ = handler.double_value(val, semantic_tag_type::none, *this);
+                break;
+            }
+            case ubjson_format::float64_type:
+            {
+                double val = read_number<double>(ec);
+                if (ec)
+                {
+                    return;
+                }
+                continue_ = handler.double_value(val, semantic_tag_type::none, *this);
+                break;
+            }
+            case ubjson_format::char_type:
+            {
+                char c = read_number<char>(ec);
+                if (ec)
+                {
+                    return;
+                }
+                auto result = unicons::validate(&c,&c+1);
+                if (result.ec != unicons::conv_errc())
+                {
+                    ec = ubjson_errc::invalid_utf8_text_string;
+                    return;
+                }
+                continue_ = handler.string_value(basic_string_view<char>(&c,1), semantic_tag_type::none, *this);
+                break;
+            }
+            case ubjson_format::string_type:
+            {
+                read_string(ec);
+                if (ec)
+                {
+                    return;
+                }
+                continue_ = handler.string_value(basic_string_view<char>(buffer_.data(),buffer_.length()), semantic_tag_type::none, *this);
+                break;
+            }
+            case ubjson_format::high_precision_number_type:
+            {
+                size_t length = get_length(ec);
+                if (ec)
+                {
+                    return;
+                }
+                buffer_.clear();
+                if (source_.read(std::back_inserter(buffer_), length) != length)
+                {
+                    ec = ubjson_errc::unexpected_eof;
+                    return;
+                }
+                if (jsoncons::detail::is_integer(buffer_.data(),buffer_.length()))
+                {
+                    continue_ = handler.string_value(basic_string_view<char>(buffer_.data(),buffer_.length()), semantic_tag_type::big_integer, *this);
+                }
+                else
+                {
+                    continue_ = handler.string_value(basic_string_view<char>(buffer_.data(),buffer_.length()), semantic_tag_type::big_decimal, *this);
+                }
+                break;
+            }
+            case ubjson_format::start_array_marker:
+            {
+                int c = source_.peek();
+                if (c == Source::traits_type::eof())
+                {
+                    ec = ubjson_errc::unexpected_eof;
+                    return;
+                }
+                if (c == ubjson_format::type_marker)
+                {
+                    source_.ignore(1);
+                    uint8_t item_type{};
+                    if (source_.get(item_type) == 0)
+                    {
+                        ec = ubjson_errc::unexpected_eof;
+                        return;
+                    }
+                    c = source_.peek();
+                    if (c == Source::traits_type::eof())
+                    {
+                        ec = ubjson_errc::unexpected_eof;
+                        return;
+                    }
+                    if (c != ubjson_format::count_marker)
+                    {
+                        ec = ubjson_errc::count_required_after_type;
+                        return;
+                    }
+                    source_.ignore(1);
+                    size_t length = get_length(ec);
+                    if (ec)
+                    {
+                        return;
+                    }
+                    if (is_number_type(item_type))
+                    {
+                        read_typed_array(handler, item_type, length, ec);
+                    }
+                    else
+                    {
+                        state_stack_.emplace_back(ubjson_parse_mode::array,length,item_type);
+                        continue_ = handler.begin_array(length, semantic_tag_type::none, *this);
+                    }
+                }
+                else if (c == ubjson_format::count_marker)
+                {
+                    source_.ignore(1);
+                    size_t length = get_length(ec);
+                    if (ec)
+                    {
+                        return;
+                    }
+                    state_stack_.emplace_back(ubjson_parse_mode::array,length);
+                    continue_ = handler.begin_array(length, semantic_tag_type::none, *this);
+                }
+                else
+                {
+                    state_stack_.emplace_back(ubjson_parse_mode::indefinite_array,0);
+                    continue_ = handler.begin_array(semantic_tag_type::none, *this);
+                }
+                break;
+            }
+            case ubjson_format::start_object_marker:
+            {
+                int c = source_.peek();
+                if (c == Source::traits_type::eof())
+                {
+                    ec = ubjson_errc::unexpected_eof;
+                    return;
+                }
+                if (c == ubjson_format::type_marker)
+                {
+                    source_.ignore(1);
+                    uint8_t item_type{};
+                    if (source_.get(item_type) == 0)
+                    {
+                        ec = ubjson_errc::unexpected_eof;
+                        return;
+                    }
+                    c = source_.peek();
+                    if (c == Source::traits_type::eof())
+                    {
+                        ec = ubjson_errc::unexpected_eof;
+                        return;
+                    }
+                    if (c != ubjson_format::count_marker)
+                    {
+                        ec = ubjson_errc::count_required_after_type;
+                        return;
+                    }
+                    source_.ignore(1);
+                    size_t length = get_length(ec);
+                    if (ec)
+                    {
+                        return;
+                    }
+                    state_stack_.emplace_back(ubjson_parse_mode::map_key,length,item_type);
+                    continue_ = handler.begin_object(length, semantic_tag_type::none, *this);
+                }
+                else if (c == ubjson_format::count_marker)
+                {
+                    source_.ignore(1);
+                    size_t length = get_length(ec);
+                    if (ec)
+                    {
+                        return;
+                    }
+                    state_stack_.emplace_back(ubjson_parse_mode::map_key,length);
+                    continue_ = handler.begin_object(length, semantic_tag_type::none, *this);
+                }
+                else
+                {
+                    state_stack_.emplace_back(ubjson_parse_mode::indefinite_map_key,0);
+                    continue_ = handler.begin_object(semantic_tag_type::none, *this);
+                }
+                break;
+            }
+            default:
+            {
+                ec = ubjson_errc::unknown_type;
+                return;
+            }
+        }
+    }
+
+    template <class T>
+    T read_number(std::error_code& ec)
+    {
+        uint8_t buf[sizeof(T)];
+        if (source_.read(buf, sizeof(T)) != sizeof(T))
+        {
+            ec = ubjson_errc::unexpected_eof;
+            return T();
+        }
+        const uint8_t* endp;
+        return jsoncons::detail::from_big_endian<T>(buf,buf+sizeof(buf),&endp);
+    }
+
+    template <class T>
+    size_t read_length(std::error_code& ec)
+    {
+        T val = read_number<T>(ec);
+        if (ec)
+        {
+            return 0;
+        }
+        if (val < 0)
+        {
+            ec = ubjson_errc::length_cannot_be_negative;
+            return 0;
+        }
+        return static_cast<size_t>(val);
+    }
+
+    size_t get_length(std::error_code& ec)
+    {
+        uint8_t type{};
+        if (source_.get(type) == 0)
+        {
+            ec = ubjson_errc::unexpected_eof;
+            return 0;
+        }
+        switch (type)
+        {
+            case ubjson_format::int8_type:
+                return read_length<int8_t>(ec);
+            case ubjson_format::uint8_type:
+                return read_number<uint8_t>(ec);
+            case ubjson_format::int16_type:
+                return read_length<int16_t>(ec);
+            case ubjson_format::int32_type:
+                return read_length<int32_t>(ec);
+            case ubjson_format::int64_type:
+                return read_length<int64_t>(ec);
+            default:
+                ec = ubjson_errc::length_must_be_integer;
+                return 0;
+        }
+    }
+
+    bool peek_marker(uint8_t marker, std::error_code& ec)
+    {
+        int c = source_.peek();
+        if (c == Source::traits_type::eof())
+        {
+            ec = ubjson_errc::unexpected_eof;
+            return false;
+        }
+        return c == marker;
+    }
+
+    // Reads a length prefixed UTF-8 string into buffer_
+    void read_string(std::error_code& ec)
+    {
+        size_t length = get_length(ec);
+        if (ec)
+        {
+            return;
+        }
+        buffer_.clear();
+        if (source_.read(std::back_inserter(buffer_), length) != length)
+        {
+            ec = ubjson_errc::unexpected_eof;
+            return;
+        }
+        auto result = unicons::validate(buffer_.begin(),buffer_.end());
+        if (result.ec != unicons::conv_errc())
+        {
+            ec = ubjson_errc::invalid_utf8_text_string;
+            return;
+        }
+    }
+
+    void read_name(json_content_handler& handler, std::error_code& ec)
+    {
+        read_string(ec);
+        if (ec)
+        {
+            return;
+        }
+        continue_ = handler.name(basic_string_view<char>(buffer_.data(),buffer_.length()), *this);
+    }
+};
+
+}}
+
+#endif
@@ -10,6 +10,7 @@
 #include <string>
 #include <vector>
 #include <limits> // std::numeric_limits
+#include <algorithm> // std::min, std::max
 #include <memory>
 #include <utility> // std::move
 #include <jsoncons/json_exception.hpp>
@@ -416,6 +417,111 @@ private:
         return true;
     }
 
+    bool do_typed_array(const int64_t* data, size_t size, semantic_tag_type, const serializing_context&) override
+    {
+        int64_t lowest = 0;
+        int64_t highest = 0;
+        for (size_t i = 0; i < size; ++i)
+        {
+            lowest = (std::min)(lowest, data[i]);
+            highest = (std::max)(highest, data[i]);
+        }
+        // Smallest type that holds every element
+        if (highest <= (std::numeric_limits<uint8_t>::max)() && lowest >= 0)
+        {
+            put_typed_array<uint8_t>(ubjson_format::uint8_type, data, size);
+        }
+        else if (highest <= (std::numeric_limits<int8_t>::max)() && lowest >= (std::numeric_limits<int8_t>::lowest)())
+        {
+            put_typed_array<int8_t>(ubjson_format::int8_type, data, size);
+        }
+        else if (highest <= (std::numeric_limits<int16_t>::max)() && lowest >= (std::numeric_limits<int16_t>::lowest)())
+        {
+            put_typed_array<int16_t>(ubjson_format::int16_type, data, size);
+        }
+        else if (highest <= (std::numeric_limits<int32_t>::max)() && lowest >= (std::numeric_limits<int32_t>::lowest)())
+        {
+            put_typed_array<int32_t>(ubjson_format::int32_type, data, size);
+        }
+        else
+        {
+            put_typed_array<int64_t>(ubjson_format::int64_type, data, size);
+        }
+        end_value();
+        return true;
+    }
+
+    bool do_typed_array(const uint64_t* data, size_t size, semantic_tag_type tag, const serializing_context& context) override
+    {
+        uint64_t highest = 0;
+        for (size_t i = 0; i < size; ++i)
+        {
+            highest = (std::max)(highest, data[i]);
+        }
+        if (highest <= (std::numeric_limits<uint8_t>::max)())
+        {
+            put_typed_array<uint8_t>(ubjson_format::uint8_type, data, size);
+        }
+        else if (highest <= (uint64_t)(std::numeric_limits<int16_t>::max)())
+        {
+            put_typed_array<int16_t>(ubjson_format::int16_type, data, size);
+        }
+        else if (highest <= (uint64_t)(std::numeric_limits<int32_t>::max)())
+        {
+            put_typed_array<int32_t>(ubjson_format::int32_type, data, size);
+        }
+        else if (highest <= (uint64_t)(std::numeric_limits<int64_t>::max)())
+        {
+            put_typed_array<int64_t>(ubjson_format::int64_type, data, size);
+        }
+        else
+        {
+            do_begin_array(size, tag, context);
+            for (size_t i = 0; i < size; ++i)
+            {
+                do_uint64_value(data[i], semantic_tag_type::none, context);
+            }
+            do_end_array(context);
+            return true;
+        }
+        end_value();
+        return true;
+    }
+
+    bool do_typed_array(const double* data, size_t size, semantic_tag_type, const serializing_context&) override
+    {
+        bool is_float32 = true;
+        for (size_t i = 0; is_float32 && i < size; ++i)
+        {
+            is_float32 = (double)(float)data[i] == data[i];
+        }
+        if (is_float32)
+        {
+            put_typed_array<float>(ubjson_format::float32_type, data, size);
+        }
+        else
+        {
+            put_typed_array<double>(ubjson_format::float64_type, data, size);
+        }
+        end_value();
+        return true;
+    }
+
+    // Writes a strongly typed array, [$type#count followed by the elements as T
+    template <class T, class U>
+    void put_typed_array(uint8_t type, const U* data, size_t size)
+    {
+        result_.push_back(ubjson_format::start_array_marker);
+        result_.push_back(ubjson_format::type_marker);
+        result_.push_back(type);
+        result_.push_back(ubjson_format::count_marker);
+        put_length(size);
+        for (size_t i = 0; i < size; ++i)
+        {
+            jsoncons::detail::to_big_endian(static_cast<T>(data[i]),std::back_inserter(result_));
+        }
+    }
+
     void end_value()
     {
         if (!stack_.empty())
@@ -0,0 +1,115 @@
+// Copyright 2018 Daniel Parker
+// Distributed under Boost license
+
+#if defined(_MSC_VER)
+#include "windows.h" // test no inadvertant macro expansions
+#endif
+#include <jsoncons/json.hpp>
+#include <jsoncons_ext/bson/bson.hpp>
+#include <catch/catch.hpp>
+#include <sstream>
+#include <vector>
+#include <string>
+#include <utility>
+
+using namespace jsoncons;
+using namespace jsoncons::bson;
+
+namespace bson_pull_reader_tests {
+
+    struct order
+    {
+        std::string customer;
+        std::vector<int64_t> items;
+        bool shipped = false;
+    };
+}
+
+JSONCONS_MEMBER_TRAITS_DECL(bson_pull_reader_tests::order, customer, items, shipped)
+
+using namespace bson_pull_reader_tests;
+
+TEST_CASE("bson_pull_reader events test")
+{
+    json j = json::parse(R"({"a":[1,"two"],"b":{"c":true},"d":null})");
+    std::vector<uint8_t> v;
+    encode_bson(j, v);
+
+    bson_buffer_pull_reader reader(v);
+
+    REQUIRE_FALSE(reader.done());
+    CHECK(reader.current().event_type() == staj_event_type::begin_object);
+    reader.next();
+    CHECK(reader.current().as<std::string>() == "a");
+    reader.next();
+    CHECK(reader.current().event_type() == staj_event_type::begin_array);
+    reader.next();
+    CHECK(reader.current().event_type() == staj_event_type::int64_value);
+    CHECK(reader.current().as<int>() == 1);
+    reader.next();
+    CHECK(reader.current().as<std::string>() == "two");
+    reader.next();
+    CHECK(reader.current().event_type() == staj_event_type::end_array);
+    reader.next();
+    CHECK(reader.current().as<std::string>() == "b");
+    reader.next();
+    CHECK(reader.current().event_type() == staj_event_type::begin_object);
+    reader.next();
+    CHECK(reader.current().as<std::string>() == "c");
+    reader.next();
+    CHECK(reader.current().as<bool>());
+    reader.next();
+    CHECK(reader.current().event_type() == staj_event_type::end_object);
+    reader.next();
+    CHECK(reader.current().as<std::string>() == "d");
+    reader.next();
+    CHECK(reader.current().event_type() == staj_event_type::null_value);
+    reader.next();
+    CHECK(reader.current().event_type() == staj_event_type::end_object);
+    reader.next();
+    CHECK(reader.done());
+}
+
+TEST_CASE("bson_pull_reader decode_bson test")
+{
+    json j = json::parse(R"({"customer":"Acme","items":[10,20,30],"shipped":true,"notes":{"x":[1]}})");
+    std::vector<uint8_t> v;
+    encode_bson(j, v);
+
+    order o = decode_bson<order>(v);
+    CHECK(o.customer == "Acme");
+    CHECK(o.items == std::vector<int64_t>({10,20,30}));
+    CHECK(o.shipped);
+
+    std::string s(v.begin(),v.end());
+    std::istringstream is(s);
+    bson_pull_reader reader(is);
+    reader.next();
+    reader.next();
+    reader.next();
+    CHECK(reader.current().as<std::string>() == "items");
+    reader.next();
+    staj_array_iterator<int> it(reader);
+    int sum = 0;
+    for (auto val : it)
+    {
+        sum += val;
+    }
+    CHECK(sum == 60);
+}
+
+TEST_CASE("bson_pull_reader error test")
+{
+    std::vector<uint8_t> v = {0x0c,0x00,0x00,0x00, // document size
+                              0x10,'a',0x00, // int32 field "a"
+                              0x01,0x00}; // truncated value
+
+    std::error_code ec;
+    bson_buffer_pull_reader reader(v, ec);
+    REQUIRE_FALSE(ec);
+    reader.next(ec);
+    REQUIRE_FALSE(ec);
+    CHECK(reader.current().as<std::string>() == "a");
+    reader.next(ec);
+    CHECK(ec == bson_errc::unexpected_eof);
+}
@@ -39,3 +39,35 @@ TEST_CASE("bson hello world")
                       },json::parse("{\"hello\":\"world\"}"));
 }
 
+
+TEST_CASE("bson partial input test")
+{
+    json j;
+    j["name"] = "String too long for small string optimization";
+    j["values"] = json::parse("[1,-5000000000,2.5,true,null]");
+    j["nested"] = json::parse(R"({"a":[[],{}],"b":"x"})");
+
+    std::vector<uint8_t> v;
+    encode_bson(j, v);
+
+    for (size_t chunk_length = 1; chunk_length <= v.size(); ++chunk_length)
+    {
+        json_decoder<json> decoder;
+        basic_bson_parser<partial_buffer_source> parser{partial_buffer_source()};
+
+        std::error_code ec;
+        for (size_t pos = 0; pos < v.size(); pos += chunk_length)
+        {
+            parser.update(v.data() + pos, (std::min)(chunk_length, v.size() - pos));
+            parser.parse_some(decoder, ec);
+            REQUIRE_FALSE(ec);
+        }
+        // the decoder stops after the end of the root item
+        REQUIRE(parser.stopped());
+        parser.restart();
+        parser.parse_some(decoder, ec);
+        REQUIRE_FALSE(ec);
+        REQUIRE(parser.done());
+        CHECK(decoder.get_result() == j);
+    }
+}
@@ -0,0 +1,160 @@
+// Copyright 2018 Daniel Parker
+// Distributed under Boost license
+
+#if defined(_MSC_VER)
+#include "windows.h" // test no inadvertant macro expansions
+#endif
+#include <jsoncons/json.hpp>
+#include <jsoncons_ext/cbor/cbor.hpp>
+#include <catch/catch.hpp>
+#include <sstream>
+#include <vector>
+#include <string>
+#include <map>
+#include <utility>
+
+using namespace jsoncons;
+using namespace jsoncons::cbor;
+
+namespace cbor_pull_reader_tests {
+
+    struct reading
+    {
+        std::string sensor;
+        std::vector<double> values;
+        bool calibrated = false;
+    };
+}
+
+JSONCONS_MEMBER_TRAITS_DECL(cbor_pull_reader_tests::reading, sensor, values, calibrated)
+
+using namespace cbor_pull_reader_tests;
+
+TEST_CASE("cbor_pull_reader events test")
+{
+    json j = json::parse(R"({"a":[1,-2,"three",null,false,2.5],"b":{}})");
+    std::vector<uint8_t> v;
+    encode_cbor(j, v);
+
+    cbor_buffer_pull_reader reader(v);
+
+    REQUIRE_FALSE(reader.done());
+    CHECK(reader.current().event_type() == staj_event_type::begin_object);
+    reader.next();
+    CHECK(reader.current().as<std::string>() == "a");
+    reader.next();
+    CHECK(reader.current().event_type() == staj_event_type::begin_array);
+    reader.next();
+    CHECK(reader.current().event_type() == staj_event_type::uint64_value);
+    CHECK(reader.current().as<int>() == 1);
+    reader.next();
+    CHECK(reader.current().event_type() == staj_event_type::int64_value);
+    CHECK(reader.current().as<int>() == -2);
+    reader.next();
+    CHECK(reader.current().as<std::string>() == "three");
+    reader.next();
+    CHECK(reader.current().event_type() == staj_event_type::null_value);
+    reader.next();
+    CHECK(reader.current().event_type() == staj_event_type::bool_value);
+    CHECK_FALSE(reader.current().as<bool>());
+    reader.next();
+    CHECK(reader.current().as<double>() == 2.5);
+    reader.next();
+    CHECK(reader.current().event_type() == staj_event_type::end_array);
+    reader.next();
+    CHECK(reader.current().as<std::string>() == "b");
+    reader.next();
+    CHECK(reader.current().event_type() == staj_event_type::begin_object);
+    reader.next();
+    CHECK(reader.current().event_type() == staj_event_type::end_object);
+    reader.next();
+    CHECK(reader.current().event_type() == staj_event_type::end_object);
+    reader.next();
+    CHECK(reader.done());
+}
+
+TEST_CASE("cbor_pull_reader indefinite length test")
+{
+    // {_ "a": [_ 1, "x"], "b": h'0102'}
+    std::vector<uint8_t> v = {0xbf,0x61,'a',0x9f,0x01,0x61,'x',0xff,0x61,'b',0x42,0x01,0x02,0xff};
+
+    cbor_buffer_pull_reader reader(v);
+
+    CHECK(reader.current().event_type() == staj_event_type::begin_object);
+    reader.next();
+    CHECK(reader.current().as<std::string>() == "a");
+    reader.next();
+    CHECK(reader.current().event_type() == staj_event_type::begin_array);
+    reader.next();
+    CHECK(reader.current().as<int>() == 1);
+    reader.next();
+    CHECK(reader.current().as<std::string>() == "x");
+    reader.next();
+    CHECK(reader.current().event_type() == staj_event_type::end_array);
+    reader.next();
+    CHECK(reader.current().as<std::string>() == "b");
+    reader.next();
+    REQUIRE(reader.current().event_type() == staj_event_type::byte_string_value);
+    CHECK(reader.current().as<byte_string>() == byte_string({0x01,0x02}));
+    reader.next();
+    CHECK(reader.current().event_type() == staj_event_type::end_object);
+    reader.next();
+    CHECK(reader.done());
+
+    json j = decode_cbor<json>(v);
+    CHECK(j["a"] == json::parse(R"([1,"x"])"));
+}
+
+TEST_CASE("cbor_pull_reader tags test")
+{
+    // [0("2018-10-19T00:00:00Z"), 1(1539907200), 2(h'010000000000000000')]
+    std::vector<uint8_t> v = {0x83,
+                              0xc0,0x74,'2','0','1','8','-','1','0','-','1','9','T','0','0',':','0','0',':','0','0','Z',
+                              0xc1,0x1a,0x5b,0xc9,0x1e,0x80,
+                              0xc2,0x49,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00};
+
+    cbor_buffer_pull_reader reader(v);
+    reader.next();
+    CHECK(reader.current().event_type() == staj_event_type::string_value);
+    CHECK(reader.current().semantic_tag() == semantic_tag_type::date_time);
+    reader.next();
+    CHECK(reader.current().semantic_tag() == semantic_tag_type::timestamp);
+    CHECK(reader.current().as<uint64_t>() == 1539907200);
+    reader.next();
+    CHECK(reader.current().semantic_tag() == semantic_tag_type::big_integer);
+    CHECK(reader.current().as<std::string>() == "18446744073709551616");
+    reader.next();
+    CHECK(reader.current().event_type() == staj_event_type::end_array);
+}
+
+TEST_CASE("cbor_pull_reader decode_cbor test")
+{
+    std::map<std::string,reading> m;
+    m["north"].sensor = "N1";
+    m["north"].values = {1.5,2.5};
+    m["north"].calibrated = true;
+    m["south"].sensor = "S7";
+
+    json j(m);
+    std::vector<uint8_t> v;
+    encode_cbor(j, v);
+
+    std::map<std::string,reading> m2 = decode_cbor<std::map<std::string,reading>>(v);
+    REQUIRE(m2.size() == 2);
+    CHECK(m2["north"].sensor == "N1");
+    CHECK(m2["north"].values == std::vector<double>({1.5,2.5}));
+    CHECK(m2["north"].calibrated);
+    CHECK(m2["south"].values.empty());
+
+    std::string s(v.begin(),v.end());
+    std::istringstream is(s);
+    cbor_pull_reader reader(is);
+    staj_object_iterator<reading> it(reader);
+    size_t count = 0;
+    for (const auto& kv : it)
+    {
+        CHECK(kv.second.sensor.size() == 2);
+        ++count;
+    }
+    CHECK(count == 2);
+}
@@ -458,3 +458,53 @@ TEST_CASE("Compare CBOR packed item and jsoncons item")
     }
 }
 
+
+TEST_CASE("cbor partial input test")
+{
+    // {_ "a": [_ 1, "x"], 1: 1(1539907200), "c": 2(h'010000000000000000'), "d": -1000000}
+    std::vector<uint8_t> v = {0xbf,0x61,'a',0x9f,0x01,0x61,'x',0xff,
+                              0x01,0xc1,0x1a,0x5b,0xc9,0x1e,0x80,
+                              0x61,'c',0xc2,0x49,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+                              0x61,'d',0x3a,0x00,0x0f,0x42,0x3f,
+                              0xff};
+    json expected = decode_cbor<json>(v);
+    REQUIRE(expected["1"].as<uint64_t>() == 1539907200);
+
+    for (size_t chunk_length = 1; chunk_length <= v.size(); ++chunk_length)
+    {
+        json_decoder<json> decoder;
+        basic_cbor_parser<partial_buffer_source> parser{partial_buffer_source()};
+
+        std::error_code ec;
+        for (size_t pos = 0; pos < v.size(); pos += chunk_length)
+        {
+            parser.update(v.data() + pos, (std::min)(chunk_length, v.size() - pos));
+            parser.parse_some(decoder, ec);
+            REQUIRE_FALSE(ec);
+        }
+        // the decoder stops after the end of the root item
+        REQUIRE(parser.stopped());
+        parser.restart();
+        parser.parse_some(decoder, ec);
+        REQUIRE_FALSE(ec);
+        REQUIRE(parser.done());
+        CHECK(decoder.get_result() == expected);
+    }
+}
+
+TEST_CASE("cbor partial input error test")
+{
+    std::vector<uint8_t> v = {0x82,0x01,0xf8}; // unsupported simple value
+
+    json_decoder<json> decoder;
+    basic_cbor_parser<partial_buffer_source> parser{partial_buffer_source()};
+
+    std::error_code ec;
+    parser.update(v.data(), 2);
+    parser.parse_some(decoder, ec);
+    REQUIRE_FALSE(ec);
+    CHECK(parser.source_exhausted());
+    parser.update(v.data() + 2, 1);
+    parser.parse_some(decoder, ec);
+    CHECK(ec == cbor_errc::unknown_type);
+}
@@ -118,6 +118,40 @@ TEST_CASE("jsonpointer_test")
     //std::cout << pretty_print(j3) << std::endl;
 }
 
+TEST_CASE("jsonpointer address set test")
+{
+    json j = json::parse(R"(
+    {
+       "application": "hiking",
+       "reputons": [
+       {
+           "rater": "HikingAsylum.example.com",
+           "assertion": "is-good",
+           "rated": "sk",
+           "rating": 0.90
+         }
+       ]
+    }
+    )");
+
+    std::vector<uint8_t> buffer;
+    encode_cbor(j, buffer);
+
+    jsonpointer::address_set locations{"/reputons/0/rated", "/reputons/0/rating", "/reputons/1/rated", "/application"};
+
+    std::vector<std::error_code> ec;
+    std::vector<cbor_view> values = jsonpointer::get(cbor_view(buffer), locations, ec);
+
+    REQUIRE(values.size() == 4);
+    CHECK_FALSE(ec[0]);
+    CHECK(values[0].as_string() == std::string("sk"));
+    CHECK_FALSE(ec[1]);
+    CHECK(values[1].as_double() == 0.90);
+    CHECK(ec[2] == jsonpointer::jsonpointer_errc::index_exceeds_array_size);
+    CHECK_FALSE(ec[3]);
+    CHECK(values[3].as_string() == std::string("hiking"));
+}
+
 TEST_CASE("as_string_test")
 {
     std::vector<uint8_t> b;
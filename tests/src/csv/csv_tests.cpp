@@ -1159,3 +1159,514 @@ EUR_LIBOR_06M,2015-10-27,0.0000001
 
 }
 
+
+TEST_CASE("csv long fields test")
+{
+    // Fields longer than a scanning block, with quotes, escapes, line breaks in quotes and comments
+    std::string long_text(70, 'a');
+    std::string input = "h1,h2,h3\n"
+                        "#" + long_text + "\r\n"
+                        + long_text + ",\"" + long_text + "\"\"b,\r\n" + long_text + "\",  " + long_text + "  \n"
+                        "x,\"" + long_text + "\",y";
+
+    csv_options options;
+    options.assume_header(true)
+           .comment_starter('#')
+           .trim(true);
+
+    SECTION("from string")
+    {
+        ojson j = decode_csv<ojson>(input,options);
+        REQUIRE(j.size() == 2);
+        CHECK(j[0]["h1"].as<std::string>() == long_text);
+        CHECK(j[0]["h2"].as<std::string>() == long_text + "\"b,\r\n" + long_text);
+        CHECK(j[0]["h3"].as<std::string>() == long_text);
+        CHECK(j[1]["h2"].as<std::string>() == long_text);
+        CHECK(j[1]["h3"].as<std::string>() == "y");
+    }
+
+    SECTION("in chunks")
+    {
+        ojson expected = decode_csv<ojson>(input,options);
+        for (size_t chunk_size = 1; chunk_size < 40; chunk_size += 7)
+        {
+            json_decoder<ojson> decoder;
+            csv_parser parser(decoder, options);
+            parser.reset();
+            size_t pos = 0;
+            while (!parser.stopped())
+            {
+                if (parser.source_exhausted())
+                {
+                    size_t n = (std::min)(chunk_size, input.size() - pos);
+                    parser.update(input.data() + pos, n);
+                    pos += n;
+                }
+                parser.parse_some();
+            }
+            CHECK(decoder.get_result() == expected);
+            CHECK(parser.line_number() == 5);
+        }
+    }
+}
+
+TEST_CASE("csv comment after crlf test")
+{
+    csv_options options;
+    options.comment_starter('#');
+    json j = decode_csv<json>(std::string("a,b\r\n#c,d\r\ne,f\r\n"), options);
+    CHECK(j == json::parse(R"([["a","b"],["e","f"]])"));
+
+    csv_options options2;
+    options2.ignore_empty_lines(false);
+    json j2 = decode_csv<json>(std::string("a,b\r\nc,d\r\n"), options2);
+    CHECK(j2 == json::parse(R"([["a","b"],["c","d"]])"));
+}
+
+TEST_CASE("csv parallel reader test")
+{
+    // Quoted commas, escaped quotes and line breaks, CRLF, a blank line, and no newline at the end
+    std::string input = "id,text,amount\n"
+                        "0,plain text,1.5\n"
+                        "1,\"quoted, with \"\"quotes\"\"\nand a line break\",2\r\n"
+                        "2,\"\n\n\",-3\n"
+                        "\n"
+                        "3,,true\r\n"
+                        "4,\"a,\"\"b\"\",\r\nc\",\n"
+                        "5,last,7";
+
+    SECTION("n_objects")
+    {
+        csv_options options;
+        options.assume_header(true);
+
+        ojson expected = decode_csv<ojson>(input, options);
+        REQUIRE(expected.size() == 6);
+        CHECK(expected[1]["text"].as<std::string>() == "quoted, with \"quotes\"\nand a line break");
+        CHECK(expected[2]["text"].as<std::string>() == "\n\n");
+        CHECK(expected[4]["text"].as<std::string>() == "a,\"b\",\r\nc");
+        CHECK(expected[5]["amount"].as<int>() == 7);
+
+        // Every thread count moves the nominal splits to other places in the text
+        for (size_t threads = 2; threads <= 16; ++threads)
+        {
+            parallel_policy policy = parallel_policy().max_threads(threads).min_chunk_size(1);
+            ojson j = decode_csv<ojson>(input, options, policy);
+            CHECK(j == expected);
+
+            json_decoder<ojson> decoder;
+            csv_parallel_reader reader(input, decoder, options, policy);
+            reader.read();
+            CHECK(decoder.get_result() == expected);
+        }
+    }
+
+    SECTION("n_rows")
+    {
+        csv_options options;
+        options.header_lines(2)
+               .mapping(mapping_type::n_rows);
+
+        ojson expected = decode_csv<ojson>(input, options);
+        for (size_t threads = 2; threads <= 16; ++threads)
+        {
+            parallel_policy policy = parallel_policy().max_threads(threads).min_chunk_size(1);
+            ojson j = decode_csv<ojson>(input, options, policy);
+            CHECK(j == expected);
+        }
+    }
+
+    SECTION("quotes that are escaped")
+    {
+        // Splits found by counting quotes land inside quoted fields, 
+        // the records after them are read serially
+        std::string input2 = "a,b\n"
+                             "\"x\\\",\n0\",y\n"
+                             "\"x\\\",\n1\",y\n"
+                             "\"x\\\",\n2\",y\n"
+                             "\"x\\\",\n3\",y\n";
+        csv_options options;
+        options.assume_header(true)
+               .quote_escape_char('\\');
+
+        ojson expected = decode_csv<ojson>(input2, options);
+        REQUIRE(expected.size() == 4);
+        CHECK(expected[0]["a"].as<std::string>() == "x\",\n0");
+        for (size_t threads = 2; threads <= 16; ++threads)
+        {
+            parallel_policy policy = parallel_policy().max_threads(threads).min_chunk_size(1);
+            ojson j = decode_csv<ojson>(input2, options, policy);
+            CHECK(j == expected);
+        }
+    }
+
+    SECTION("m_columns")
+    {
+        csv_options options;
+        options.assume_header(true)
+               .mapping(mapping_type::m_columns);
+
+        ojson expected = decode_csv<ojson>(input, options);
+        ojson j = decode_csv<ojson>(input, options, parallel_policy().max_threads(2).min_chunk_size(1));
+        CHECK(j == expected);
+    }
+
+    SECTION("error")
+    {
+        std::string input2 = input + "\n6,\"unterminated";
+        csv_options options;
+        options.assume_header(true);
+
+        std::error_code ec2;
+        json_decoder<ojson> decoder2;
+        csv_string_reader reader2(input2, decoder2, options);
+        reader2.read(ec2);
+        ojson expected = decoder2.get_result();
+
+        for (size_t threads = 2; threads <= 16; ++threads)
+        {
+            parallel_policy policy = parallel_policy().max_threads(threads).min_chunk_size(1);
+            std::error_code ec;
+            json_decoder<ojson> decoder;
+            csv_parallel_reader reader(input2, decoder, options, policy);
+            reader.read(ec);
+            CHECK(ec == ec2);
+            if (!ec2)
+            {
+                CHECK(decoder.get_result() == expected);
+            }
+        }
+    }
+}
+
+TEST_CASE("csv table test")
+{
+    std::string input = R"(name,id,price,active,tags
+"apple",1,1.5,true,red;green
+pear,,2.25,0,yellow
+plum,3,bad,FALSE
+kiwi,4,0.5,1,brown,extra
+)";
+
+    csv_options options;
+    options.assume_header(true)
+           .subfield_delimiter(';')
+           .column_types("string,integer,float,boolean");
+
+    SECTION("typed columns")
+    {
+        csv_table table = decode_csv_table<csv_table>(input, options);
+
+        REQUIRE(table.row_count() == 4);
+        REQUIRE(table.column_count() == 6);
+
+        const csv_column& name = table[0];
+        CHECK(name.name() == std::string("name"));
+        CHECK(name.type() == csv_column_type::string_t);
+        CHECK(name.string_value(0) == string_view("apple"));
+        CHECK(name.string_value(3) == string_view("kiwi"));
+        CHECK(name.null_count() == 0);
+
+        const csv_column& id = table[1];
+        CHECK(id.type() == csv_column_type::integer_t);
+        CHECK(id.integer_value(0) == 1);
+        CHECK(id.is_null(1));
+        CHECK(id.integer_value(2) == 3);
+        CHECK(id.null_count() == 1);
+
+        const csv_column& price = table[2];
+        CHECK(price.type() == csv_column_type::float_t);
+        CHECK(price.float_value(1) == 2.25);
+        CHECK(price.is_null(2));
+
+        const csv_column& active = table[3];
+        CHECK(active.type() == csv_column_type::boolean_t);
+        CHECK(active.boolean_value(0));
+        CHECK_FALSE(active.boolean_value(1));
+        CHECK_FALSE(active.is_null(2));
+        CHECK(active.boolean_value(3));
+
+        // Multi-valued fields are null
+        const csv_column* tags = table.find(string_view("tags"));
+        REQUIRE(tags != nullptr);
+        CHECK(tags->is_null(0));
+        CHECK(tags->string_value(1) == string_view("yellow"));
+        CHECK(tags->is_null(2));
+
+        // A column past the header has no name
+        CHECK(table[5].name().empty());
+        CHECK(table[5].string_value(3) == string_view("extra"));
+        CHECK(table[5].null_count() == 3);
+
+        CHECK(table.find(string_view("missing")) == nullptr);
+    }
+
+    SECTION("matches m_columns")
+    {
+        csv_options options2 = options;
+        options2.subfield_delimiter(0);
+
+        csv_options options3 = options2;
+        options3.mapping(mapping_type::m_columns);
+        ojson j = decode_csv<ojson>(input, options3);
+
+        csv_table table = decode_csv_table<csv_table>(input, options2);
+        const csv_column* id = table.find(string_view("id"));
+        REQUIRE(id != nullptr);
+        REQUIRE(j["id"].size() == 4);
+        for (size_t i = 0; i < 4; ++i)
+        {
+            CHECK(id->is_null(i) == j["id"][i].is_null());
+            if (!id->is_null(i))
+            {
+                CHECK(id->integer_value(i) == j["id"][i].as<int64_t>());
+            }
+        }
+    }
+
+    SECTION("column defaults")
+    {
+        csv_options options2 = options;
+        options2.column_defaults("\"?\",0,0.0");
+
+        csv_table table = decode_csv_table<csv_table>(input, options2);
+        CHECK(table[1].integer_value(1) == 0);
+        CHECK_FALSE(table[1].is_null(1));
+        CHECK(table[2].float_value(2) == 0.0);
+        CHECK_FALSE(table[2].is_null(2));
+    }
+
+    SECTION("stream")
+    {
+        std::istringstream is(input);
+        csv_table table = decode_csv_table<csv_table>(is, options);
+        CHECK(table.row_count() == 4);
+    }
+
+    SECTION("number forms")
+    {
+        std::string input2 = "id,price\n-12,-0.5\n+7,1e2\n9223372036854775808,.5\n0012,123456789012345678901234\n";
+        csv_options options2;
+        options2.assume_header(true)
+                .column_types("integer,float");
+
+        csv_table table = decode_csv_table<csv_table>(input2, options2);
+        REQUIRE(table.row_count() == 4);
+        CHECK(table[0].integer_value(0) == -12);
+        CHECK(table[0].integer_value(1) == 7);
+        CHECK(table[0].is_null(2));
+        CHECK(table[0].integer_value(3) == 12);
+        CHECK(table[1].float_value(0) == -0.5);
+        CHECK(table[1].float_value(1) == 100.0);
+        CHECK(table[1].float_value(2) == 0.5);
+        CHECK(table[1].float_value(3) == 123456789012345678901234.0);
+    }
+}
+
+TEST_CASE("csv selected columns test")
+{
+    std::string input = R"(a,b,c,d
+1,"x,y",true,2.5
+3,z,false,4.5
+
+5,,true,
+)";
+
+    SECTION("n_objects by name")
+    {
+        csv_options options;
+        options.assume_header(true)
+               .selected_columns("d,a");
+
+        ojson j = decode_csv<ojson>(input, options);
+        ojson expected = ojson::parse(R"([{"a":1,"d":2.5},{"a":3,"d":4.5},{"a":5,"d":""}])");
+        CHECK(j == expected);
+    }
+
+    SECTION("n_rows by index")
+    {
+        csv_options options;
+        options.assume_header(true)
+               .mapping(mapping_type::n_rows)
+               .subfield_delimiter(';')
+               .selected_column_indexes({1,2});
+
+        ojson j = decode_csv<ojson>(input, options);
+        ojson expected = ojson::parse(R"([["b","c"],["x,y",true],["z",false],["",true]])");
+        CHECK(j == expected);
+    }
+
+    SECTION("m_columns")
+    {
+        csv_options options;
+        options.assume_header(true)
+               .mapping(mapping_type::m_columns)
+               .selected_columns("b")
+               .selected_column_indexes({3});
+
+        ojson j = decode_csv<ojson>(input, options);
+        ojson expected = ojson::parse(R"({"b":["x,y","z",""],"d":[2.5,4.5,""]})");
+        CHECK(j == expected);
+    }
+
+    SECTION("table")
+    {
+        csv_options options;
+        options.assume_header(true)
+               .column_types("integer,string,boolean,float")
+               .selected_columns("c,a");
+
+        csv_table table = decode_csv_table<csv_table>(input, options);
+        REQUIRE(table.column_count() == 2);
+        CHECK(table.row_count() == 3);
+        CHECK(table[0].name() == std::string("a"));
+        CHECK(table[0].integer_value(2) == 5);
+        CHECK(table[1].name() == std::string("c"));
+        CHECK_FALSE(table[1].boolean_value(1));
+    }
+
+    SECTION("first column skipped")
+    {
+        std::string input2 = "a,b\nx,1\n\ny,2\n";
+        csv_options options;
+        options.assume_header(true)
+               .ignore_empty_lines(false)
+               .selected_columns("b");
+
+        ojson j = decode_csv<ojson>(input2, options);
+        ojson expected = ojson::parse(R"([{"b":1},{},{"b":2}])");
+        CHECK(j == expected);
+    }
+
+    SECTION("parallel")
+    {
+        std::string big = "a,b,c,d\n";
+        for (int i = 0; i < 2000; ++i)
+        {
+            big += std::to_string(i) + ",\"q,\"\"" + std::to_string(i) + "\",true," + std::to_string(i) + ".5\n";
+        }
+        csv_options options;
+        options.assume_header(true)
+               .selected_columns("b,d");
+        parallel_policy policy;
+        policy.max_threads(4).min_chunk_size(1024);
+
+        ojson expected = decode_csv<ojson>(big, options);
+        ojson j = decode_csv<ojson>(big, options, policy);
+        CHECK(j == expected);
+        REQUIRE(j.size() == 2000);
+        CHECK(j[7]["b"].as<std::string>() == std::string("q,\"7"));
+        CHECK_FALSE(j[7].contains("a"));
+    }
+}
+
+TEST_CASE("csv type_inference_rows test")
+{
+    std::string input = R"(id,price,name,misc
+1,2.5,apple,1
+2,3,pear,x
+,null,plum,
+3,4,12,2.5
+-4,1e2,kiwi,y
+abc,x,,true
+007,-0.5,fig,3
+18446744073709551616,.5,lime,
+)";
+
+    csv_options options;
+    options.assume_header(true)
+           .mapping(mapping_type::n_rows)
+           .type_inference_rows(3);
+
+    ojson j = decode_csv<ojson>(input, options);
+
+    ojson expected = ojson::parse(R"(
+[
+    ["id","price","name","misc"],
+    [1,2.5,"apple",1],
+    [2,3,"pear","x"],
+    ["",null,"plum",""],
+    [3,4,12,2.5],
+    [-4,100.0,"kiwi","y"],
+    ["abc","x","",true],
+    ["007",-0.5,"fig",3],
+    ["18446744073709551616",".5","lime",""]
+]
+    )");
+    CHECK(j == expected);
+    CHECK(j[4][1].is_uint64());
+    CHECK(j[5][1].is_double());
+    CHECK(j[2][1].is_uint64());
+    CHECK(j[8][0].semantic_tag() == semantic_tag_type::big_integer);
+
+    SECTION("matches infer_types for uniform columns")
+    {
+        std::string input2 = "a,b,c\n";
+        for (int i = 0; i < 200; ++i)
+        {
+            input2 += std::to_string(i - 100) + "," + std::to_string(i) + ".25e-1,s" + std::to_string(i) + "\n";
+        }
+        csv_options options2;
+        options2.assume_header(true);
+        ojson expected2 = decode_csv<ojson>(input2, options2);
+        options2.type_inference_rows(10);
+        ojson j2 = decode_csv<ojson>(input2, options2);
+        CHECK(j2 == expected2);
+    }
+
+    SECTION("values after the sampled rows")
+    {
+        csv_options options2;
+        options2.assume_header(true)
+                .type_inference_rows(2);
+        ojson j2 = decode_csv<ojson>(std::string("a,b\n1.5,x\n2,y\n3,true\n4,null\n5,7"), options2);
+
+        ojson expected2 = ojson::parse(R"(
+[
+    {"a":1.5,"b":"x"},
+    {"a":2,"b":"y"},
+    {"a":3,"b":true},
+    {"a":4,"b":null},
+    {"a":5,"b":7}
+]
+        )");
+        CHECK(j2 == expected2);
+        for (size_t i = 1; i < j2.size(); ++i)
+        {
+            CHECK(j2[i]["a"].is_uint64());
+        }
+        CHECK(j2[2]["b"].is_bool());
+        CHECK(j2[3]["b"].is_null());
+        CHECK(j2[4]["b"].is_uint64());
+    }
+}
+
+TEST_CASE("csv serializer object rows test")
+{
+    SECTION("members out of order, missing and unknown")
+    {
+        ojson j = ojson::parse(R"(
+[
+    {"a":1,"b":"x","c":true},
+    {"c":false,"a":2},
+    {"b":"y,z","d":4,"a":null},
+    {"a":{"nested":1},"b":-3,"c":2.5}
+]
+        )");
+
+        std::string s;
+        encode_csv(j, s);
+        CHECK(s == "a,b,c\n1,x,true\n2,,false\nnull,\"y,z\",\n,-3,2.5\n");
+    }
+
+    SECTION("column_names")
+    {
+        ojson j = ojson::parse(R"([{"a":1,"b":2,"c":3},{"c":6,"b":5,"a":4}])");
+
+        csv_options options;
+        options.column_names("c,a");
+        std::string s;
+        encode_csv(j, s, options);
+        CHECK(s == "c,a\n3,1\n6,4\n");
+    }
+}
@@ -40,6 +40,18 @@ TEST_CASE("convert_vector_test")
     }
 }
 
+TEST_CASE("convert_nested_vector_test")
+{
+    std::vector<std::vector<int>> v = {{1,2},{},{3}};
+
+    std::string s;
+    jsoncons::encode_json(v,s);
+
+    auto result = jsoncons::decode_json<std::vector<std::vector<int>>>(s);
+
+    CHECK(v == result);
+}
+
 TEST_CASE("convert_map_test")
 {
     std::map<std::string,double> m = {{"a",1},{"b",2}};
@@ -95,3 +107,48 @@ TEST_CASE("convert_tuple_test")
 
 
 
+
+TEST_CASE("convert typed array test")
+{
+    SECTION("vector of double into json_decoder")
+    {
+        std::vector<double> v = {1.5,2.5,3.5};
+        json_decoder<json> decoder;
+        jsoncons::encode_json(v, decoder);
+        json j = decoder.get_result();
+        REQUIRE(j.is_array());
+        REQUIRE(j.size() == 3);
+        CHECK(j[1].as<double>() == 2.5);
+        CHECK(j.as<std::vector<double>>() == v);
+    }
+    SECTION("vector of int16_t")
+    {
+        std::vector<int16_t> v = {-1,0,1000};
+        std::string s;
+        jsoncons::encode_json(v,s);
+        CHECK(s == "[-1,0,1000]");
+        CHECK(jsoncons::decode_json<std::vector<int16_t>>(s) == v);
+    }
+    SECTION("std::array of uint32_t")
+    {
+        std::array<uint32_t,3> v{{7,8,9}};
+        std::string s;
+        jsoncons::encode_json(v,s);
+        CHECK(s == "[7,8,9]");
+        auto result = jsoncons::decode_json<std::array<uint32_t,3>>(s);
+        CHECK(result == v);
+    }
+    SECTION("typed arrays nested in an object")
+    {
+        json_decoder<json> decoder;
+        std::vector<int64_t> a = {1,2};
+        std::vector<uint64_t> b;
+        decoder.begin_object();
+        decoder.name("a");
+        decoder.typed_array(a.data(), a.size());
+        decoder.name("b");
+        decoder.typed_array(b.data(), b.size());
+        decoder.end_object();
+        CHECK(decoder.get_result() == json::parse(R"({"a":[1,2],"b":[]})"));
+    }
+}
@@ -0,0 +1,150 @@
+// Copyright 2013 Daniel Parker
+// Distributed under Boost license
+
+#include <jsoncons/json.hpp>
+#include <jsoncons/json_event_tape.hpp>
+#include <jsoncons/json_lines_serializer.hpp>
+#include <jsoncons/json_reader.hpp>
+#include <jsoncons_ext/cbor/cbor.hpp>
+#include <catch/catch.hpp>
+#include <sstream>
+#include <vector>
+#include <string>
+#include <memory>
+#include <cstdint>
+
+using namespace jsoncons;
+
+namespace {
+
+    json make_document()
+    {
+        json j = json::parse(R"(
+        {
+            "name" : "tape",
+            "flags" : [true, false, null],
+            "numbers" : [-1, 18446744073709551615, 2.5],
+            "big" : "-18446744073709551617",
+            "nested" : {"empty" : {}, "list" : [[], [{}]]}
+        }
+        )");
+        j["bytes"] = json(byte_string({'H','e','l','l','o'}), semantic_tag_type::base64);
+        j["big"] = json(j["big"].as<std::string>(), semantic_tag_type::big_integer);
+
+        std::string ints = "[";
+        std::string doubles = "[";
+        for (int i = 0; i < 20; ++i)
+        {
+            ints += (i > 0 ? "," : "") + std::to_string(-i - 1);
+            doubles += (i > 0 ? "," : "") + std::to_string(i) + ".25";
+        }
+        j["ints"] = json::parse(ints + "]", json_options().typed_arrays(true));
+        j["doubles"] = json::parse(doubles + "]", json_options().typed_arrays(true));
+        return j;
+    }
+}
+
+TEST_CASE("json event tape test")
+{
+    json j = make_document();
+    REQUIRE(j["ints"].is_typed_array());
+    REQUIRE(j["doubles"].is_typed_array());
+
+    json_event_tape tape;
+    j.dump(tape);
+    CHECK_FALSE(tape.empty());
+
+    SECTION("decoder")
+    {
+        json_decoder<json> decoder(json_options().typed_arrays(true));
+        tape.replay(decoder);
+        REQUIRE(decoder.is_valid());
+        json result = decoder.get_result();
+        CHECK(result == j);
+        CHECK(result["ints"].is_typed_array());
+        CHECK(result["bytes"].as_byte_string() == j["bytes"].as_byte_string());
+    }
+
+    SECTION("serializers")
+    {
+        std::vector<uint8_t> expected_cbor;
+        cbor::encode_cbor(j, expected_cbor);
+        std::string expected_text = j.to_string();
+
+        std::vector<uint8_t> cbor_bytes;
+        cbor::cbor_buffer_serializer cbor_serializer(cbor_bytes);
+        std::string text;
+        json_compressed_string_serializer text_serializer(text);
+
+        tape.replay({&cbor_serializer, &text_serializer});
+        CHECK(cbor_bytes == expected_cbor);
+        CHECK(text == expected_text);
+    }
+
+    SECTION("reader")
+    {
+        std::string s = j.to_string();
+        std::istringstream is(s);
+        json_event_tape tape2;
+        json_reader reader(is, tape2);
+        reader.read();
+
+        json_decoder<json> decoder;
+        tape2.replay(decoder);
+        CHECK(decoder.get_result() == json::parse(s));
+    }
+
+    SECTION("values")
+    {
+        json_event_tape tape2;
+        j.dump(tape2);
+        json(json::array{1, "two"}).dump(tape2);
+
+        std::ostringstream os;
+        {
+            json_lines_serializer serializer(os);
+            tape2.replay(serializer);
+        }
+        CHECK(os.str() == j.to_string() + "\n[1,\"two\"]\n");
+    }
+
+    SECTION("clear")
+    {
+        tape.clear();
+        CHECK(tape.size() == 0);
+        json(json::array{1, "two"}).dump(tape);
+
+        json_decoder<json> decoder;
+        tape.replay(decoder);
+        CHECK(decoder.get_result() == json::array{1, "two"});
+    }
+}
+
+TEST_CASE("json event tape concurrent replay test")
+{
+    json j = make_document();
+    json_event_tape tape;
+    j.dump(tape);
+
+    std::vector<std::unique_ptr<json_decoder<json>>> decoders;
+    std::vector<std::string> texts(8);
+    std::vector<std::unique_ptr<json_compressed_string_serializer>> serializers;
+    std::vector<json_content_handler*> handlers;
+    for (size_t i = 0; i < 8; ++i)
+    {
+        decoders.emplace_back(new json_decoder<json>());
+        serializers.emplace_back(new json_compressed_string_serializer(texts[i]));
+        handlers.push_back(decoders.back().get());
+        handlers.push_back(serializers.back().get());
+    }
+
+    parallel_policy policy;
+    policy.max_threads(4);
+    tape.replay(handlers, policy);
+
+    for (size_t i = 0; i < 8; ++i)
+    {
+        CHECK(decoders[i]->get_result() == j);
+        CHECK(texts[i] == j.to_string());
+    }
+}
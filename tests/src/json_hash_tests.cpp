@@ -0,0 +1,76 @@
+// Copyright 2013 Daniel Parker
+// Distributed under Boost license
+
+#include <jsoncons/json.hpp>
+#include <catch/catch.hpp>
+#include <unordered_map>
+#include <unordered_set>
+#include <functional>
+
+using namespace jsoncons;
+using namespace jsoncons::literals;
+
+TEST_CASE("json hash")
+{
+    std::hash<json> hasher;
+
+    SECTION("equal values")
+    {
+        CHECK(hasher(json(10)) == hasher(json(10U)));
+        CHECK(hasher(json(10)) == hasher(json(10.0)));
+        CHECK(hasher(json(0.0)) == hasher(json(-0.0)));
+        CHECK(hasher(json(std::string(100,'a'))) == hasher(json(std::string(100,'a'))));
+        CHECK(hasher(json::object()) == hasher(json::parse("{}")));
+        CHECK(hasher(json::parse(R"({"a":1,"b":[1,2.5,"x"]})")) == hasher(json::parse(R"({"b":[1,2.5,"x"],"a":1.0})")));
+    }
+
+    SECTION("unequal values")
+    {
+        CHECK(hasher(json(1)) != hasher(json(2)));
+        CHECK(hasher(json(true)) != hasher(json(false)));
+        CHECK(hasher(json::null()) != hasher(json(false)));
+        CHECK(hasher(json("1")) != hasher(json(1)));
+        CHECK(hasher(json::array()) != hasher(json::object()));
+        CHECK(hasher(json::parse("[1,2]")) != hasher(json::parse("[2,1]")));
+        CHECK(hasher(json::parse(R"({"a":1,"b":2})")) != hasher(json::parse(R"({"a":2,"b":1})")));
+    }
+
+    SECTION("ojson member order")
+    {
+        ojson a = ojson::parse(R"({"a":1,"b":2})");
+        ojson b = ojson::parse(R"({"b":2,"a":1})");
+        REQUIRE(a == b);
+        CHECK(std::hash<ojson>()(a) == std::hash<ojson>()(b));
+    }
+
+    SECTION("unordered_map key")
+    {
+        std::unordered_map<json,int> m;
+        m[json::parse(R"({"x":[1,2]})")] = 1;
+        m[json::parse(R"([1,2])")] = 2;
+        CHECK(m.at(json::parse(R"({"x":[1,2.0]})")) == 1);
+        CHECK(m.at(json::parse(R"([1,2])")) == 2);
+        CHECK(m.count(json::parse(R"([2,1])")) == 0);
+    }
+}
+
+TEST_CASE("json_hash_cache")
+{
+    json doc = json::parse(R"(
+        {"a": [1, 2, {"b": "c"}], "d": {"e": null}}
+    )");
+    json_hash_cache<json> cache(doc);
+
+    CHECK(cache.hash(doc) == std::hash<json>()(doc));
+    CHECK(cache.hash(doc["a"]) == std::hash<json>()(doc["a"]));
+    CHECK(cache.hash(doc["a"][2]) == std::hash<json>()(doc["a"][2]));
+
+    json other = json::parse(R"(
+        {"d": {"e": null}, "a": [1, 2, {"b": "x"}]}
+    )");
+    json_hash_cache<json> other_cache(other);
+
+    CHECK(cache.equal(doc["d"], other_cache, other["d"]));
+    CHECK_FALSE(cache.equal(doc["a"], other_cache, other["a"]));
+    CHECK_FALSE(cache.equal(doc, other_cache, other));
+}
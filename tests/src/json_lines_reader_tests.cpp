@@ -0,0 +1,219 @@
+// Copyright 2013 Daniel Parker
+// Distributed under Boost license
+
+#include <jsoncons/json.hpp>
+#include <jsoncons/json_lines_reader.hpp>
+#include <catch/catch.hpp>
+#include <sstream>
+#include <vector>
+#include <string>
+#include <mutex>
+#include <algorithm>
+#include <utility>
+
+using namespace jsoncons;
+
+std::vector<json> parse_lines_one_by_one(const std::string& input)
+{
+    std::vector<json> values;
+    std::istringstream is(input);
+    std::string line;
+    while (std::getline(is, line))
+    {
+        if (line.find_first_not_of(" \t\r") != std::string::npos)
+        {
+            values.push_back(json::parse(line));
+        }
+    }
+    return values;
+}
+
+TEST_CASE("json lines reader test")
+{
+    // Escaped quotes and newlines, brackets inside strings, CRLF, blank and 
+    // whitespace only lines, and no newline at the end
+    std::string input = "{\"id\":0,\"text\":\"a\\nb\"}\n"
+                        "  [1,1.5,true,null]\r\n"
+                        "\n"
+                        "\r\n"
+                        "\"brackets [ { in a string\"\n"
+                        "{\"quote\":\"say \\\"hi\\\"\\n\",\"list\":[\"]\",{\"}\":1}]}\n"
+                        "2\n"
+                        "\t\n"
+                        "-3.5e2";
+    std::vector<json> expected = parse_lines_one_by_one(input);
+    REQUIRE(expected.size() == 6);
+    CHECK(expected[3]["list"][1]["}"].as<int>() == 1);
+
+    SECTION("in order")
+    {
+        // Each thread count moves the splits to other places in the text
+        for (size_t threads = 2; threads <= 12; ++threads)
+        {
+            parallel_policy policy = parallel_policy().max_threads(threads).min_chunk_size(1);
+            std::vector<json> values;
+            std::vector<size_t> lines;
+            json_lines_reader reader(input, policy);
+            reader.read<json>([&](size_t line, json&& value)
+            {
+                lines.push_back(line);
+                values.push_back(std::move(value));
+            });
+            CHECK(values == expected);
+            CHECK(lines == std::vector<size_t>{1, 2, 5, 6, 7, 9});
+
+            CHECK(decode_json_lines<json>(input, policy) == expected);
+        }
+    }
+
+    SECTION("stream")
+    {
+        for (size_t threads = 2; threads <= 12; ++threads)
+        {
+            parallel_policy policy = parallel_policy().max_threads(threads).min_chunk_size(1);
+            std::istringstream is(input);
+            CHECK(decode_json_lines<json>(is, policy) == expected);
+        }
+    }
+
+    SECTION("unordered")
+    {
+        for (size_t threads = 2; threads <= 12; ++threads)
+        {
+            parallel_policy policy = parallel_policy().max_threads(threads).min_chunk_size(1);
+            std::mutex mutex;
+            std::vector<std::pair<size_t,json>> values;
+            json_lines_reader reader(input, policy);
+            reader.read_unordered<json>([&](size_t line, json&& value)
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                values.emplace_back(line, std::move(value));
+            });
+            std::sort(values.begin(), values.end(), 
+                      [](const std::pair<size_t,json>& a, const std::pair<size_t,json>& b){return a.first < b.first;});
+            REQUIRE(values.size() == expected.size());
+            for (size_t i = 0; i < values.size(); ++i)
+            {
+                CHECK(values[i].second == expected[i]);
+            }
+        }
+    }
+
+    SECTION("handler per worker")
+    {
+        std::vector<json_decoder<json>> decoders(3);
+        std::vector<json_content_handler*> handlers;
+        for (auto& decoder : decoders)
+        {
+            handlers.push_back(&decoder);
+        }
+        json_lines_reader reader(input, parallel_policy().max_threads(3).min_chunk_size(1));
+        reader.read_unordered(handlers);
+        // Each decoder holds the last line of its last chunk
+        CHECK(decoders.back().get_result() == expected.back());
+    }
+
+    SECTION("serial")
+    {
+        parallel_policy serial;
+        serial.max_threads(1);
+        CHECK(decode_json_lines<json>(input, serial) == expected);
+    }
+}
+
+TEST_CASE("json lines reader batches test")
+{
+    // Two workers take the text 512K at a time, so this is several batches. From a stream, 
+    // the partial line at the end of each batch is carried over to the next, and a line 
+    // longer than a batch takes more than one read.
+    std::string lines = "{\"text\":\"a\\nb\"}\r\n"
+                        "\n"
+                        "[1,\"]\",-2.5]\n";
+    std::string input;
+    while (input.length() < 1024*1024)
+    {
+        input += lines;
+    }
+    input += "\"" + std::string(700*1024, 'x') + "\"\n";
+    input += lines + "3";
+    std::vector<json> expected = parse_lines_one_by_one(input);
+    size_t last_line = static_cast<size_t>(std::count(input.begin(), input.end(), '\n')) + 1;
+
+    parallel_policy policy;
+    policy.max_threads(2);
+
+    SECTION("string")
+    {
+        CHECK(decode_json_lines<json>(input, policy) == expected);
+    }
+
+    SECTION("stream")
+    {
+        std::vector<json> values;
+        std::vector<size_t> lines_read;
+        std::istringstream is(input);
+        json_lines_reader reader(is, policy);
+        reader.read<json>([&](size_t line, json&& value)
+        {
+            lines_read.push_back(line);
+            values.push_back(std::move(value));
+        });
+        CHECK(values == expected);
+        REQUIRE(lines_read.size() == expected.size());
+        CHECK(lines_read.back() == last_line);
+        CHECK(values[values.size() - 4].as<std::string>().length() == 700*1024);
+    }
+}
+
+TEST_CASE("json lines reader error test")
+{
+    std::string input = "1\n"
+                        "[\"a,\"]\r\n"
+                        "\n"
+                        "{\"id\":3,}\n"
+                        "4\n";
+
+    SECTION("throws")
+    {
+        for (size_t threads = 2; threads <= 12; ++threads)
+        {
+            parallel_policy policy = parallel_policy().max_threads(threads).min_chunk_size(1);
+            size_t count = 0;
+            json_lines_reader reader(input, policy);
+            try
+            {
+                reader.read<json>([&](size_t, json&&){++count;});
+                CHECK(false);
+            }
+            catch (const serialization_error& e)
+            {
+                CHECK(e.code() == json_errc::extra_comma);
+                CHECK(e.line_number() == 4);
+                CHECK(e.column_number() == 9);
+            }
+            // The lines before the error are read
+            CHECK(count == 2);
+        }
+    }
+
+    SECTION("error code")
+    {
+        for (size_t threads = 2; threads <= 12; ++threads)
+        {
+            parallel_policy policy = parallel_policy().max_threads(threads).min_chunk_size(1);
+            std::error_code ec;
+            json_lines_reader reader(input, policy);
+            reader.read<json>([](size_t, json&&){}, ec);
+            CHECK(ec == json_errc::extra_comma);
+        }
+    }
+
+    SECTION("extra characters")
+    {
+        std::error_code ec;
+        std::string input2 = "1\n2 3\n";
+        json_lines_reader reader(input2, parallel_policy().max_threads(2).min_chunk_size(1));
+        reader.read<json>([](size_t, json&&){}, ec);
+        CHECK(ec == json_errc::extra_character);
+    }
+}
@@ -0,0 +1,115 @@
+// Copyright 2013 Daniel Parker
+// Distributed under Boost license
+
+#include <jsoncons/json.hpp>
+#include <jsoncons/json_lines_serializer.hpp>
+#include <jsoncons/json_lines_reader.hpp>
+#include <catch/catch.hpp>
+#include <sstream>
+#include <vector>
+#include <string>
+#include <algorithm>
+
+using namespace jsoncons;
+
+std::string to_json_lines(const std::vector<json>& values)
+{
+    std::string s;
+    for (const auto& value : values)
+    {
+        s += value.to_string();
+        s += '\n';
+    }
+    return s;
+}
+
+TEST_CASE("json lines serializer test")
+{
+    // Strings with quotes, newlines, CR and brackets must stay on one line each
+    std::vector<json> values = {
+        json::parse(R"({"id":0,"text":"a\nb","items":[1,2.5,null]})"),
+        json::parse(R"(["say \"hi\"","]",{"}":"\r\n"}])"),
+        json::parse("{}"),
+        json::parse("[]"),
+        json(""),
+        json("line\nbreak"),
+        json(-3),
+        json(18446744073709551615ull),
+        json(1.5),
+        json(true),
+        json::null()
+    };
+    std::string expected = to_json_lines(values);
+    CHECK(std::count(expected.begin(), expected.end(), '\n') == 11);
+
+    SECTION("write")
+    {
+        std::ostringstream os;
+        {
+            json_lines_serializer serializer(os);
+            for (const auto& value : values)
+            {
+                serializer.write(value);
+            }
+        }
+        CHECK(os.str() == expected);
+    }
+
+    SECTION("events")
+    {
+        std::ostringstream os;
+        json_lines_serializer serializer(os);
+        for (const auto& value : values)
+        {
+            value.dump(serializer);
+        }
+        // Nothing is written before a batch fills up
+        CHECK(os.str().empty());
+        serializer.flush_buffer();
+        CHECK(os.str() == expected);
+    }
+
+    SECTION("batches")
+    {
+        std::ostringstream os;
+        json_lines_serializer serializer(os, json_options(), 40);
+        serializer.write(values[0]);
+        serializer.write(values[1]);
+        // The first line fills a batch, the second is still buffered
+        CHECK(os.str() == to_json_lines({values[0]}));
+        serializer.flush_buffer();
+        CHECK(os.str() == to_json_lines({values[0], values[1]}));
+    }
+
+    SECTION("parallel")
+    {
+        // Every thread count and chunk size splits the values at other places
+        for (size_t threads = 2; threads <= 6; ++threads)
+        {
+            for (size_t chunk_size = 1; chunk_size <= 3; ++chunk_size)
+            {
+                parallel_policy policy;
+                policy.max_threads(threads)
+                      .min_chunk_size(chunk_size);
+
+                std::ostringstream os;
+                {
+                    json_lines_serializer serializer(os);
+                    serializer.write(values[0]);
+                    serializer.write(values.begin() + 1, values.end(), policy);
+                }
+                CHECK(os.str() == expected);
+            }
+        }
+    }
+
+    SECTION("round trip")
+    {
+        std::ostringstream os;
+        {
+            json_lines_serializer serializer(os);
+            serializer.write(values.begin(), values.end(), parallel_policy().max_threads(4).min_chunk_size(1));
+        }
+        CHECK(decode_json_lines<json>(os.str()) == values);
+    }
+}
@@ -0,0 +1,307 @@
+// Copyright 2013 Daniel Parker
+// Distributed under Boost license
+
+#include <jsoncons/json.hpp>
+#include <catch/catch.hpp>
+#include <sstream>
+#include <vector>
+#include <map>
+#include <string>
+#include <cstdint>
+
+using namespace jsoncons;
+
+namespace member_traits_tests {
+
+    struct address
+    {
+        std::string street;
+        std::string city;
+        uint32_t zip = 0;
+    };
+
+    struct employee
+    {
+        std::string name;
+        int64_t id = 0;
+        double salary = 0.0;
+        bool active = false;
+        address home;
+        std::vector<address> previous;
+        std::map<std::string,int> skills;
+        std::vector<std::vector<int>> grid;
+    };
+
+    struct wide_address
+    {
+        std::wstring street;
+        int zip = 0;
+    };
+
+    struct wide_record
+    {
+        int field_00 = 0;
+        int field_01 = 0;
+        int field_02 = 0;
+        int field_03 = 0;
+        int field_04 = 0;
+        int field_05 = 0;
+        int field_06 = 0;
+        int field_07 = 0;
+        int field_08 = 0;
+        int field_09 = 0;
+        int field_10 = 0;
+        int field_11 = 0;
+        int field_12 = 0;
+        int field_13 = 0;
+        int field_14 = 0;
+        int field_15 = 0;
+        int field_16 = 0;
+        int field_17 = 0;
+        int field_18 = 0;
+        int field_19 = 0;
+        int field_20 = 0;
+        int field_21 = 0;
+        int field_22 = 0;
+        int field_23 = 0;
+        int field_24 = 0;
+        int field_25 = 0;
+        int field_26 = 0;
+        int field_27 = 0;
+        int field_28 = 0;
+        int field_29 = 0;
+        int field_30 = 0;
+        int field_31 = 0;
+        int field_32 = 0;
+        int field_33 = 0;
+        int field_34 = 0;
+        int field_35 = 0;
+        int field_36 = 0;
+        int field_37 = 0;
+        int field_38 = 0;
+        int field_39 = 0;
+        int field_40 = 0;
+        int field_41 = 0;
+        int field_42 = 0;
+        int field_43 = 0;
+        int field_44 = 0;
+        int field_45 = 0;
+        int field_46 = 0;
+        int field_47 = 0;
+        int field_48 = 0;
+        int field_49 = 0;
+        int field_50 = 0;
+        int field_51 = 0;
+        int field_52 = 0;
+        int field_53 = 0;
+        int field_54 = 0;
+        int field_55 = 0;
+        int field_56 = 0;
+        int field_57 = 0;
+        int field_58 = 0;
+        int field_59 = 0;
+    };
+
+#if defined(JSONCONS_HAS_OPTIONAL)
+    struct account
+    {
+        std::string owner;
+        std::optional<double> limit;
+        std::optional<address> mailing;
+    };
+#endif
+}
+
+JSONCONS_MEMBER_TRAITS_DECL(member_traits_tests::address, street, city, zip)
+JSONCONS_MEMBER_TRAITS_DECL(member_traits_tests::employee, name, id, salary, active, home, previous, skills, grid)
+JSONCONS_MEMBER_TRAITS_DECL(member_traits_tests::wide_address, street, zip)
+JSONCONS_MEMBER_TRAITS_DECL(member_traits_tests::wide_record, 
+    field_00, field_01, field_02, field_03, field_04, field_05, field_06, field_07, field_08, field_09,
+    field_10, field_11, field_12, field_13, field_14, field_15, field_16, field_17, field_18, field_19,
+    field_20, field_21, field_22, field_23, field_24, field_25, field_26, field_27, field_28, field_29,
+    field_30, field_31, field_32, field_33, field_34, field_35, field_36, field_37, field_38, field_39,
+    field_40, field_41, field_42, field_43, field_44, field_45, field_46, field_47, field_48, field_49,
+    field_50, field_51, field_52, field_53, field_54, field_55, field_56, field_57, field_58, field_59)
+#if defined(JSONCONS_HAS_OPTIONAL)
+JSONCONS_MEMBER_TRAITS_DECL(member_traits_tests::account, owner, limit, mailing)
+#endif
+
+using namespace member_traits_tests;
+
+TEST_CASE("member traits decode")
+{
+    std::string s = R"(
+    {
+        "id" : 42,
+        "name" : "Jane",
+        "unknown" : {"a" : [1,{"b":[]}], "c" : null},
+        "salary" : 1000.5,
+        "active" : true,
+        "home" : {"street" : "1 Main St", "city" : "Toronto", "zip" : 12345},
+        "previous" : [{"street" : "2 Side St", "city" : "Ottawa"}, {"city" : "Montreal", "zip" : 7}],
+        "skills" : {"c++" : 5, "python" : 3},
+        "grid" : [[1,2],[],[3]]
+    }
+    )";
+
+    employee e = decode_json<employee>(s);
+
+    CHECK(e.name == "Jane");
+    CHECK(e.id == 42);
+    CHECK(e.salary == 1000.5);
+    CHECK(e.active);
+    CHECK(e.home.street == "1 Main St");
+    CHECK(e.home.city == "Toronto");
+    CHECK(e.home.zip == 12345);
+    REQUIRE(e.previous.size() == 2);
+    CHECK(e.previous[0].city == "Ottawa");
+    CHECK(e.previous[0].zip == 0);
+    CHECK(e.previous[1].city == "Montreal");
+    CHECK(e.previous[1].zip == 7);
+    REQUIRE(e.skills.size() == 2);
+    CHECK(e.skills["c++"] == 5);
+    REQUIRE(e.grid.size() == 3);
+    CHECK(e.grid[0] == std::vector<int>({1,2}));
+    CHECK(e.grid[1].empty());
+    CHECK(e.grid[2] == std::vector<int>({3}));
+}
+
+TEST_CASE("member traits round trip")
+{
+    employee e;
+    e.name = "John";
+    e.id = -7;
+    e.salary = 2.5;
+    e.active = true;
+    e.home.street = "3 Elm St";
+    e.home.city = "Halifax";
+    e.home.zip = 99;
+    e.previous.push_back(e.home);
+    e.skills["go"] = 2;
+    e.grid = {{1},{2,3}};
+
+    std::string s;
+    encode_json(e, s);
+
+    SECTION("encoded text")
+    {
+        json j = json::parse(s);
+        CHECK(j["name"].as<std::string>() == "John");
+        CHECK(j["home"]["zip"].as<int>() == 99);
+        CHECK(j["previous"].size() == 1);
+        CHECK(j["grid"][1][1].as<int>() == 3);
+    }
+    SECTION("decode")
+    {
+        employee e2 = decode_json<employee>(s);
+        CHECK(e2.name == e.name);
+        CHECK(e2.id == e.id);
+        CHECK(e2.salary == e.salary);
+        CHECK(e2.home.city == e.home.city);
+        REQUIRE(e2.previous.size() == 1);
+        CHECK(e2.previous[0].street == e.home.street);
+        CHECK(e2.skills == e.skills);
+        CHECK(e2.grid == e.grid);
+    }
+    SECTION("json interop")
+    {
+        json j(e);
+        CHECK(j.is<employee>());
+        CHECK(j["home"]["city"].as<std::string>() == "Halifax");
+
+        employee e2 = j.as<employee>();
+        CHECK(e2.name == e.name);
+        CHECK(e2.home.zip == e.home.zip);
+        CHECK(e2.grid == e.grid);
+    }
+}
+
+TEST_CASE("member traits wide characters")
+{
+    std::wstring s = L"{\"street\":\"1 Main St\",\"zip\":10}";
+    wide_address a = decode_json<wide_address>(s);
+    CHECK(a.street == L"1 Main St");
+    CHECK(a.zip == 10);
+
+    std::wstring s2;
+    encode_json(a, s2);
+    CHECK(s2 == s);
+}
+
+TEST_CASE("member traits many members")
+{
+    typedef member_traits<wide_record> traits_type;
+
+    CHECK(traits_type::size() == 60);
+    CHECK(traits_type::find("field_00", 8) == 0);
+    CHECK(traits_type::find("field_37", 8) == 37);
+    CHECK(traits_type::find("field_59", 8) == 59);
+    CHECK(traits_type::find("field_60", 8) == 60);
+    CHECK(traits_type::find("field_3", 7) == 60);
+    CHECK(traits_type::find(L"field_42", 8) == 42);
+
+    std::string s = R"({"field_59":59,"field_00":1,"field_31":31,"other":[1,2],"field_7":7})";
+    wide_record r = decode_json<wide_record>(s);
+    CHECK(r.field_59 == 59);
+    CHECK(r.field_00 == 1);
+    CHECK(r.field_31 == 31);
+    CHECK(r.field_07 == 0);
+
+    json j = json::parse(s);
+    wide_record r2 = j.as<wide_record>();
+    CHECK(r2.field_59 == 59);
+    CHECK(r2.field_31 == 31);
+}
+
+TEST_CASE("member traits not an object")
+{
+    SECTION("decode_json")
+    {
+        std::string s = R"([1,2])";
+        REQUIRE_THROWS_AS(decode_json<address>(s), serialization_error);
+    }
+
+    SECTION("error code")
+    {
+        std::string s = R"([1,2])";
+        json_pull_reader reader(s);
+        address val;
+        std::error_code ec;
+        decode_stream(reader, val, ec);
+        CHECK(ec == conversion_errc::expected_object);
+    }
+
+    SECTION("array iterator")
+    {
+        std::string s = R"([{"street":"Main","city":"Toronto","zip":1},2])";
+        json_pull_reader reader(s);
+        std::error_code ec;
+        staj_array_iterator<address> it(reader, ec);
+        REQUIRE_FALSE(ec);
+        CHECK(it->street == "Main");
+        it.increment(ec);
+        CHECK(ec == conversion_errc::expected_object);
+    }
+}
+
+#if defined(JSONCONS_HAS_OPTIONAL)
+TEST_CASE("member traits optional members")
+{
+    std::string s = R"({"owner":"Jane","limit":null})";
+    account a = decode_json<account>(s);
+    CHECK(a.owner == "Jane");
+    CHECK_FALSE(a.limit.has_value());
+    CHECK_FALSE(a.mailing.has_value());
+
+    a.mailing = address{"1 Main St", "Toronto", 1};
+    std::string s2;
+    encode_json(a, s2);
+    json j = json::parse(s2);
+    CHECK_FALSE(j.contains("limit"));
+    CHECK(j["mailing"]["city"].as<std::string>() == "Toronto");
+
+    account a2 = decode_json<account>(s2);
+    REQUIRE(a2.mailing.has_value());
+    CHECK(a2.mailing->zip == 1);
+}
+#endif
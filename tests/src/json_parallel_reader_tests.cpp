@@ -0,0 +1,133 @@
+// Copyright 2013 Daniel Parker
+// Distributed under Boost license
+
+#include <jsoncons/json.hpp>
+#include <jsoncons/json_parallel_reader.hpp>
+#include <catch/catch.hpp>
+#include <sstream>
+#include <vector>
+#include <string>
+
+using namespace jsoncons;
+
+TEST_CASE("json parallel reader test")
+{
+    // Brackets, commas and escaped quotes and backslashes inside strings, CRLF, a blank 
+    // line and empty containers, so that the splits have to skip what looks like structure
+    std::string input = "\r\n[{\"id\":0,\"text\":\"[a, {b}]\",\"items\":[1,[2,3],{}]},\r\n"
+                        " \"quote \\\", comma, ] and backslash \\\\\",\n"
+                        "\n"
+                        " 2.5,\n"
+                        " [\"\\\\\",\"\\\\\\\"]\",null,true],\n"
+                        " \"}],[{\",\n"
+                        " {},[],\"\",\n"
+                        " {\"text\":\"\\\"[\"},\n"
+                        " -4e2]\n";
+    json expected = json::parse(input);
+    REQUIRE(expected.size() == 10);
+    CHECK(expected[4].as<std::string>() == "}],[{");
+
+    SECTION("read")
+    {
+        // Each thread count moves the splits to other places in the text
+        for (size_t threads = 2; threads <= 16; ++threads)
+        {
+            json_parallel_reader reader(input, parallel_policy().max_threads(threads).min_chunk_size(1));
+            json j = reader.read<json>();
+            CHECK(j == expected);
+        }
+    }
+
+    SECTION("read_elements")
+    {
+        for (size_t threads = 2; threads <= 16; ++threads)
+        {
+            std::vector<json> elements;
+            json_parallel_reader reader(input, parallel_policy().max_threads(threads).min_chunk_size(1));
+            reader.read_elements<json>([&](size_t index, json&& element)
+            {
+                CHECK(index == elements.size());
+                elements.push_back(std::move(element));
+            });
+            REQUIRE(elements.size() == expected.size());
+            for (size_t i = 0; i < elements.size(); ++i)
+            {
+                CHECK(elements[i] == expected[i]);
+            }
+        }
+    }
+
+    SECTION("numbers")
+    {
+        std::string input2 = "[0,-1,2.5e3,18446744073709551615,-9223372036854775808,1e400,0.1]";
+        for (size_t threads = 2; threads <= 16; ++threads)
+        {
+            json_parallel_reader reader(input2, parallel_policy().max_threads(threads).min_chunk_size(1));
+            CHECK(reader.read<json>() == json::parse(input2));
+        }
+    }
+
+    SECTION("comments")
+    {
+        std::string input2 = "[\"/*\",\n1, /* \" ] */ 2,\n// ,[\n3]";
+        json expected2 = json::parse(input2);
+        for (size_t threads = 2; threads <= 16; ++threads)
+        {
+            json_parallel_reader reader(input2, parallel_policy().max_threads(threads).min_chunk_size(1));
+            CHECK(reader.read<json>() == expected2);
+        }
+    }
+
+    SECTION("not an array")
+    {
+        std::string input2 = "{\"a\":" + input + "}";
+        json_parallel_reader reader(input2, parallel_policy().max_threads(4).min_chunk_size(1));
+        CHECK(reader.read<json>() == json::parse(input2));
+        REQUIRE_THROWS(reader.read_elements<json>([](size_t, json&&){}));
+    }
+
+    SECTION("errors")
+    {
+        size_t comma = input.find(",\n", input.size() / 2);
+        size_t quote = input.find("\"text\"", input.size() / 2);
+
+        std::vector<std::string> inputs = {input + "[]",
+                                           input.substr(0, input.size() / 2),
+                                           "[" + input + ",]",
+                                           std::string(input).insert(comma, ","),
+                                           std::string(input).erase(quote + 5, 1)};
+        for (const auto& text : inputs)
+        {
+            std::error_code ec;
+            size_t line = 0;
+            size_t column = 0;
+            try
+            {
+                json::parse(text);
+            }
+            catch (const serialization_error& e)
+            {
+                ec = e.code();
+                line = e.line_number();
+                column = e.column_number();
+            }
+            REQUIRE(ec);
+
+            for (size_t threads = 2; threads <= 16; ++threads)
+            {
+                json_parallel_reader reader(text, parallel_policy().max_threads(threads).min_chunk_size(1));
+                try
+                {
+                    reader.read<json>();
+                    CHECK(false);
+                }
+                catch (const serialization_error& e)
+                {
+                    CHECK(e.code() == ec);
+                    CHECK(e.line_number() == line);
+                    CHECK(e.column_number() == column);
+                }
+            }
+        }
+    }
+}
@@ -336,3 +336,132 @@ TEST_CASE("json_pull_reader object_value test")
 
 
 
+TEST_CASE("json_pull_reader skip test")
+{
+    std::string s = R"(
+        {
+            "skipped" : {"a" : [1, 2.5, -3e10, "x]}\"\\"], /* ] */ "b" : {"c" : [[], {}]}, // }
+                         "d" : "]"},
+            "kept" : [true, null],
+            "last" : 7
+        }
+    )";
+
+    SECTION("from a string")
+    {
+        json_pull_reader reader(s);
+
+        REQUIRE(reader.current().event_type() == staj_event_type::begin_object);
+        reader.next();
+        REQUIRE(reader.current().event_type() == staj_event_type::name);
+        CHECK(reader.current().as<std::string>() == "skipped");
+        reader.next();
+        REQUIRE(reader.current().event_type() == staj_event_type::begin_object);
+        reader.skip();
+        CHECK(reader.current().event_type() == staj_event_type::end_object);
+        reader.next();
+        REQUIRE(reader.current().event_type() == staj_event_type::name);
+        CHECK(reader.current().as<std::string>() == "kept");
+        reader.next();
+        REQUIRE(reader.current().event_type() == staj_event_type::begin_array);
+        reader.next();
+        CHECK(reader.current().event_type() == staj_event_type::bool_value);
+        reader.skip(); // not a container
+        CHECK(reader.current().event_type() == staj_event_type::bool_value);
+        reader.next();
+        CHECK(reader.current().event_type() == staj_event_type::null_value);
+        reader.next();
+        CHECK(reader.current().event_type() == staj_event_type::end_array);
+        reader.next();
+        CHECK(reader.current().as<std::string>() == "last");
+        reader.next();
+        CHECK(reader.current().as<int>() == 7);
+        CHECK(reader.context().line_number() == 6);
+        reader.next();
+        CHECK(reader.current().event_type() == staj_event_type::end_object);
+        reader.next();
+        CHECK(reader.done());
+    }
+
+    SECTION("from a stream with a small buffer")
+    {
+        std::istringstream is(s);
+        json_pull_reader reader(is);
+        reader.buffer_length(3);
+
+        reader.skip();
+        CHECK(reader.current().event_type() == staj_event_type::end_object);
+        reader.next();
+        CHECK(reader.done());
+    }
+
+    SECTION("top level array")
+    {
+        json_pull_reader reader(std::string("[[1,2],[3]]"));
+        reader.skip();
+        CHECK(reader.current().event_type() == staj_event_type::end_array);
+        reader.next();
+        CHECK(reader.done());
+    }
+}
+
+TEST_CASE("json_pull_reader skip error test")
+{
+    SECTION("unexpected eof")
+    {
+        json_pull_reader reader(std::string(R"({"a":[1,2)"));
+        reader.next();
+        reader.next();
+        REQUIRE(reader.current().event_type() == staj_event_type::begin_array);
+        std::error_code ec;
+        reader.skip(ec);
+        CHECK(ec == json_errc::unexpected_eof);
+    }
+    SECTION("mismatched bracket")
+    {
+        json_pull_reader reader(std::string(R"([1,{"a":[]}})"));
+        std::error_code ec;
+        reader.skip(ec);
+        CHECK(ec == json_errc::expected_comma_or_right_bracket);
+        REQUIRE_THROWS(json_pull_reader(std::string(R"([1,{"a":[]}})")).skip());
+    }
+}
+
+
+TEST_CASE("json_pull_reader reset test")
+{
+    json_pull_reader reader(std::string(R"({"a":1})"));
+    CHECK(reader.current().event_type() == staj_event_type::begin_object);
+    reader.next();
+    CHECK(reader.current().event_type() == staj_event_type::name);
+
+    reader.reset(std::string("[10,20]"));
+    CHECK(reader.current().event_type() == staj_event_type::begin_array);
+    reader.next();
+    CHECK(reader.current().as<int>() == 10);
+    reader.next();
+    CHECK(reader.current().as<int>() == 20);
+    reader.next();
+    CHECK(reader.current().event_type() == staj_event_type::end_array);
+    reader.next();
+    CHECK(reader.done());
+
+    std::istringstream is(R"("hello")");
+    reader.reset(is);
+    CHECK(reader.current().event_type() == staj_event_type::string_value);
+    CHECK(reader.current().as<std::string>() == "hello");
+    reader.next();
+    CHECK(reader.done());
+
+    std::error_code ec;
+    reader.reset(std::string("[1,"), ec);
+    REQUIRE_FALSE(ec);
+    reader.next(ec);
+    reader.next(ec);
+    CHECK(ec);
+
+    ec = std::error_code();
+    reader.reset(std::string("false"), ec);
+    REQUIRE_FALSE(ec);
+    CHECK_FALSE(reader.current().as<bool>());
+}
@@ -224,3 +224,48 @@ TEST_CASE("json_reader read from string test")
 
 
 
+
+TEST_CASE("json_reader reset test")
+{
+    json_decoder<json> decoder;
+    json_string_reader reader(string_source<char>(std::string("[1,2]")), decoder);
+    reader.read();
+    CHECK(decoder.get_result() == json::parse("[1,2]"));
+
+    std::string s = R"({"a":"String too long for small string optimization"})";
+    decoder.reset();
+    reader.reset(string_source<char>(s));
+    reader.read();
+    CHECK(decoder.get_result() == json::parse(s));
+
+    SECTION("after an error")
+    {
+        std::error_code ec;
+        decoder.reset();
+        reader.reset(string_source<char>(std::string(R"({"a":[1,{"b")")));
+        reader.read(ec);
+        CHECK(ec);
+
+        ec = std::error_code();
+        decoder.reset();
+        reader.reset(string_source<char>(std::string("[true]")));
+        reader.read(ec);
+        REQUIRE_FALSE(ec);
+        CHECK(decoder.is_valid());
+        CHECK(decoder.get_result() == json::parse("[true]"));
+    }
+
+    SECTION("stream source")
+    {
+        std::istringstream is(R"({"b":[null,2.5]})");
+        decoder.reset();
+        json_reader stream_reader(is, decoder);
+        stream_reader.read();
+        CHECK(decoder.get_result() == json::parse(R"({"b":[null,2.5]})"));
+
+        std::istringstream is2("3");
+        stream_reader.reset(is2);
+        stream_reader.read();
+        CHECK(decoder.get_result() == json(3));
+    }
+}
@@ -29,3 +29,52 @@ TEST_CASE("test_byte_string_serialization")
     CHECK(expected == os.str());
 }
 
+
+TEST_CASE("json_serializer reset test")
+{
+    SECTION("json_compressed_string_serializer")
+    {
+        std::string s1;
+        json_compressed_string_serializer serializer(s1);
+        serializer.begin_array();
+        serializer.uint64_value(1);
+        // abandoned part way
+
+        std::string s2;
+        serializer.reset(s2);
+        serializer.begin_object();
+        serializer.name("a");
+        serializer.begin_array();
+        serializer.uint64_value(1);
+        serializer.uint64_value(2);
+        serializer.end_array();
+        serializer.end_object();
+        serializer.flush();
+        CHECK(s1 == "[1");
+        CHECK(s2 == R"({"a":[1,2]})");
+    }
+
+    SECTION("json_serializer")
+    {
+        std::ostringstream os1;
+        json_serializer serializer(os1);
+        serializer.begin_array();
+        serializer.begin_array();
+        serializer.string_value("x");
+
+        std::ostringstream os2;
+        serializer.reset(os2);
+        serializer.begin_array();
+        serializer.uint64_value(1);
+        serializer.end_array();
+        serializer.flush();
+
+        std::ostringstream os3;
+        json_serializer serializer2(os3);
+        serializer2.begin_array();
+        serializer2.uint64_value(1);
+        serializer2.end_array();
+        serializer2.flush();
+        CHECK(os2.str() == os3.str());
+    }
+}
@@ -0,0 +1,266 @@
+// Copyright 2013 Daniel Parker
+// Distributed under Boost license
+
+#include <jsoncons/json.hpp>
+#include <jsoncons_ext/jsonpath/json_query.hpp>
+#include <jsoncons_ext/jsonpointer/jsonpointer.hpp>
+#include <jsoncons_ext/jsonpatch/jsonpatch.hpp>
+#include <catch/catch.hpp>
+#include <sstream>
+#include <vector>
+#include <string>
+#include <functional>
+#include <cstdint>
+#include <iterator>
+
+using namespace jsoncons;
+
+namespace {
+
+    std::string number_array(size_t n, const std::string& suffix)
+    {
+        std::string s = "[";
+        for (size_t i = 0; i < n; ++i)
+        {
+            if (i > 0)
+            {
+                s.push_back(',');
+            }
+            s.append(std::to_string(i));
+            s.append(suffix);
+        }
+        s.push_back(']');
+        return s;
+    }
+
+    json parse_typed(const std::string& s)
+    {
+        return json::parse(s, json_options().typed_arrays(true));
+    }
+}
+
+TEST_CASE("json typed array decode")
+{
+    SECTION("not typed by default")
+    {
+        CHECK_FALSE(json::parse(number_array(20, ".5")).is_typed_array());
+
+        std::vector<double> v = {1.5,2.5,3.5};
+        json_decoder<json> decoder;
+        decoder.typed_array(v.data(), v.size());
+        json j = decoder.get_result();
+        CHECK_FALSE(j.is_typed_array());
+        CHECK(j == json::parse("[1.5,2.5,3.5]"));
+    }
+    SECTION("double elements")
+    {
+        std::string s = number_array(20, ".5");
+        json j = parse_typed(s);
+        REQUIRE(j.is_typed_array());
+        CHECK(j.is_array());
+        CHECK(j.size() == 20);
+        CHECK(j.typed_array_value().element_tag() == structure_tag_type::double_tag);
+        REQUIRE(j.typed_array_value().double_data() != nullptr);
+        CHECK(j.typed_array_value().double_data()[3] == 3.5);
+        CHECK(j.typed_array_value().int64_data() == nullptr);
+        CHECK(j.to_string() == s);
+    }
+    SECTION("int64 and uint64 elements")
+    {
+        json a = parse_typed(number_array(20, ""));
+        REQUIRE(a.is_typed_array());
+        CHECK(a.typed_array_value().element_tag() == structure_tag_type::uint64_tag);
+
+        json b = parse_typed("[-1,-2,-3,-4,-5,-6,-7,-8,-9,-10,-11,-12,-13,-14,-15,-16]");
+        REQUIRE(b.is_typed_array());
+        CHECK(b.typed_array_value().element_tag() == structure_tag_type::int64_tag);
+        CHECK(b.typed_array_value().int64_data()[15] == -16);
+    }
+    SECTION("short, mixed and nested arrays are not typed")
+    {
+        CHECK_FALSE(parse_typed(number_array(15, ".5")).is_typed_array());
+        CHECK_FALSE(parse_typed("[1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16.5]").is_typed_array());
+        CHECK_FALSE(parse_typed("[1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,null]").is_typed_array());
+
+        json j = parse_typed("{\"a\":" + number_array(16, ".25") + ",\"b\":[1,\"x\"]}");
+        CHECK(j["a"].is_typed_array());
+        CHECK_FALSE(j["b"].is_typed_array());
+    }
+}
+
+TEST_CASE("json typed array access")
+{
+    std::vector<double> v = {1.5,2.5,3.5};
+
+    SECTION("const iteration reads the numbers")
+    {
+        const json j(json::typed_array(v.data(), v.size()));
+        double sum = 0;
+        for (const auto& item : j.array_range())
+        {
+            sum += item.as<double>();
+        }
+        CHECK(sum == 7.5);
+
+        auto first = j.array_range().begin();
+        auto last = j.array_range().end();
+        CHECK(last - first == 3);
+        CHECK(first[1].as<double>() == 2.5);
+        CHECK((first + 2)->as<double>() == 3.5);
+        CHECK(std::vector<json>(first, last) == std::vector<json>({json(1.5),json(2.5),json(3.5)}));
+        CHECK(j.as<std::array<double,3>>()[2] == 3.5);
+        CHECK(&*first != &*(first + 1));
+        std::vector<json> reversed(std::reverse_iterator<json::const_array_iterator>(j.array_range().end()),
+                                   std::reverse_iterator<json::const_array_iterator>(j.array_range().begin()));
+        CHECK(reversed == std::vector<json>({json(3.5),json(2.5),json(1.5)}));
+        CHECK(j.is_typed_array());
+    }
+    SECTION("const indexed access")
+    {
+        const json j(json::typed_array(v.data(), v.size()));
+        CHECK(j[1].as<double>() == 2.5);
+        CHECK(j.at(2).as<double>() == 3.5);
+        CHECK(&j[1] == &*(j.array_range().begin() + 1));
+        CHECK_THROWS_AS(j.at(3), std::out_of_range);
+        CHECK(j.is_typed_array());
+    }
+    SECTION("insert, emplace and erase at a const iterator")
+    {
+        json j(json::typed_array(v.data(), v.size()));
+        const json& cj = j;
+        j.insert(cj.array_range().begin() + 2, json(100));
+        CHECK_FALSE(j.is_typed_array());
+        CHECK(j == json::parse("[1.5,2.5,100,3.5]"));
+
+        json k(json::typed_array(v.data(), v.size()));
+        const json& ck = k;
+        k.emplace(ck.array_range().begin() + 1, "x");
+        CHECK(k == json::parse("[1.5,\"x\",2.5,3.5]"));
+
+        json m(json::typed_array(v.data(), v.size()));
+        const json& cm = m;
+        m.erase(cm.array_range().begin() + 1);
+        CHECK(m == json::parse("[1.5,3.5]"));
+
+        json n(json::typed_array(v.data(), v.size()));
+        const json& cn = n;
+        n.erase(cn.array_range().begin(), cn.array_range().begin() + 2);
+        CHECK(n == json::parse("[3.5]"));
+    }
+    SECTION("non-const element access converts to an array")
+    {
+        json j(json::typed_array(v.data(), v.size()));
+        j[0] = "first";
+        CHECK_FALSE(j.is_typed_array());
+        CHECK(j == json::parse("[\"first\",2.5,3.5]"));
+    }
+    SECTION("push_back")
+    {
+        json j(json::typed_array(v.data(), v.size()));
+        j.push_back(4.5);
+        CHECK(j.is_typed_array());
+        CHECK(j.size() == 4);
+
+        j.push_back(5);
+        CHECK_FALSE(j.is_typed_array());
+        CHECK(j == json::parse("[1.5,2.5,3.5,4.5,5]"));
+    }
+    SECTION("push_back after const access")
+    {
+        json j(json::typed_array(v.data(), v.size()));
+        const json& cj = j;
+        CHECK(cj.array_range().begin()->as<double>() == 1.5);
+        j.push_back(4.5);
+        CHECK(cj.array_range().begin()[3].as<double>() == 4.5);
+        j.clear();
+        CHECK(j.is_typed_array());
+        CHECK(cj.empty());
+    }
+    SECTION("copy, move and swap")
+    {
+        json j(json::typed_array(v.data(), v.size()), semantic_tag_type::none);
+        json copy(j);
+        CHECK(copy.is_typed_array());
+        CHECK(copy == j);
+
+        json moved(std::move(copy));
+        CHECK(moved.is_typed_array());
+        CHECK(moved == j);
+
+        json other = json::parse("[1]");
+        other.swap(moved);
+        CHECK(other.is_typed_array());
+        CHECK(moved == json::parse("[1]"));
+    }
+}
+
+TEST_CASE("json typed array equality, hash and conversion")
+{
+    std::vector<int64_t> v = {1,2,3};
+    json j(json::typed_array(v.data(), v.size()));
+
+    SECTION("equal to arrays with the same numbers")
+    {
+        json a = json::parse("[1,2,3]");
+        json b = json::parse("[1.0,2.0,3.0]");
+        CHECK(j == a);
+        CHECK(a == j);
+        CHECK(j == b);
+        CHECK(j != json::parse("[1,2]"));
+        CHECK(std::hash<json>()(j) == std::hash<json>()(a));
+        CHECK(std::hash<json>()(j) == std::hash<json>()(b));
+
+        std::vector<uint64_t> u = {1,2,3};
+        json k(json::typed_array(u.data(), u.size()));
+        CHECK(j == k);
+        CHECK(std::hash<json>()(j) == std::hash<json>()(k));
+    }
+    SECTION("as and is")
+    {
+        CHECK(j.is<std::vector<int>>());
+        CHECK_FALSE(j.is<std::vector<std::string>>());
+        CHECK(j.as<std::vector<int>>() == std::vector<int>({1,2,3}));
+        CHECK(j.as<std::vector<double>>() == std::vector<double>({1.0,2.0,3.0}));
+        CHECK(j.as<std::vector<std::string>>() == std::vector<std::string>({"1","2","3"}));
+    }
+    SECTION("encode_json")
+    {
+        std::ostringstream os;
+        encode_json(j, os);
+        CHECK(os.str() == "[1,2,3]");
+    }
+}
+
+TEST_CASE("json typed array const queries")
+{
+    const json j = parse_typed("{\"a\":" + number_array(20, ".5") + "}");
+    REQUIRE(j["a"].is_typed_array());
+
+    SECTION("jsonpath")
+    {
+        CHECK(jsonpath::json_query(j, "$.a[1]") == json::parse("[1.5]"));
+        CHECK(jsonpath::json_query(j, "$.a[?(@ > 17)]") == json::parse("[17.5,18.5,19.5]"));
+        CHECK(jsonpath::json_query(j, "$..a[18:]") == json::parse("[18.5,19.5]"));
+        CHECK(jsonpath::json_query(j, "$.a[1]", jsonpath::result_type::path) == json::parse("[\"$['a'][1]\"]"));
+        CHECK(jsonpath::json_query(j, "$.a.*").size() == 20);
+        CHECK(j["a"].is_typed_array());
+    }
+    SECTION("jsonpointer")
+    {
+        CHECK(jsonpointer::get(j, "/a/1") == json(1.5));
+        CHECK(&jsonpointer::get(j, "/a/1") == &j["a"][1]);
+        std::error_code ec2;
+        jsonpointer::get(j, "/a/1/b", ec2);
+        CHECK(ec2 == jsonpointer::jsonpointer_errc::expected_object_or_array);
+        CHECK(jsonpointer::contains(j, "/a/1"));
+        CHECK_FALSE(jsonpointer::contains(j, "/a/20"));
+        CHECK_FALSE(jsonpointer::contains(j, "/a/1/b"));
+    }
+    SECTION("jsonpatch")
+    {
+        json target = json::parse("{\"a\":" + number_array(20, ".5") + "}");
+        target["a"][3] = 0;
+        json patch = jsonpatch::from_diff(j, target);
+        CHECK(patch == json::parse(R"([{"op":"replace","path":"/a/3","value":0}])"));
+    }
+}
@@ -494,3 +494,132 @@ TEST_CASE("add_when_new_items_in_target_array2")
 
 
 
+TEST_CASE("from_diff array insert at front")
+{
+    json source = json::array();
+    for (int i = 0; i < 1000; ++i)
+    {
+        source.push_back(i);
+    }
+    json target = source;
+    target.insert(target.array_range().begin(), -1);
+
+    json patch = jsonpatch::from_diff(source, target);
+
+    json expected = R"(
+        [{"op":"add","path":"/0","value":-1}]
+    )"_json;
+    CHECK(patch == expected);
+    check_patch(source,patch,std::error_code(),target);
+}
+
+TEST_CASE("from_diff array removes and adds")
+{
+    json source = R"(
+        {"foo": [1, 2, 3, 4, 5, {"a":1}, 6, 7]}
+    )"_json;
+
+    json target = R"(
+        {"foo": [0, 1, 3, 4, {"a":2}, 6, 8, 9]}
+    )"_json;
+
+    json patch = jsonpatch::from_diff(source, target);
+
+    json expected = R"(
+    [
+        {"op":"add","path":"/foo/0","value":0},
+        {"op":"remove","path":"/foo/2"},
+        {"op":"remove","path":"/foo/4"},
+        {"op":"replace","path":"/foo/4/a","value":2},
+        {"op":"replace","path":"/foo/6","value":8},
+        {"op":"add","path":"/foo/7","value":9}
+    ]
+    )"_json;
+    CHECK(patch == expected);
+    check_patch(source,patch,std::error_code(),target);
+}
+
+TEST_CASE("from_diff shorter target array")
+{
+    json source = R"([1, 2, 3, 4, 5])"_json;
+    json target = R"([9, 8])"_json;
+
+    json patch = jsonpatch::from_diff(source, target);
+    check_patch(source,patch,std::error_code(),target);
+}
+
+TEST_CASE("abort undoes move and replace")
+{
+    json target = R"(
+        {"foo": [1, {"bar": [2, 3]}, 5], "baz": {"qux": "quux"}}
+    )"_json;
+
+    json patch = R"(
+    [
+        { "op": "move", "from": "/foo/1", "path": "/baz/qux" },
+        { "op": "move", "from": "/foo/0", "path": "/foo/1" },
+        { "op": "replace", "path": "/baz", "value": 4 },
+        { "op": "remove", "path": "/foo" },
+        { "op": "test", "path": "/baz", "value": 5 }
+    ]
+    )"_json;
+
+    json expected = target;
+    check_patch(target,patch,jsonpatch::jsonpatch_errc::test_failed,expected);
+}
+
+TEST_CASE("non_atomic patch")
+{
+    json target = R"(
+        {"foo": [1, 2], "baz": "qux"}
+    )"_json;
+
+    SECTION("success")
+    {
+        json patch = R"(
+        [
+            { "op": "move", "from": "/foo", "path": "/bar" },
+            { "op": "replace", "path": "/baz", "value": 3 }
+        ]
+        )"_json;
+
+        std::error_code ec;
+        jsonpatch::apply_patch(target, patch, jsonpatch::patch_mode::non_atomic, ec);
+        CHECK_FALSE(ec);
+        CHECK(target == R"({"bar": [1, 2], "baz": 3})"_json);
+    }
+
+    SECTION("failure leaves earlier operations applied")
+    {
+        json patch = R"(
+        [
+            { "op": "remove", "path": "/baz" },
+            { "op": "remove", "path": "/baz" }
+        ]
+        )"_json;
+
+        std::error_code ec;
+        jsonpatch::apply_patch(target, patch, jsonpatch::patch_mode::non_atomic, ec);
+        CHECK(ec == jsonpatch::jsonpatch_errc::remove_failed);
+        CHECK(target == R"({"foo": [1, 2]})"_json);
+    }
+}
+
+TEST_CASE("from_diff with hash caches")
+{
+    json source = R"(
+        {"foo": [1, {"a": [1, 2, 3]}, {"b": 2}], "bar": {"baz": [4, 5]}}
+    )"_json;
+
+    json target = R"(
+        {"foo": [0, 1, {"a": [1, 2, 3]}, {"b": 3}], "bar": {"baz": [4, 5]}}
+    )"_json;
+
+    json_hash_cache<json> source_hashes(source);
+    json_hash_cache<json> target_hashes(target);
+
+    json patch = jsonpatch::from_diff(source, target, source_hashes, target_hashes);
+    CHECK(patch == jsonpatch::from_diff(source, target));
+    check_patch(source,patch,std::error_code(),target);
+}
+
@@ -459,6 +459,36 @@ TEST_CASE("test_jsonpath_filter_uni")
     CHECK(json(0) == result1);
 }
 
+TEST_CASE("test_jsonpath_filter_member_paths")
+{
+    json root = json::parse(R"(
+    [
+        {"price" : 8, "category" : "fiction", "details" : {"pages" : [100, 200]}},
+        {"price" : 12, "category" : "fiction", "details" : {"pages" : [300]}},
+        {"price" : 9, "category" : "reference", "details" : {"pages" : []}},
+        {"price" : 5, "category" : "fiction"}
+    ]
+    )");
+
+    json result1 = json_query(root,"$[?(@.price < 10 && @.category == 'fiction')].price");
+    REQUIRE(2 == result1.size());
+    CHECK(json(8) == result1[0]);
+    CHECK(json(5) == result1[1]);
+
+    json result2 = json_query(root,"$[?(@['details']['pages'].length == 1)].price");
+    REQUIRE(1 == result2.size());
+    CHECK(json(12) == result2[0]);
+
+    json result3 = json_query(root,"$[?(@.details.pages[0] >= 100 )].price");
+    REQUIRE(2 == result3.size());
+    CHECK(json(8) == result3[0]);
+    CHECK(json(12) == result3[1]);
+
+    json result4 = json_query(root,"$[?(!@.details)].price");
+    REQUIRE(1 == result4.size());
+    CHECK(json(5) == result4[0]);
+}
+
 #if !(defined(__GNUC__) && (__GNUC__ == 4 && __GNUC_MINOR__ < 9))
 // GCC 4.8 has broken regex support: https://gcc.gnu.org/bugzilla/show_bug.cgi?id=53631
 TEST_CASE("test_jsonpath_filter_regex")
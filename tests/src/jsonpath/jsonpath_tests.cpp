@@ -1399,3 +1399,38 @@ TEST_CASE("test_array_array_nested")
 
 
 
+
+TEST_CASE("test_parallel_policy")
+{
+    json j = json::array();
+    for (size_t i = 0; i < 1000; ++i)
+    {
+        json record;
+        record["id"] = i;
+        record["price"] = i % 20;
+        if (i % 7 == 0)
+        {
+            record["parts"] = json::parse(R"([{"price" : 1}, [{"price" : 3}], {"x" : {"price" : 5}}])");
+        }
+        j.push_back(std::move(record));
+    }
+
+    parallel_policy policy;
+    policy.max_threads(4).min_chunk_size(16);
+
+    std::vector<std::string> paths = {"$[?(@.price < 4)].id",
+                                      "$[*].id",
+                                      "$.*",
+                                      "$..price",
+                                      "$..[?(@.price < 4)]",
+                                      "$..parts[0]",
+                                      "$..x.price"};
+    for (const auto& path : paths)
+    {
+        json expected = json_query(j, path);
+        CHECK(json_query(j, path, result_type::value, policy) == expected);
+
+        json expected_paths = json_query(j, path, result_type::path);
+        CHECK(json_query(j, path, result_type::path, policy) == expected_paths);
+    }
+}
@@ -314,3 +314,112 @@ TEST_CASE("jsonpointer concatenation")
     }
 }
 
+
+TEST_CASE("jsonpointer compiled address")
+{
+    json example = json::parse(R"(
+       {
+          "a/b": ["bar", "baz"],
+          "m~n": ["foo", "qux"],
+          "c" : {"d" : 1}
+       }
+    )");
+
+    SECTION("tokens")
+    {
+        jsonpointer::compiled_address p(jsonpointer::address("/a~1b/1/-"));
+
+        REQUIRE(p.size() == 3);
+        CHECK(p[0].name() == "a/b");
+        CHECK_FALSE(p[0].is_index());
+        CHECK(p[1].is_index());
+        CHECK(p[1].index() == 1);
+        CHECK(p[2].is_end());
+    }
+
+    SECTION("get and contains")
+    {
+        jsonpointer::compiled_address p("/m~0n/1");
+
+        CHECK(jsonpointer::get(example, p) == json("qux"));
+        CHECK(jsonpointer::contains(example, p));
+        CHECK(jsonpointer::get(example, jsonpointer::compiled_address()) == example);
+
+        std::error_code ec;
+        jsonpointer::get(example, jsonpointer::compiled_address("/m~0n/2"), ec);
+        CHECK(ec == jsonpointer::jsonpointer_errc::index_exceeds_array_size);
+        ec = std::error_code();
+        jsonpointer::get(example, jsonpointer::compiled_address("/m~0n/x"), ec);
+        CHECK(ec == jsonpointer::jsonpointer_errc::invalid_index);
+        ec = std::error_code();
+        jsonpointer::get(example, jsonpointer::compiled_address("/c/e"), ec);
+        CHECK(ec == jsonpointer::jsonpointer_errc::name_not_found);
+        CHECK_FALSE(jsonpointer::contains(example, jsonpointer::compiled_address("/c/d/e")));
+    }
+
+    SECTION("malformed")
+    {
+        std::error_code ec;
+        jsonpointer::compiled_address p("a/b", ec);
+        CHECK(ec == jsonpointer::jsonpointer_errc::expected_slash);
+        ec = std::error_code();
+        jsonpointer::compiled_address q("/a~2", ec);
+        CHECK(ec == jsonpointer::jsonpointer_errc::expected_0_or_1);
+        CHECK_THROWS_AS(jsonpointer::compiled_address("/a~2"), jsonpointer::jsonpointer_error);
+    }
+
+    SECTION("updates")
+    {
+        jsonpointer::insert_or_assign(example, jsonpointer::compiled_address("/a~1b/-"), json("qux"));
+        jsonpointer::insert(example, jsonpointer::compiled_address("/a~1b/0"), json("foo"));
+        jsonpointer::replace(example, jsonpointer::compiled_address("/c/d"), json(2));
+        jsonpointer::remove(example, jsonpointer::compiled_address("/m~0n"));
+
+        std::error_code ec;
+        jsonpointer::insert(example, jsonpointer::compiled_address("/c/d"), json(3), ec);
+        CHECK(ec == jsonpointer::jsonpointer_errc::key_already_exists);
+
+        json expected = json::parse(R"(
+           {
+              "a/b": ["foo", "bar", "baz", "qux"],
+              "c" : {"d" : 2}
+           }
+        )");
+        CHECK(example == expected);
+    }
+}
+
+TEST_CASE("jsonpointer address set")
+{
+    json example = json::parse(R"(
+       {
+          "a" : {"b" : {"c" : 1, "d" : [10, 20, 30]}},
+          "e" : "f"
+       }
+    )");
+
+    jsonpointer::address_set locations{"/a/b/c", "/a/b/d/2", "/a/b/d/3", "/a/b/x/y", "", "/e", "/e/g", "/a/b/c"};
+    CHECK(locations.size() == 8);
+
+    std::vector<std::error_code> ec;
+    std::vector<const json*> values = jsonpointer::get(example, locations, ec);
+
+    REQUIRE(values.size() == 8);
+    REQUIRE(ec.size() == 8);
+    CHECK_FALSE(ec[0]);
+    CHECK(*values[0] == json(1));
+    CHECK(*values[1] == json(30));
+    CHECK(ec[2] == jsonpointer::jsonpointer_errc::index_exceeds_array_size);
+    CHECK(values[2] == nullptr);
+    CHECK(ec[3] == jsonpointer::jsonpointer_errc::name_not_found);
+    CHECK(values[4] == &example);
+    CHECK(*values[5] == json("f"));
+    CHECK(ec[6] == jsonpointer::jsonpointer_errc::expected_object_or_array);
+    CHECK(values[7] == values[0]);
+
+    std::error_code e;
+    size_t index = locations.add("a/b", e);
+    CHECK(e == jsonpointer::jsonpointer_errc::expected_slash);
+    CHECK(index == locations.size());
+    CHECK(locations.size() == 8);
+}
@@ -0,0 +1,148 @@
+// Copyright 2018 Daniel Parker
+// Distributed under Boost license
+
+#if defined(_MSC_VER)
+#include "windows.h" // test no inadvertant macro expansions
+#endif
+#include <jsoncons/json.hpp>
+#include <jsoncons_ext/msgpack/msgpack.hpp>
+#include <catch/catch.hpp>
+#include <sstream>
+#include <vector>
+#include <string>
+#include <utility>
+
+using namespace jsoncons;
+using namespace jsoncons::msgpack;
+
+namespace msgpack_pull_reader_tests {
+
+    struct book
+    {
+        std::string author;
+        std::string title;
+        double price = 0.0;
+    };
+}
+
+JSONCONS_MEMBER_TRAITS_DECL(msgpack_pull_reader_tests::book, author, title, price)
+
+using namespace msgpack_pull_reader_tests;
+
+TEST_CASE("msgpack_pull_reader events test")
+{
+    json j = json::parse(R"({"a":[1,-2,"three",null,true,2.5]})");
+    std::vector<uint8_t> v;
+    encode_msgpack(j, v);
+
+    msgpack_buffer_pull_reader reader(v);
+
+    REQUIRE_FALSE(reader.done());
+    CHECK(reader.current().event_type() == staj_event_type::begin_object);
+    reader.next();
+    CHECK(reader.current().event_type() == staj_event_type::name);
+    CHECK(reader.current().as<std::string>() == "a");
+    reader.next();
+    CHECK(reader.current().event_type() == staj_event_type::begin_array);
+    reader.next();
+    CHECK(reader.current().event_type() == staj_event_type::uint64_value);
+    CHECK(reader.current().as<int>() == 1);
+    reader.next();
+    CHECK(reader.current().event_type() == staj_event_type::int64_value);
+    CHECK(reader.current().as<int>() == -2);
+    reader.next();
+    CHECK(reader.current().event_type() == staj_event_type::string_value);
+    CHECK(reader.current().as<std::string>() == "three");
+    reader.next();
+    CHECK(reader.current().event_type() == staj_event_type::null_value);
+    reader.next();
+    CHECK(reader.current().event_type() == staj_event_type::bool_value);
+    CHECK(reader.current().as<bool>());
+    reader.next();
+    CHECK(reader.current().event_type() == staj_event_type::double_value);
+    CHECK(reader.current().as<double>() == 2.5);
+    reader.next();
+    CHECK(reader.current().event_type() == staj_event_type::end_array);
+    reader.next();
+    CHECK(reader.current().event_type() == staj_event_type::end_object);
+    reader.next();
+    CHECK(reader.done());
+}
+
+TEST_CASE("msgpack_pull_reader iterator test")
+{
+    json j = json::parse(R"([{"author":"Haruki Murakami","title":"Kafka on the Shore","price":25.17},{"author":"Charles Bukowski","title":"Pulp","price":22.48}])");
+    std::vector<uint8_t> v;
+    encode_msgpack(j, v);
+
+    SECTION("staj_array_iterator")
+    {
+        msgpack_buffer_pull_reader reader(v);
+        staj_array_iterator<json> it(reader);
+
+        std::vector<json> books;
+        for (const auto& val : it)
+        {
+            books.push_back(val);
+        }
+        REQUIRE(books.size() == 2);
+        CHECK(books[0] == j[0]);
+        CHECK(books[1] == j[1]);
+    }
+
+    SECTION("skip")
+    {
+        msgpack_buffer_pull_reader reader(v);
+        reader.next();
+        reader.skip();
+        CHECK(reader.current().event_type() == staj_event_type::end_object);
+        reader.next();
+        CHECK(reader.current().event_type() == staj_event_type::begin_object);
+        reader.next();
+        CHECK(reader.current().as<std::string>() == "author");
+        reader.next();
+        CHECK(reader.current().as<std::string>() == "Charles Bukowski");
+    }
+
+    SECTION("decode_msgpack")
+    {
+        std::vector<book> books = decode_msgpack<std::vector<book>>(v);
+        REQUIRE(books.size() == 2);
+        CHECK(books[0].author == "Haruki Murakami");
+        CHECK(books[1].title == "Pulp");
+        CHECK(books[1].price == 22.48);
+
+        std::string s(v.begin(),v.end());
+        std::istringstream is(s);
+        std::vector<book> books2 = decode_msgpack<std::vector<book>>(is);
+        REQUIRE(books2.size() == 2);
+        CHECK(books2[0].title == "Kafka on the Shore");
+    }
+}
+
+TEST_CASE("msgpack_pull_reader error test")
+{
+    std::vector<uint8_t> v = {0x92,0x01}; // array of two items, with only one
+
+    std::error_code ec;
+    msgpack_buffer_pull_reader reader(v, ec);
+    REQUIRE_FALSE(ec);
+    reader.next(ec);
+    REQUIRE_FALSE(ec);
+    CHECK(reader.current().as<int>() == 1);
+    reader.next(ec);
+    CHECK(ec == msgpack_errc::unexpected_eof);
+
+    REQUIRE_THROWS(decode_msgpack<std::vector<int>>(v));
+}
+
+TEST_CASE("msgpack_pull_reader str8 test")
+{
+    std::string s(200, 'x');
+    std::vector<uint8_t> v;
+    encode_msgpack(json(s), v);
+    REQUIRE(v[0] == msgpack_format::str8_cd);
+
+    CHECK(decode_msgpack<std::string>(v) == s);
+    CHECK(decode_msgpack<json>(v).as<std::string>() == s);
+}
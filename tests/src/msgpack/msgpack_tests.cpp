@@ -145,3 +145,59 @@ TEST_CASE("msgpack_test2")
 
     //CHECK(j1 == j2);
 }
+
+TEST_CASE("msgpack partial input test")
+{
+    json j = json::parse(R"(
+    {
+        "name" : "String too long for small string optimization",
+        "values" : [1,-300,70000,-5000000000,2.5,true,null],
+        "nested" : {"a" : [[],{}], "b" : "x"}
+    }
+    )");
+    std::vector<uint8_t> v;
+    encode_msgpack(j, v);
+
+    for (size_t chunk_length = 1; chunk_length <= v.size(); ++chunk_length)
+    {
+        json_decoder<json> decoder;
+        basic_msgpack_parser<partial_buffer_source> parser{partial_buffer_source()};
+
+        std::error_code ec;
+        for (size_t pos = 0; pos < v.size(); pos += chunk_length)
+        {
+            CHECK(parser.source_exhausted());
+            parser.update(v.data() + pos, (std::min)(chunk_length, v.size() - pos));
+            parser.parse_some(decoder, ec);
+            REQUIRE_FALSE(ec);
+        }
+        // the decoder stops after the end of the root item
+        REQUIRE(parser.stopped());
+        parser.restart();
+        parser.parse_some(decoder, ec);
+        REQUIRE_FALSE(ec);
+        REQUIRE(parser.done());
+        CHECK(decoder.get_result() == j);
+    }
+}
+
+TEST_CASE("msgpack partial input deep nesting test")
+{
+    const size_t depth = 100000;
+    std::vector<uint8_t> v(depth, 0x91); // arrays of one item
+    v.push_back(0x90); // empty array
+
+    std::string s;
+    json_compressed_string_serializer serializer(s);
+    basic_msgpack_parser<partial_buffer_source> parser{partial_buffer_source()};
+
+    std::error_code ec;
+    for (size_t pos = 0; pos < v.size() && !parser.done(); pos += 7)
+    {
+        parser.update(v.data() + pos, (std::min)((size_t)7, v.size() - pos));
+        parser.parse_some(serializer, ec);
+        REQUIRE_FALSE(ec);
+    }
+    REQUIRE(parser.done());
+    CHECK(s == std::string(depth+1,'[') + std::string(depth+1,']'));
+}
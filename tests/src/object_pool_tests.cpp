@@ -0,0 +1,82 @@
+// Copyright 2018 Daniel Parker
+// Distributed under Boost license
+
+#include <jsoncons/json.hpp>
+#include <jsoncons/json_parser.hpp>
+#include <jsoncons/object_pool.hpp>
+#include <catch/catch.hpp>
+#include <string>
+#include <vector>
+#include <utility>
+
+using namespace jsoncons;
+
+TEST_CASE("object_pool test")
+{
+    object_pool<std::vector<int>> pool(2);
+    CHECK(pool.size() == 0);
+
+    const std::vector<int>* p = nullptr;
+    {
+        auto v = pool.acquire(100, 1);
+        CHECK(v->size() == 100);
+        p = v.get();
+    }
+    CHECK(pool.size() == 1);
+    {
+        auto v = pool.acquire();
+        CHECK(v.get() == p); // the pooled object, as it was left
+        CHECK(v->size() == 100);
+        CHECK(pool.size() == 0);
+
+        auto w = std::move(v);
+        CHECK(w.get() == p);
+    }
+    CHECK(pool.size() == 1);
+    {
+        auto v1 = pool.acquire();
+        auto v2 = pool.acquire();
+        auto v3 = pool.acquire();
+        CHECK(v2->empty());
+    }
+    CHECK(pool.size() == 2);
+    pool.clear();
+    CHECK(pool.size() == 0);
+}
+
+namespace {
+
+    struct message_decoder
+    {
+        json_parser parser;
+        json_decoder<json> decoder;
+
+        json decode(const std::string& s)
+        {
+            parser.reset();
+            decoder.reset();
+            parser.update(s.data(),s.length());
+            parser.parse_some(decoder);
+            parser.finish_parse(decoder);
+            parser.check_done();
+            return decoder.get_result();
+        }
+    };
+}
+
+TEST_CASE("object_pool thread_local decoder test")
+{
+    static thread_local object_pool<message_decoder> pool;
+
+    std::vector<std::string> messages = {R"({"id":1,"tags":["a","b"]})", "[1,2,3]", R"("text")", R"({"id":2})"};
+    for (const auto& s : messages)
+    {
+        auto d = pool.acquire();
+        CHECK(d->decode(s) == json::parse(s));
+    }
+    CHECK(pool.size() == 1);
+
+    auto d = pool.acquire();
+    REQUIRE_THROWS(d->decode("[1,"));
+    CHECK(d->decode("[4]") == json::parse("[4]"));
+}
@@ -80,3 +80,81 @@ TEST_CASE("object_iterator test")
 
 
 
+
+TEST_CASE("staj iterator skip test")
+{
+    std::string s = R"({"first":[1,2,3],"second":{"a":[4,5],"b":"c"},"third":[[6],7,{"d":8}]})";
+
+    json_pull_reader reader(s);
+    reader.next();
+    CHECK(reader.current().as<std::string>() == "first");
+    reader.next();
+
+    staj_array_iterator<int> it1(reader);
+    REQUIRE((it1 != end(it1)));
+    CHECK(*it1 == 1);
+    it1.skip();
+    CHECK((it1 == end(it1)));
+    CHECK(reader.current().event_type() == staj_event_type::end_array);
+
+    reader.next();
+    CHECK(reader.current().as<std::string>() == "second");
+    reader.next();
+
+    staj_object_iterator<json> it2(reader);
+    REQUIRE((it2 != end(it2)));
+    CHECK(it2->first == "a");
+    it2.skip();
+    CHECK((it2 == end(it2)));
+    CHECK(reader.current().event_type() == staj_event_type::end_object);
+
+    reader.next();
+    CHECK(reader.current().as<std::string>() == "third");
+    reader.next();
+
+    staj_array_iterator<json> it3(reader);
+    REQUIRE((it3 != end(it3)));
+    CHECK(*it3 == json::parse("[6]"));
+    std::error_code ec;
+    it3.skip(ec);
+    CHECK_FALSE(ec);
+    CHECK((it3 == end(it3)));
+
+    reader.next();
+    CHECK(reader.current().event_type() == staj_event_type::end_object);
+    reader.next();
+    CHECK(reader.done());
+}
+
+TEST_CASE("staj iterator nested containers test")
+{
+    SECTION("array of arrays")
+    {
+        json_pull_reader reader(R"([[1,2],[],[3]])");
+        staj_array_iterator<std::vector<int>> it(reader);
+
+        std::vector<std::vector<int>> v;
+        for (const auto& item : it)
+        {
+            v.push_back(item);
+        }
+        REQUIRE(v.size() == 3);
+        CHECK(v[0] == std::vector<int>({1,2}));
+        CHECK(v[1].empty());
+        CHECK(v[2] == std::vector<int>({3}));
+    }
+    SECTION("object of objects")
+    {
+        json_pull_reader reader(R"({"a":{"x":1},"b":{},"c":{"y":[2]}})");
+        staj_object_iterator<json> it(reader);
+
+        std::vector<std::string> keys;
+        for (const auto& item : it)
+        {
+            keys.push_back(item.first);
+        }
+        REQUIRE(keys.size() == 3);
+        CHECK(keys[2] == "c");
+        CHECK(reader.current().event_type() == staj_event_type::end_object);
+    }
+}
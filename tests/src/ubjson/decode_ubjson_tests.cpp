@@ -180,3 +180,35 @@ TEST_CASE("decode indefinite length ubjson arrays and maps")
 }
 
 
+
+TEST_CASE("ubjson partial input test")
+{
+    // {"a":[$i#U<3>1 2 3],"b":"hello","c":[1.5,{}]}
+    std::vector<uint8_t> v = {'{',
+                              'U',0x01,'a','[','$','i','#','U',0x03,0x01,0x02,0x03,
+                              'U',0x01,'b','S','U',0x05,'h','e','l','l','o',
+                              'U',0x01,'c','[','D',0x3f,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,'{','}',']',
+                              '}'};
+    json expected = json::parse(R"({"a":[1,2,3],"b":"hello","c":[1.5,{}]})");
+
+    for (size_t chunk_length = 1; chunk_length <= v.size(); ++chunk_length)
+    {
+        json_decoder<json> decoder;
+        basic_ubjson_parser<partial_buffer_source> parser{partial_buffer_source()};
+
+        std::error_code ec;
+        for (size_t pos = 0; pos < v.size(); pos += chunk_length)
+        {
+            parser.update(v.data() + pos, (std::min)(chunk_length, v.size() - pos));
+            parser.parse_some(decoder, ec);
+            REQUIRE_FALSE(ec);
+        }
+        // the decoder stops after the end of the root item
+        REQUIRE(parser.stopped());
+        parser.restart();
+        parser.parse_some(decoder, ec);
+        REQUIRE_FALSE(ec);
+        REQUIRE(parser.done());
+        CHECK(decoder.get_result() == expected);
+    }
+}
@@ -0,0 +1,126 @@
+// Copyright 2018 Daniel Parker
+// Distributed under Boost license
+
+#if defined(_MSC_VER)
+#include "windows.h" // test no inadvertant macro expansions
+#endif
+#include <jsoncons/json.hpp>
+#include <jsoncons_ext/ubjson/ubjson.hpp>
+#include <catch/catch.hpp>
+#include <sstream>
+#include <vector>
+#include <string>
+#include <utility>
+
+using namespace jsoncons;
+using namespace jsoncons::ubjson;
+
+namespace ubjson_pull_reader_tests {
+
+    struct series
+    {
+        std::string name;
+        std::vector<int> points;
+    };
+}
+
+JSONCONS_MEMBER_TRAITS_DECL(ubjson_pull_reader_tests::series, name, points)
+
+using namespace ubjson_pull_reader_tests;
+
+TEST_CASE("ubjson_pull_reader events test")
+{
+    json j = json::parse(R"({"a":[1,-2,"three",null,true,2.5],"b":{}})");
+    std::vector<uint8_t> v;
+    encode_ubjson(j, v);
+
+    ubjson_buffer_pull_reader reader(v);
+
+    REQUIRE_FALSE(reader.done());
+    CHECK(reader.current().event_type() == staj_event_type::begin_object);
+    reader.next();
+    CHECK(reader.current().as<std::string>() == "a");
+    reader.next();
+    CHECK(reader.current().event_type() == staj_event_type::begin_array);
+    reader.next();
+    CHECK(reader.current().as<int>() == 1);
+    reader.next();
+    CHECK(reader.current().as<int>() == -2);
+    reader.next();
+    CHECK(reader.current().as<std::string>() == "three");
+    reader.next();
+    CHECK(reader.current().event_type() == staj_event_type::null_value);
+    reader.next();
+    CHECK(reader.current().as<bool>());
+    reader.next();
+    CHECK(reader.current().as<double>() == 2.5);
+    reader.next();
+    CHECK(reader.current().event_type() == staj_event_type::end_array);
+    reader.next();
+    CHECK(reader.current().as<std::string>() == "b");
+    reader.next();
+    CHECK(reader.current().event_type() == staj_event_type::begin_object);
+    reader.next();
+    CHECK(reader.current().event_type() == staj_event_type::end_object);
+    reader.next();
+    CHECK(reader.current().event_type() == staj_event_type::end_object);
+    reader.next();
+    CHECK(reader.done());
+}
+
+TEST_CASE("ubjson_pull_reader typed array test")
+{
+    // {"name":"s1","points":[$i#U3 1 2 3]}
+    std::vector<uint8_t> v = {'{',
+                              'U',4,'n','a','m','e','S','U',2,'s','1',
+                              'U',6,'p','o','i','n','t','s',
+                              '[','$','i','#','U',3,1,2,3,
+                              '}'};
+
+    ubjson_buffer_pull_reader reader(v);
+    reader.next();
+    reader.next();
+    reader.next();
+    CHECK(reader.current().as<std::string>() == "points");
+    reader.next();
+    REQUIRE(reader.current().event_type() == staj_event_type::begin_array);
+    reader.next();
+    CHECK(reader.current().event_type() == staj_event_type::int64_value);
+    CHECK(reader.current().as<int>() == 1);
+    reader.next();
+    CHECK(reader.current().as<int>() == 2);
+    reader.next();
+    CHECK(reader.current().as<int>() == 3);
+    reader.next();
+    CHECK(reader.current().event_type() == staj_event_type::end_array);
+    reader.next();
+    CHECK(reader.current().event_type() == staj_event_type::end_object);
+    reader.next();
+    CHECK(reader.done());
+
+    series s = decode_ubjson<series>(v);
+    CHECK(s.name == "s1");
+    CHECK(s.points == std::vector<int>({1,2,3}));
+
+    std::string str(v.begin(),v.end());
+    std::istringstream is(str);
+    series s2 = decode_ubjson<series>(is);
+    CHECK(s2.points == std::vector<int>({1,2,3}));
+}
+
+TEST_CASE("ubjson_pull_reader strongly typed object test")
+{
+    // {$U#U2 "a" 1 "b" 2}
+    std::vector<uint8_t> v = {'{','$','U','#','U',2,'U',1,'a',1,'U',1,'b',2};
+
+    ubjson_buffer_pull_reader reader(v);
+    staj_object_iterator<int> it(reader);
+
+    int sum = 0;
+    for (const auto& kv : it)
+    {
+        sum += kv.second;
+    }
+    CHECK(sum == 3);
+    CHECK(reader.current().event_type() == staj_event_type::end_object);
+}
@@ -8,6 +8,7 @@
 #include <jsoncons_ext/ubjson/ubjson.hpp>
 #include <sstream>
 #include <vector>
+#include <map>
 #include <utility>
 #include <ctime>
 #include <limits>
@@ -105,3 +106,87 @@ TEST_CASE("Too many and too few items in UBJSON object or array")
         serializer.flush();
     }
 }
+
+TEST_CASE("ubjson typed arrays")
+{
+    SECTION("int64 elements are written with the smallest type that holds them")
+    {
+        std::vector<int64_t> a = {-100,0,100};
+        std::vector<uint8_t> v;
+        ubjson_buffer_serializer serializer(v);
+        serializer.typed_array(a.data(), a.size());
+        serializer.flush();
+
+        std::vector<uint8_t> expected = {'[','$','i','#','U',3,0x9c,0x00,0x64};
+        CHECK(v == expected);
+
+        json j = decode_ubjson<json>(v);
+        CHECK(j == json::parse("[-100,0,100]"));
+    }
+    SECTION("uint64 elements")
+    {
+        std::vector<uint64_t> a = {1,70000};
+        std::vector<uint8_t> v;
+        ubjson_buffer_serializer serializer(v);
+        serializer.typed_array(a.data(), a.size());
+        serializer.flush();
+
+        std::vector<uint8_t> expected = {'[','$','l','#','U',2,0,0,0,1,0,1,0x11,0x70};
+        CHECK(v == expected);
+        CHECK(decode_ubjson<json>(v) == json::parse("[1,70000]"));
+    }
+    SECTION("double elements")
+    {
+        std::vector<double> a = {1.5,-2.25,0.1};
+        std::vector<uint8_t> v;
+        ubjson_buffer_serializer serializer(v);
+        encode_json(a, serializer);
+
+        REQUIRE(v.size() == 6 + 3*sizeof(double));
+        CHECK(v[2] == 'D');
+
+        json j = decode_ubjson<json>(v);
+        CHECK_FALSE(j.is_typed_array());
+        REQUIRE(j.size() == 3);
+        CHECK(j[2].as<double>() == 0.1);
+        CHECK(j.as<std::vector<double>>() == a);
+
+        json_decoder<json> decoder(json_options().typed_arrays(true));
+        ubjson_buffer_reader reader(v, decoder);
+        std::error_code ec;
+        reader.read(ec);
+        REQUIRE_FALSE(ec);
+        json k = decoder.get_result();
+        CHECK(k.is_typed_array());
+        CHECK(k == j);
+    }
+    SECTION("float32 elements")
+    {
+        std::array<float,2> a = {{1.5f,-2.25f}};
+        std::vector<uint8_t> v;
+        ubjson_buffer_serializer serializer(v);
+        encode_json(a, serializer);
+
+        REQUIRE(v.size() == 6 + 2*sizeof(float));
+        CHECK(v[2] == 'd');
+        CHECK(decode_ubjson<json>(v) == json::parse("[1.5,-2.25]"));
+    }
+    SECTION("nested in an object")
+    {
+        std::map<std::string,std::vector<int>> m = {{"a",{1,2,3}},{"b",{}}};
+        std::vector<uint8_t> v;
+        ubjson_buffer_serializer serializer(v);
+        encode_json(m, serializer);
+
+        CHECK(decode_ubjson<json>(v) == json::parse(R"({"a":[1,2,3],"b":[]})"));
+    }
+    SECTION("truncated")
+    {
+        std::vector<uint8_t> v = {'[','$','I','#','U',3,0,1,0,2,0};
+        std::error_code ec;
+        json_decoder<json> decoder;
+        ubjson_buffer_reader reader(v, decoder);
+        reader.read(ec);
+        CHECK(ec == ubjson_errc::unexpected_eof);
+    }
+}